@@ -0,0 +1,196 @@
+#ifndef RDF4CPP_BENCHMARKS_SYNTHETICDATA_HPP
+#define RDF4CPP_BENCHMARKS_SYNTHETICDATA_HPP
+
+#include <rdf4cpp/rdf.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Deterministic synthetic RDF data for the benchmarks.
+ * All generators use a fixed seed, so every run of a benchmark works on exactly the same data.
+ *
+ * Every subject has triples_per_subject triples with random predicates out of predicate_count.
+ * Objects are IRIs of other subjects (50%), xsd:int literals (25%) or simple string literals (25%).
+ */
+namespace rdf4cpp::benchmarks {
+
+inline constexpr uint64_t seed = 42;
+inline constexpr size_t triples_per_subject = 10;
+inline constexpr size_t predicate_count = 16;
+inline constexpr size_t graph_count = 4;
+inline constexpr std::string_view base_iri = "http://example.com/";
+
+struct SyntheticTriple {
+    enum struct ObjectKind {
+        IRI,
+        Int,
+        String,
+    };
+
+    size_t subject;
+    size_t predicate;
+    ObjectKind object_kind;
+    size_t object;
+};
+
+/**
+ * Calls f with the triple_count synthetic triples, ordered by subject.
+ */
+template<typename F>
+void for_each_triple(size_t const triple_count, F &&f) {
+    std::mt19937_64 rng{seed};
+    size_t const subject_count = triple_count / triples_per_subject + 1;
+
+    for (size_t ix = 0; ix < triple_count; ++ix) {
+        auto const kind = rng() % 4;
+        f(SyntheticTriple{.subject = ix / triples_per_subject,
+                          .predicate = rng() % predicate_count,
+                          .object_kind = kind < 2 ? SyntheticTriple::ObjectKind::IRI
+                                                  : (kind == 2 ? SyntheticTriple::ObjectKind::Int : SyntheticTriple::ObjectKind::String),
+                          .object = rng() % subject_count});
+    }
+}
+
+inline std::string subject_iri(size_t const ix) {
+    return std::string{base_iri} + "s" + std::to_string(ix);
+}
+
+inline std::string predicate_iri(size_t const ix) {
+    return std::string{base_iri} + "p" + std::to_string(ix);
+}
+
+inline std::string graph_iri(size_t const ix) {
+    return std::string{base_iri} + "g" + std::to_string(ix);
+}
+
+/**
+ * @return count distinct IRIs
+ */
+inline std::vector<std::string> make_iris(size_t const count) {
+    std::vector<std::string> iris;
+    iris.reserve(count);
+    for (size_t ix = 0; ix < count; ++ix) {
+        iris.push_back(subject_iri(ix));
+    }
+    return iris;
+}
+
+/**
+ * @return N-Triples (with_graph = false) or N-Quads (with_graph = true) document of the first triple_count synthetic triples.
+ *         In N-Quads every subject is in one of graph_count named graphs.
+ */
+inline std::string make_line_based(size_t const triple_count, bool const with_graph) {
+    std::string document;
+    document.reserve(triple_count * (with_graph ? 130 : 100));
+
+    for_each_triple(triple_count, [&](SyntheticTriple const &triple) {
+        document += '<' + subject_iri(triple.subject) + "> <" + predicate_iri(triple.predicate) + "> ";
+        switch (triple.object_kind) {
+            case SyntheticTriple::ObjectKind::IRI:
+                document += '<' + subject_iri(triple.object) + '>';
+                break;
+            case SyntheticTriple::ObjectKind::Int:
+                document += '"' + std::to_string(triple.object) + "\"^^<http://www.w3.org/2001/XMLSchema#int>";
+                break;
+            case SyntheticTriple::ObjectKind::String:
+                document += "\"text " + std::to_string(triple.object) + '"';
+                break;
+        }
+        if (with_graph) {
+            document += " <" + graph_iri(triple.subject % graph_count) + '>';
+        }
+        document += " .\n";
+    });
+    return document;
+}
+
+/**
+ * @return N-Triples document of the first triple_count synthetic triples
+ */
+inline std::string make_ntriples(size_t const triple_count) {
+    return make_line_based(triple_count, false);
+}
+
+/**
+ * @return N-Quads document of the first triple_count synthetic triples
+ */
+inline std::string make_nquads(size_t const triple_count) {
+    return make_line_based(triple_count, true);
+}
+
+/**
+ * @return Turtle document of the first triple_count synthetic triples, using prefixed names and grouping triples by subject
+ */
+inline std::string make_turtle(size_t const triple_count) {
+    std::string document = "@prefix ex: <" + std::string{base_iri} + "> .\n"
+                           "@prefix xsd: <http://www.w3.org/2001/XMLSchema#> .\n";
+    document.reserve(triple_count * 50);
+
+    size_t current_subject = static_cast<size_t>(-1);
+    for_each_triple(triple_count, [&](SyntheticTriple const &triple) {
+        if (triple.subject != current_subject) {
+            if (current_subject != static_cast<size_t>(-1)) {
+                document += " .\n";
+            }
+            document += "ex:s" + std::to_string(triple.subject) + ' ';
+            current_subject = triple.subject;
+        } else {
+            document += " ;\n    ";
+        }
+
+        document += "ex:p" + std::to_string(triple.predicate) + ' ';
+        switch (triple.object_kind) {
+            case SyntheticTriple::ObjectKind::IRI:
+                document += "ex:s" + std::to_string(triple.object);
+                break;
+            case SyntheticTriple::ObjectKind::Int:
+                document += '"' + std::to_string(triple.object) + "\"^^xsd:int";
+                break;
+            case SyntheticTriple::ObjectKind::String:
+                document += "\"text " + std::to_string(triple.object) + '"';
+                break;
+        }
+    });
+    if (current_subject != static_cast<size_t>(-1)) {
+        document += " .\n";
+    }
+    return document;
+}
+
+/**
+ * @return the first triple_count synthetic triples as Quads in the default graph
+ */
+inline std::vector<rdf::Quad> make_quads(size_t const triple_count, rdf::storage::node::NodeStorage &node_storage) {
+    std::vector<rdf::IRI> predicates;
+    predicates.reserve(predicate_count);
+    for (size_t ix = 0; ix < predicate_count; ++ix) {
+        predicates.emplace_back(predicate_iri(ix), node_storage);
+    }
+
+    std::vector<rdf::Quad> quads;
+    quads.reserve(triple_count);
+    for_each_triple(triple_count, [&](SyntheticTriple const &triple) {
+        rdf::Node object;
+        switch (triple.object_kind) {
+            case SyntheticTriple::ObjectKind::IRI:
+                object = rdf::IRI{subject_iri(triple.object), node_storage};
+                break;
+            case SyntheticTriple::ObjectKind::Int:
+                object = rdf::Literal::make_typed_from_value<rdf::datatypes::xsd::Int>(static_cast<int32_t>(triple.object), node_storage);
+                break;
+            case SyntheticTriple::ObjectKind::String:
+                object = rdf::Literal::make_simple("text " + std::to_string(triple.object), node_storage);
+                break;
+        }
+        quads.emplace_back(rdf::IRI::default_graph(node_storage), rdf::IRI{subject_iri(triple.subject), node_storage}, predicates[triple.predicate], object);
+    });
+    return quads;
+}
+
+}  // namespace rdf4cpp::benchmarks
+
+#endif  //RDF4CPP_BENCHMARKS_SYNTHETICDATA_HPP
@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+
+#include <vector>
+
+#include "SyntheticData.hpp"
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+namespace {
+
+constexpr size_t triple_count = 100'000;
+
+enum struct Bound {
+    Subject,
+    Predicate,
+    Object,
+    SubjectPredicate,
+};
+
+template<typename Backend>
+Dataset &dataset() {
+    static Dataset instance = [] {
+        auto ret = Dataset::new_instance<Backend>();
+        auto const quads = rdf4cpp::benchmarks::make_quads(triple_count, storage::node::NodeStorage::default_instance());
+        ret.add_bulk(quads);
+        return ret;
+    }();
+    return instance;
+}
+
+/**
+ * @return 64 patterns with the positions given by bound set to nodes of the synthetic data
+ */
+std::vector<query::QuadPattern> patterns(Bound const bound) {
+    query::Variable const g{"g"};
+    query::Variable const s{"s"};
+    query::Variable const p{"p"};
+    query::Variable const o{"o"};
+
+    std::vector<query::QuadPattern> ret;
+    for (size_t ix = 0; ix < 64; ++ix) {
+        IRI const subject{rdf4cpp::benchmarks::subject_iri(ix * 97 % (triple_count / rdf4cpp::benchmarks::triples_per_subject))};
+        IRI const predicate{rdf4cpp::benchmarks::predicate_iri(ix % rdf4cpp::benchmarks::predicate_count)};
+
+        switch (bound) {
+            case Bound::Subject:
+                ret.emplace_back(g, subject, p, o);
+                break;
+            case Bound::Predicate:
+                ret.emplace_back(g, s, predicate, o);
+                break;
+            case Bound::Object:
+                ret.emplace_back(g, s, p, subject);
+                break;
+            case Bound::SubjectPredicate:
+                ret.emplace_back(g, subject, predicate, o);
+                break;
+        }
+    }
+    return ret;
+}
+
+template<typename Backend, Bound bound>
+void BM_match(benchmark::State &state) {
+    auto const &data = dataset<Backend>();
+    auto const pats = patterns(bound);
+
+    size_t solutions = 0;
+    for (auto _ : state) {
+        for (auto const &pattern : pats) {
+            auto const sequence = data.match(pattern);
+            for (auto it = sequence.begin(); it != sequence.end(); ++it) {
+                benchmark::DoNotOptimize(*it);
+                ++solutions;
+            }
+        }
+    }
+    state.counters["solutions"] = benchmark::Counter(static_cast<double>(solutions), benchmark::Counter::kAvgIterations);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pats.size()));
+}
+
+template<typename Backend>
+void BM_iterate(benchmark::State &state) {
+    auto const &data = dataset<Backend>();
+
+    for (auto _ : state) {
+        for (auto const &quad : data) {
+            benchmark::DoNotOptimize(quad);
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_iterate, DefaultDatasetBackend)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_iterate, IndexedDatasetBackend)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_iterate, MVCCDatasetBackend)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_match, DefaultDatasetBackend, Bound::Subject)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, DefaultDatasetBackend, Bound::Predicate)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, DefaultDatasetBackend, Bound::Object)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, DefaultDatasetBackend, Bound::SubjectPredicate)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_match, IndexedDatasetBackend, Bound::Subject)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, IndexedDatasetBackend, Bound::Predicate)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, IndexedDatasetBackend, Bound::Object)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, IndexedDatasetBackend, Bound::SubjectPredicate)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_match, MVCCDatasetBackend, Bound::Subject)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, MVCCDatasetBackend, Bound::Predicate)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, MVCCDatasetBackend, Bound::Object)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_match, MVCCDatasetBackend, Bound::SubjectPredicate)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_MAIN();
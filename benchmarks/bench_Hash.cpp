@@ -0,0 +1,121 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "SyntheticData.hpp"
+
+/**
+ * Compares the string hash functions used by the node storages on IRIs.
+ *
+ * Besides the synthetic IRIs, a corpus of real IRIs can be provided with the environment variable RDF4CPP_BENCHMARK_IRI_FILE,
+ * a file with one IRI per line, e.g. extracted from an N-Triples dump with
+ *      grep -o '<[^>]*>' dump.nt | tr -d '<>' | sort -u > iris.txt
+ */
+
+using namespace rdf4cpp::rdf::storage::util;
+
+namespace {
+
+enum struct Corpus {
+    Synthetic,
+    Wikidata,
+    DBpedia,
+    File,
+};
+
+constexpr size_t iri_count = 1 << 16;
+
+/**
+ * @return the IRIs of the corpus or an empty vector if it is not available
+ */
+std::vector<std::string> iris(Corpus const corpus) {
+    switch (corpus) {
+        case Corpus::Synthetic: {
+            return rdf4cpp::benchmarks::make_iris(iri_count);
+        }
+        case Corpus::Wikidata: {
+            // short local names behind a shared prefix
+            std::vector<std::string> ret;
+            ret.reserve(iri_count);
+            for (size_t ix = 0; ix < iri_count; ++ix) {
+                ret.push_back("http://www.wikidata.org/entity/Q" + std::to_string(ix * 7919 % 100'000'000));
+            }
+            return ret;
+        }
+        case Corpus::DBpedia: {
+            // long local names, many of them sharing more than the namespace
+            std::vector<std::string> ret;
+            ret.reserve(iri_count);
+            for (size_t ix = 0; ix < iri_count; ++ix) {
+                ret.push_back("http://dbpedia.org/resource/List_of_compositions_by_composer_" + std::to_string(ix % 1024)
+                              + "_(part_" + std::to_string(ix / 1024) + ")");
+            }
+            return ret;
+        }
+        case Corpus::File: {
+            std::vector<std::string> ret;
+            if (char const *path = std::getenv("RDF4CPP_BENCHMARK_IRI_FILE"); path != nullptr) {
+                std::ifstream ifs{path};
+                for (std::string line; std::getline(ifs, line);) {
+                    if (!line.empty()) {
+                        ret.push_back(std::move(line));
+                    }
+                }
+            }
+            return ret;
+        }
+    }
+    return {};
+}
+
+struct RobinHood {
+    static size_t hash(std::string const &s) noexcept {
+        return robin_hood::hash_bytes(s.data(), s.size());
+    }
+};
+
+struct WyHash {
+    static size_t hash(std::string const &s) noexcept {
+        return wyhash::hash_bytes(s.data(), s.size());
+    }
+};
+
+template<typename Hash, Corpus corpus>
+void BM_hash_iris(benchmark::State &state) {
+    auto const corpus_iris = iris(corpus);
+    if (corpus_iris.empty()) {
+        state.SkipWithError("corpus not available, set RDF4CPP_BENCHMARK_IRI_FILE");
+        return;
+    }
+
+    size_t bytes = 0;
+    for (auto const &iri : corpus_iris) {
+        bytes += iri.size();
+    }
+
+    for (auto _ : state) {
+        for (auto const &iri : corpus_iris) {
+            benchmark::DoNotOptimize(Hash::hash(iri));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * corpus_iris.size()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * bytes));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_hash_iris, RobinHood, Corpus::Synthetic);
+BENCHMARK_TEMPLATE(BM_hash_iris, WyHash, Corpus::Synthetic);
+BENCHMARK_TEMPLATE(BM_hash_iris, RobinHood, Corpus::Wikidata);
+BENCHMARK_TEMPLATE(BM_hash_iris, WyHash, Corpus::Wikidata);
+BENCHMARK_TEMPLATE(BM_hash_iris, RobinHood, Corpus::DBpedia);
+BENCHMARK_TEMPLATE(BM_hash_iris, WyHash, Corpus::DBpedia);
+BENCHMARK_TEMPLATE(BM_hash_iris, RobinHood, Corpus::File);
+BENCHMARK_TEMPLATE(BM_hash_iris, WyHash, Corpus::File);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,181 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+
+namespace {
+
+constexpr size_t literal_count = 1 << 12;
+
+/**
+ * @return literal_count valid lexical forms of T, they repeat so that both new and already interned literals are created
+ */
+template<datatypes::LiteralDatatype T>
+std::vector<std::string> lexical_forms() {
+    std::vector<std::string> ret;
+    ret.reserve(literal_count);
+    for (size_t ix = 0; ix < literal_count; ++ix) {
+        auto const value = static_cast<int64_t>(ix % (literal_count / 2)) - static_cast<int64_t>(literal_count / 4);
+
+        if constexpr (std::is_same_v<T, datatypes::xsd::Boolean>) {
+            ret.push_back(ix % 2 == 0 ? "true" : "false");
+        } else if constexpr (std::is_same_v<T, datatypes::xsd::String>) {
+            ret.push_back("text " + std::to_string(value));
+        } else if constexpr (std::is_same_v<T, datatypes::xsd::Decimal>) {
+            ret.push_back(std::to_string(value) + ".25");
+        } else if constexpr (std::is_same_v<T, datatypes::xsd::Double> || std::is_same_v<T, datatypes::xsd::Float>) {
+            ret.push_back(std::to_string(value) + ".5E1");
+        } else {
+            ret.push_back(std::to_string(value));
+        }
+    }
+    return ret;
+}
+
+template<datatypes::LiteralDatatype T>
+std::vector<Literal> literals() {
+    std::vector<Literal> ret;
+    ret.reserve(literal_count);
+    for (auto const &lexical_form : lexical_forms<T>()) {
+        ret.push_back(Literal::make_typed<T>(lexical_form));
+    }
+    return ret;
+}
+
+template<datatypes::LiteralDatatype T>
+void BM_make_typed(benchmark::State &state) {
+    auto const forms = lexical_forms<T>();
+
+    for (auto _ : state) {
+        for (auto const &lexical_form : forms) {
+            benchmark::DoNotOptimize(Literal::make_typed<T>(lexical_form));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * forms.size()));
+}
+
+template<datatypes::LiteralDatatype T>
+void BM_lexical_form(benchmark::State &state) {
+    auto const lits = literals<T>();
+
+    for (auto _ : state) {
+        for (auto const &lit : lits) {
+            benchmark::DoNotOptimize(lit.lexical_form());
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lits.size()));
+}
+
+enum struct NumericOp {
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Compare,
+};
+
+template<datatypes::LiteralDatatype T, NumericOp op>
+void BM_numeric_op(benchmark::State &state) {
+    auto const lhs = literals<T>();
+    auto rhs = lhs;
+    std::rotate(rhs.begin(), rhs.begin() + 1, rhs.end());
+
+    for (auto _ : state) {
+        for (size_t ix = 0; ix < lhs.size(); ++ix) {
+            if constexpr (op == NumericOp::Add) {
+                benchmark::DoNotOptimize(lhs[ix] + rhs[ix]);
+            } else if constexpr (op == NumericOp::Sub) {
+                benchmark::DoNotOptimize(lhs[ix] - rhs[ix]);
+            } else if constexpr (op == NumericOp::Mul) {
+                benchmark::DoNotOptimize(lhs[ix] * rhs[ix]);
+            } else if constexpr (op == NumericOp::Div) {
+                benchmark::DoNotOptimize(lhs[ix] / rhs[ix]);
+            } else {
+                benchmark::DoNotOptimize(lhs[ix].compare(rhs[ix]));
+            }
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * lhs.size()));
+}
+
+/**
+ * @return a text literal of state.range(0) bytes, if non_ascii every 16th code point is a two byte sequence
+ */
+Literal text_literal(benchmark::State const &state, bool const non_ascii) {
+    std::string text;
+    text.reserve(static_cast<size_t>(state.range(0)));
+    for (size_t ix = 0; text.size() < static_cast<size_t>(state.range(0)); ++ix) {
+        if (non_ascii && ix % 16 == 0) {
+            text.append("\u00df");
+        } else {
+            text.push_back(static_cast<char>('a' + ix % 26));
+        }
+    }
+    return Literal::make_simple(text);
+}
+
+void BM_strlen(benchmark::State &state, bool const non_ascii) {
+    auto const lit = text_literal(state, non_ascii);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lit.strlen());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * state.range(0)));
+}
+
+void BM_substr(benchmark::State &state, bool const non_ascii) {
+    auto const lit = text_literal(state, non_ascii);
+    auto const start = static_cast<size_t>(state.range(0) / 2);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lit.substr(start, 16));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * state.range(0) / 2));
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_strlen, ascii, false)->Range(64, 1 << 16);
+BENCHMARK_CAPTURE(BM_strlen, non_ascii, true)->Range(64, 1 << 16);
+BENCHMARK_CAPTURE(BM_substr, ascii, false)->Range(64, 1 << 16);
+BENCHMARK_CAPTURE(BM_substr, non_ascii, true)->Range(64, 1 << 16);
+
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Boolean);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Int);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Long);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Integer);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Decimal);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Float);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::Double);
+BENCHMARK_TEMPLATE(BM_make_typed, datatypes::xsd::String);
+
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Boolean);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Int);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Long);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Integer);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Decimal);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Float);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::Double);
+BENCHMARK_TEMPLATE(BM_lexical_form, datatypes::xsd::String);
+
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Int, NumericOp::Add);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Int, NumericOp::Mul);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Int, NumericOp::Compare);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Integer, NumericOp::Add);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Integer, NumericOp::Sub);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Integer, NumericOp::Mul);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Integer, NumericOp::Div);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Integer, NumericOp::Compare);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Decimal, NumericOp::Add);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Decimal, NumericOp::Mul);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Decimal, NumericOp::Div);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Double, NumericOp::Add);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Double, NumericOp::Mul);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Double, NumericOp::Div);
+BENCHMARK_TEMPLATE(BM_numeric_op, datatypes::xsd::Double, NumericOp::Compare);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SyntheticData.hpp"
+
+/**
+ * Macro benchmarks: load a synthetic dataset of several million triples end-to-end.
+ * Every benchmark runs exactly once per repetition, each time into a fresh NodeStorage and Dataset.
+ *
+ * The dataset sizes can be set with the environment variable RDF4CPP_BENCHMARK_TRIPLES,
+ * a comma separated list of triple counts, e.g. RDF4CPP_BENCHMARK_TRIPLES=1000000,10000000
+ */
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+namespace {
+
+std::vector<int64_t> triple_counts() {
+    std::vector<int64_t> ret;
+    if (char const *env = std::getenv("RDF4CPP_BENCHMARK_TRIPLES"); env != nullptr) {
+        std::istringstream iss{env};
+        for (std::string count; std::getline(iss, count, ',');) {
+            ret.push_back(std::stoll(count));
+        }
+    }
+    if (ret.empty()) {
+        ret = {1'000'000, 5'000'000};
+    }
+    return ret;
+}
+
+/**
+ * Parses an in-memory N-Triples document and loads it into a Dataset.
+ */
+template<typename Backend>
+void BM_parse_and_load(benchmark::State &state) {
+    auto const document = rdf4cpp::benchmarks::make_ntriples(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto node_storage = storage::node::NodeStorage::new_instance();
+        auto dataset = Dataset::new_instance<Backend>(node_storage);
+
+        parser::IStreamQuadIterator qit{std::string_view{document}, parser::ParsingFlags::none(), {}, node_storage};
+        if (dataset.load_from(qit) != 0) {
+            state.SkipWithError("synthetic document could not be parsed");
+            return;
+        }
+        benchmark::DoNotOptimize(dataset.size());
+
+        state.PauseTiming();
+        dataset = Dataset::new_instance<Backend>(node_storage);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * document.size()));
+}
+
+/**
+ * Adds already constructed Quads to a Dataset, i.e. loading without parsing and interning.
+ */
+template<typename Backend>
+void BM_add_bulk(benchmark::State &state) {
+    auto node_storage = storage::node::NodeStorage::new_instance();
+    auto const quads = rdf4cpp::benchmarks::make_quads(static_cast<size_t>(state.range(0)), node_storage);
+
+    for (auto _ : state) {
+        auto dataset = Dataset::new_instance<Backend>(node_storage);
+        dataset.add_bulk(quads);
+        benchmark::DoNotOptimize(dataset.size());
+
+        state.PauseTiming();
+        dataset = Dataset::new_instance<Backend>(node_storage);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Backend>
+void register_benchmarks(std::string const &backend_name) {
+    for (auto const count : triple_counts()) {
+        benchmark::RegisterBenchmark(("BM_parse_and_load<" + backend_name + ">").c_str(), BM_parse_and_load<Backend>)
+                ->Arg(count)
+                ->Iterations(1)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+        benchmark::RegisterBenchmark(("BM_add_bulk<" + backend_name + ">").c_str(), BM_add_bulk<Backend>)
+                ->Arg(count)
+                ->Iterations(1)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    register_benchmarks<IndexedDatasetBackend>("IndexedDatasetBackend");
+    register_benchmarks<MVCCDatasetBackend>("MVCCDatasetBackend");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
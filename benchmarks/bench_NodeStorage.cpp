@@ -0,0 +1,67 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/ReferenceNodeStorageBackend.hpp>
+
+#include <memory>
+
+#include "SyntheticData.hpp"
+
+using namespace rdf4cpp::rdf::storage::node;
+using namespace rdf4cpp::rdf::storage::node::reference_node_storage;
+
+namespace {
+
+/**
+ * Interns state.range(0) new IRIs into an empty backend.
+ */
+template<typename Backend>
+void BM_find_or_make_id_new(benchmark::State &state) {
+    auto const iris = rdf4cpp::benchmarks::make_iris(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto backend = std::make_unique<Backend>();
+        state.ResumeTiming();
+
+        for (auto const &iri : iris) {
+            benchmark::DoNotOptimize(backend->find_or_make_id(view::IRIBackendView{.identifier = iri}));
+        }
+
+        state.PauseTiming();
+        backend.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * iris.size()));
+}
+
+/**
+ * Looks up state.range(0) IRIs that are already in the backend.
+ */
+template<typename Backend>
+void BM_find_or_make_id_existing(benchmark::State &state) {
+    auto const iris = rdf4cpp::benchmarks::make_iris(static_cast<size_t>(state.range(0)));
+    Backend backend;
+    for (auto const &iri : iris) {
+        benchmark::DoNotOptimize(backend.find_or_make_id(view::IRIBackendView{.identifier = iri}));
+    }
+
+    for (auto _ : state) {
+        for (auto const &iri : iris) {
+            benchmark::DoNotOptimize(backend.find_or_make_id(view::IRIBackendView{.identifier = iri}));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * iris.size()));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_find_or_make_id_new, ReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_new, BasicReferenceNodeStorageBackend<NodeTypeStorage, UnseededHashPolicy>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_new, ShardedReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_new, ArenaReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_TEMPLATE(BM_find_or_make_id_existing, ReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_existing, BasicReferenceNodeStorageBackend<NodeTypeStorage, UnseededHashPolicy>)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_existing, ShardedReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+BENCHMARK_TEMPLATE(BM_find_or_make_id_existing, ArenaReferenceNodeStorageBackend)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_MAIN();
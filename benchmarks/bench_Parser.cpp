@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <string>
+#include <vector>
+
+#include "SyntheticData.hpp"
+
+using namespace rdf4cpp::rdf;
+
+namespace {
+
+/**
+ * Parses document completely into a NodeStorage that is shared by all iterations,
+ * i.e. except for the first iteration all nodes are already interned.
+ */
+void parse(benchmark::State &state, std::string const &document, parser::ParsingSyntax const syntax = parser::ParsingSyntax::Turtle) {
+    auto node_storage = storage::node::NodeStorage::new_instance();
+
+    size_t quads = 0;
+    for (auto _ : state) {
+        parser::IStreamQuadIterator qit{std::string_view{document}, parser::ParsingFlags::none(), {}, node_storage, syntax};
+        for (; qit != parser::IStreamQuadIterator{}; ++qit) {
+            if (not qit->has_value()) {
+                state.SkipWithError("synthetic document could not be parsed");
+                return;
+            }
+            benchmark::DoNotOptimize(qit->value());
+            ++quads;
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(quads));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * document.size()));
+}
+
+void BM_parse_ntriples(benchmark::State &state) {
+    parse(state, rdf4cpp::benchmarks::make_ntriples(static_cast<size_t>(state.range(0))));
+}
+
+void BM_parse_nquads(benchmark::State &state) {
+    parse(state, rdf4cpp::benchmarks::make_nquads(static_cast<size_t>(state.range(0))), parser::ParsingSyntax::NQuads);
+}
+
+void BM_parse_turtle(benchmark::State &state) {
+    parse(state, rdf4cpp::benchmarks::make_turtle(static_cast<size_t>(state.range(0))));
+}
+
+void BM_parse_ntriples_batched(benchmark::State &state) {
+    auto const document = rdf4cpp::benchmarks::make_ntriples(static_cast<size_t>(state.range(0)));
+    auto node_storage = storage::node::NodeStorage::new_instance();
+
+    std::vector<Quad> batch;
+    batch.reserve(1024);
+    size_t quads = 0;
+    for (auto _ : state) {
+        parser::IStreamQuadIterator qit{std::string_view{document}, parser::ParsingFlags::none(), {}, node_storage};
+        while (qit != parser::IStreamQuadIterator{}) {
+            batch.clear();
+            if (qit.next_batch(batch, batch.capacity()) == 0) {
+                state.SkipWithError("synthetic document could not be parsed");
+                return;
+            }
+            benchmark::DoNotOptimize(batch.data());
+            quads += batch.size();
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(quads));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * document.size()));
+}
+
+}  // namespace
+
+BENCHMARK(BM_parse_ntriples)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_parse_ntriples_batched)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_parse_nquads)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_parse_turtle)->Arg(10'000)->Arg(100'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
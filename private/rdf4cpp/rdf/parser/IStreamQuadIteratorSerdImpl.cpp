@@ -1,7 +1,9 @@
 #include <rdf4cpp/rdf/parser/IStreamQuadIteratorSerdImpl.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 
 namespace rdf4cpp::rdf::parser {
 
@@ -140,27 +142,32 @@ nonstd::expected<Literal, SerdStatus> IStreamQuadIterator::Impl::get_literal(Ser
         }
     }();
 
-    try {
-        if (datatype_iri.has_value()) {
-            if (!datatype_iri->has_value()) {
-                return nonstd::make_unexpected(datatype_iri->error());
-            }
+    if (datatype_iri.has_value()) {
+        if (!datatype_iri->has_value()) {
+            return nonstd::make_unexpected(datatype_iri->error());
+        }
 
-            return Literal::make_typed(literal_value, datatype_iri->value(), this->node_storage);
-        } else if (lang != nullptr) {
-            return Literal::make_lang_tagged(literal_value, node_into_string_view(lang), this->node_storage);
-        } else {
-            return Literal::make_simple(literal_value, this->node_storage);
+        auto lit = Literal::try_make_typed(literal_value, datatype_iri->value(), this->node_storage);
+        if (!lit.has_value()) [[unlikely]] {
+            // NOTE: line, col not entirely accurate as this function is called after a triple was parsed
+            std::ostringstream message;
+            message << "invalid lexical form \"" << literal_value << "\" for datatype " << datatype_iri->value()
+                    << ". note: position may not be accurate and instead point to the end of the triple.";
+
+            this->last_error = ParsingError{
+                    .error_type = ParsingError::Type::BadLiteral,
+                    .line = serd_reader_get_current_line(this->reader.get()),
+                    .col = serd_reader_get_current_col(this->reader.get()),
+                    .message = std::move(message).str()};
+
+            return nonstd::make_unexpected(SerdStatus::SERD_ERR_BAD_SYNTAX);
         }
-    } catch (std::runtime_error const &e) {
-        // NOTE: line, col not entirely accurate as this function is called after a triple was parsed
-        this->last_error = ParsingError{
-                .error_type = ParsingError::Type::BadLiteral,
-                .line = serd_reader_get_current_line(this->reader.get()),
-                .col = serd_reader_get_current_col(this->reader.get()),
-                .message = std::string{e.what()} + ". note: position may not be accurate and instead point to the end of the triple."};
 
-        return nonstd::make_unexpected(SerdStatus::SERD_ERR_BAD_SYNTAX);
+        return std::move(*lit);
+    } else if (lang != nullptr) {
+        return Literal::make_lang_tagged(literal_value, node_into_string_view(lang), this->node_storage);
+    } else {
+        return Literal::make_simple(literal_value, this->node_storage);
     }
 }
 
@@ -297,20 +304,88 @@ SerdStatus IStreamQuadIterator::Impl::on_stmt(void *voided_self,
     if (!obj_node.has_value()) {
         return obj_node.error();
     }
-    self->quad_buffer.emplace_back(*graph_node, *subj_node, *pred_node, *obj_node);
+
+    ++self->chunk_statements;
+    if (self->batch_sink != nullptr && self->batch_sink->size() < self->batch_limit) {
+        self->batch_sink->emplace_back(*graph_node, *subj_node, *pred_node, *obj_node);
+    } else {
+        self->quad_buffer.emplace_back(*graph_node, *subj_node, *pred_node, *obj_node);
+    }
     return SERD_SUCCESS;
 }
 
-IStreamQuadIterator::Impl::Impl(std::istream &istream, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage) noexcept
-    : istream{std::ref(istream)},
+size_t IStreamQuadIterator::Impl::buffer_read(void *buf, [[maybe_unused]] size_t elem_size, size_t count, void *voided_self) noexcept {
+    assert(elem_size == 1);
+
+    auto *self = reinterpret_cast<BufferSource *>(voided_self);
+    auto const n = std::min(count, static_cast<size_t>(self->end - self->cur));
+    std::memcpy(buf, self->cur, n);
+    self->cur += n;
+    return n;
+}
+
+int IStreamQuadIterator::Impl::buffer_is_ok([[maybe_unused]] void *voided_self) noexcept {
+    return 0;
+}
+
+SerdSyntax IStreamQuadIterator::Impl::serd_syntax(ParsingSyntax const syntax) noexcept {
+    switch (syntax) {
+        case ParsingSyntax::NQuads:
+            return SerdSyntax::SERD_NQUADS;
+        default:
+            return SerdSyntax::SERD_TURTLE;
+    }
+}
+
+IStreamQuadIterator::Impl::Impl(std::istream &istream, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept
+    : istream{&istream},
       node_storage{std::move(node_storage)},
-      reader{serd_reader_new(SerdSyntax::SERD_TURTLE, this, nullptr, &Impl::on_base, &Impl::on_prefix, &Impl::on_stmt, nullptr)},
+      reader{serd_reader_new(serd_syntax(syntax), this, nullptr, &Impl::on_base, &Impl::on_prefix, &Impl::on_stmt, nullptr)},
       prefixes{std::move(prefixes)},
       no_parse_prefixes{flags.contains(ParsingFlag::NoParsePrefix)} {
 
     serd_reader_set_strict(this->reader.get(), flags.contains(ParsingFlag::Strict));
     serd_reader_set_error_sink(this->reader.get(), &Impl::on_error, this);
-    serd_reader_start_source_stream(this->reader.get(), &util::istream_read, &util::istream_is_ok, &this->istream.get(), nullptr, 4096);
+    serd_reader_start_source_stream(this->reader.get(), &util::istream_read, &util::istream_is_ok, this->istream, nullptr, 4096);
+}
+
+IStreamQuadIterator::Impl::Impl(std::string_view buffer, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept
+    : buffer_source{buffer.data(), buffer.data() + buffer.size()},
+      node_storage{std::move(node_storage)},
+      reader{serd_reader_new(serd_syntax(syntax), this, nullptr, &Impl::on_base, &Impl::on_prefix, &Impl::on_stmt, nullptr)},
+      prefixes{std::move(prefixes)},
+      no_parse_prefixes{flags.contains(ParsingFlag::NoParsePrefix)} {
+
+    serd_reader_set_strict(this->reader.get(), flags.contains(ParsingFlag::Strict));
+    serd_reader_set_error_sink(this->reader.get(), &Impl::on_error, this);
+
+    // every page is a single memcpy out of the buffer, so larger pages only mean fewer calls
+    serd_reader_start_source_stream(this->reader.get(), &Impl::buffer_read, &Impl::buffer_is_ok, &this->buffer_source, nullptr, 1 << 16);
+}
+
+std::optional<ParsingError> IStreamQuadIterator::Impl::read_chunk() noexcept {
+    this->last_error = std::nullopt;
+    this->chunk_statements = 0;
+    SerdStatus const st = serd_reader_read_chunk(this->reader.get());
+
+    if (this->chunk_statements > 0) {
+        return std::nullopt;
+    }
+
+    if (st != SerdStatus::SERD_SUCCESS) {
+        // was not able to read stmt, prefix or base
+
+        if (!this->last_error.has_value()) {
+            // did not receive error either => must be eof
+            this->end_flag = true;
+            return std::nullopt;
+        }
+
+        serd_reader_skip_error(this->reader.get());
+    }
+
+    // either a real error or a non-fatal, artificially inserted one
+    return std::move(this->last_error);
 }
 
 std::optional<nonstd::expected<Quad, ParsingError>> IStreamQuadIterator::Impl::next() noexcept {
@@ -318,32 +393,57 @@ std::optional<nonstd::expected<Quad, ParsingError>> IStreamQuadIterator::Impl::n
         return std::nullopt;
     }
 
-    while (this->quad_buffer.empty()) {
-        this->last_error = std::nullopt;
-        SerdStatus const st = serd_reader_read_chunk(this->reader.get());
-
-        if (quad_buffer.empty()) {
-            if (st != SerdStatus::SERD_SUCCESS) {
-                // was not able to read stmt, prefix or base
-
-                if (!this->last_error.has_value()) {
-                    // did not receive error either => must be eof
-                    this->end_flag = true;
-                    return std::nullopt;  // eof reached
-                }
-
-                serd_reader_skip_error(this->reader.get());
-                return nonstd::make_unexpected(*this->last_error);
-            } else if (this->last_error.has_value()) {
-                // non-fatal, artificially inserted error
-                return nonstd::make_unexpected(*this->last_error);
-            }
+    if (this->pending_error.has_value()) [[unlikely]] {
+        auto error = std::move(*this->pending_error);
+        this->pending_error = std::nullopt;
+        return nonstd::make_unexpected(std::move(error));
+    }
+
+    while (this->quad_buffer_pos == this->quad_buffer.size()) {
+        this->quad_buffer.clear();
+        this->quad_buffer_pos = 0;
+
+        if (auto error = this->read_chunk(); error.has_value()) {
+            return nonstd::make_unexpected(std::move(*error));
+        }
+
+        if (this->end_flag) {
+            return std::nullopt;  // eof reached
+        }
+    }
+
+    return std::move(this->quad_buffer[this->quad_buffer_pos++]);
+}
+
+size_t IStreamQuadIterator::Impl::next_batch(std::vector<Quad> &out, size_t max) {
+    auto const begin = out.size();
+    auto const limit = begin + max;
+
+    // leftovers of the last chunk come first
+    while (out.size() < limit && this->quad_buffer_pos < this->quad_buffer.size()) {
+        out.push_back(std::move(this->quad_buffer[this->quad_buffer_pos++]));
+    }
+
+    if (this->pending_error.has_value()) {
+        return out.size() - begin;
+    }
+
+    // serd now writes directly into out
+    this->batch_sink = &out;
+    this->batch_limit = limit;
+
+    while (out.size() < limit && this->quad_buffer_pos == this->quad_buffer.size() && !this->end_flag) {
+        this->quad_buffer.clear();
+        this->quad_buffer_pos = 0;
+
+        if (auto error = this->read_chunk(); error.has_value()) {
+            this->pending_error = std::move(error);
+            break;
         }
     }
 
-    auto ret = this->quad_buffer.front();
-    this->quad_buffer.pop_front();
-    return ret;
+    this->batch_sink = nullptr;
+    return out.size() - begin;
 }
 
 }  // namespace rdf4cpp::rdf::parser
@@ -1,19 +1,19 @@
 #ifndef RDF4CPP_PARSER_PRIVATE_IMPL_HPP
 #define RDF4CPP_PARSER_PRIVATE_IMPL_HPP
 
-#include <deque>
 #include <istream>
 #include <memory>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include <serd/serd.h>
 
 #include <rdf4cpp/rdf/Quad.hpp>
 #include <rdf4cpp/rdf/parser/IStreamQuadIterator.hpp>
-#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
 #include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
 
 namespace rdf4cpp::rdf::parser {
@@ -31,19 +31,34 @@ private:
 
     using OwnedSerdReader = std::unique_ptr<SerdReader, SerdReaderDelete>;
 
-    std::reference_wrapper<std::istream> istream;
+    /**
+     * Input of a reader that parses an in-memory buffer, see Impl(std::string_view, ...)
+     */
+    struct BufferSource {
+        char const *cur;
+        char const *end;
+    };
+
+    std::istream *istream = nullptr;
+    BufferSource buffer_source{nullptr, nullptr};
     mutable storage::node::NodeStorage node_storage;
 
     OwnedSerdReader reader;
 
     PrefixMap prefixes;
-    std::deque<Quad> quad_buffer;
+    std::vector<Quad> quad_buffer;  ///< statements of the current chunk that were not yet yielded
+    size_t quad_buffer_pos = 0;
+    std::vector<Quad> *batch_sink = nullptr;  ///< if set statements are appended here (up to batch_limit) instead of quad_buffer
+    size_t batch_limit = 0;
+    size_t chunk_statements = 0;
     std::optional<ParsingError> last_error;
+    std::optional<ParsingError> pending_error;  ///< error encountered by next_batch, yielded by the next call to next
     bool end_flag = false;
     bool no_parse_prefixes;
 
 private:
     static std::string_view node_into_string_view(SerdNode const *node) noexcept;
+    static SerdSyntax serd_syntax(ParsingSyntax syntax) noexcept;
     static ParsingError::Type parsing_error_type_from_serd(SerdStatus st) noexcept;
 
 private:
@@ -55,17 +70,31 @@ private:
     static SerdStatus on_error(void *voided_self, SerdError const *error) noexcept;
     static SerdStatus on_base(void *voided_self, SerdNode const *uri) noexcept;
     static SerdStatus on_prefix(void *voided_self, SerdNode const *name, SerdNode const *uri) noexcept;
+    static size_t buffer_read(void *buf, size_t elem_size, size_t count, void *voided_self) noexcept;
+    static int buffer_is_ok(void *voided_self) noexcept;
     static SerdStatus on_stmt(void *voided_self, SerdStatementFlags, SerdNode const *graph, SerdNode const *subj, SerdNode const *pred, SerdNode const *obj, SerdNode const *obj_datatype, SerdNode const *obj_lang) noexcept;
 
+    /**
+     * Lets serd read the next chunk (statement, prefix or base directive).
+     * @return the error if the chunk did not produce any statement because of an error
+     */
+    [[nodiscard]] std::optional<ParsingError> read_chunk() noexcept;
+
 public:
-    Impl(std::istream &istream, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage) noexcept;
+    Impl(std::istream &istream, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept;
+
+    /**
+     * Parses the given buffer directly, without going through an std::istream.
+     * @param buffer input, must outlive this
+     */
+    Impl(std::string_view buffer, ParsingFlags flags, PrefixMap prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept;
 
     /**
      * @return true if this will no longer yield values
      * @note one sided implication, could be false and still not yield another value
      */
     [[nodiscard]] inline bool is_at_end() const noexcept {
-        return this->end_flag && quad_buffer.empty();
+        return this->end_flag && this->quad_buffer_pos == this->quad_buffer.size();
     }
 
     inline bool operator==(Impl const &other) const noexcept {
@@ -83,6 +112,14 @@ public:
      *      unexpected ParsingError: if there was a next element but it could not be parsed
      */
     [[nodiscard]] std::optional<nonstd::expected<Quad, ParsingError>> next() noexcept;
+
+    /**
+     * Appends up to max parsed Quads to out, without going through next().
+     * Stops early at eof or at an error, the error is then returned by the next call to next().
+     *
+     * @return number of Quads appended to out
+     */
+    size_t next_batch(std::vector<Quad> &out, size_t max);
 };
 
 }  // namespace rdf4cpp::rdf::parser
@@ -0,0 +1,63 @@
+#include <rdf4cpp/rdf/parser/MappedFile.hpp>
+
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rdf4cpp::rdf::parser {
+
+MappedFile::MappedFile(void *data, size_t size) noexcept
+    : data_{data},
+      size_{size} {
+}
+
+std::unique_ptr<MappedFile> MappedFile::open(std::string const &path) noexcept {
+    int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st {};
+    if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto const size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        // mmap does not accept empty mappings
+        ::close(fd);
+        return std::unique_ptr<MappedFile>{new (std::nothrow) MappedFile{nullptr, 0}};
+    }
+
+    void *data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps the file alive
+
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    // the parser reads front to back, so aggressive read-ahead pays off and pages can be dropped soon after they are read
+    ::madvise(data, size, MADV_SEQUENTIAL);
+
+    std::unique_ptr<MappedFile> mapping{new (std::nothrow) MappedFile{data, size}};
+    if (mapping == nullptr) {
+        ::munmap(data, size);
+    }
+    return mapping;
+}
+
+MappedFile::~MappedFile() noexcept {
+    if (this->data_ != nullptr) {
+        ::munmap(this->data_, this->size_);
+    }
+}
+
+std::string_view MappedFile::view() const noexcept {
+    return std::string_view{static_cast<char const *>(this->data_), this->size_};
+}
+
+}  // namespace rdf4cpp::rdf::parser
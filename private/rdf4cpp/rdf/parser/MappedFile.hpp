@@ -0,0 +1,40 @@
+#ifndef RDF4CPP_PARSER_PRIVATE_MAPPEDFILE_HPP
+#define RDF4CPP_PARSER_PRIVATE_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace rdf4cpp::rdf::parser {
+
+/**
+ * A read-only memory mapping of a whole file that is advised for sequential access.
+ */
+struct MappedFile {
+private:
+    void *data_;
+    size_t size_;
+
+    MappedFile(void *data, size_t size) noexcept;
+
+public:
+    /**
+     * Maps the file at path.
+     * @return the mapping or nullptr if the file could not be opened or mapped
+     */
+    [[nodiscard]] static std::unique_ptr<MappedFile> open(std::string const &path) noexcept;
+
+    MappedFile(MappedFile const &) = delete;
+    MappedFile &operator=(MappedFile const &) = delete;
+    ~MappedFile() noexcept;
+
+    /**
+     * @return the contents of the file, valid as long as this lives
+     */
+    [[nodiscard]] std::string_view view() const noexcept;
+};
+
+}  // namespace rdf4cpp::rdf::parser
+
+#endif  //RDF4CPP_PARSER_PRIVATE_MAPPEDFILE_HPP
@@ -0,0 +1,233 @@
+#include <rdf4cpp/rdf/parser/ParallelChunkParser.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace rdf4cpp::rdf::parser {
+
+ParallelChunkParser::ParallelChunkParser(std::unique_ptr<std::istream> input, ParallelParsingOptions const &options, ParsingFlags flags, storage::node::NodeStorage node_storage)
+    : input{std::move(input)},
+      flags{flags},
+      syntax{options.syntax},
+      node_storage{std::move(node_storage)},
+      chunk_size{std::max(options.chunk_size, size_t{1})},
+      ordered{options.ordered} {
+
+    this->start_workers(options.num_threads);
+}
+
+ParallelChunkParser::ParallelChunkParser(std::string_view buffer, ParallelParsingOptions const &options, ParsingFlags flags, storage::node::NodeStorage node_storage)
+    : buffer{buffer},
+      flags{flags},
+      syntax{options.syntax},
+      node_storage{std::move(node_storage)},
+      chunk_size{std::max(options.chunk_size, size_t{1})},
+      ordered{options.ordered} {
+
+    this->start_workers(options.num_threads);
+}
+
+void ParallelChunkParser::start_workers(size_t num_threads) {
+    if (num_threads == 0) {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    // enough chunks so that no worker has to wait while the consumer processes a chunk
+    this->max_in_flight = 2 * num_threads;
+    this->running_workers = num_threads;
+
+    this->workers.reserve(num_threads);
+    try {
+        for (size_t ix = 0; ix < num_threads; ++ix) {
+            this->workers.emplace_back(&ParallelChunkParser::work, this);
+        }
+    } catch (...) {
+        // the destructor does not run if the constructor throws, the already started workers must not outlive this
+        this->stop_workers();
+        throw;
+    }
+}
+
+void ParallelChunkParser::stop_workers() noexcept {
+    {
+        std::lock_guard lock{this->results_mutex};
+        this->stop = true;
+    }
+    this->space_cv.notify_all();
+
+    for (auto &worker : this->workers) {
+        worker.join();
+    }
+    this->workers.clear();
+}
+
+ParallelChunkParser::~ParallelChunkParser() noexcept {
+    this->stop_workers();
+}
+
+std::optional<ParallelChunkParser::Chunk> ParallelChunkParser::read_chunk() {
+    std::lock_guard lock{this->input_mutex};
+
+    auto chunk = this->input != nullptr ? this->read_stream_chunk() : this->slice_buffer_chunk();
+    if (chunk.has_value()) {
+        chunk->seq = this->next_seq++;
+        chunk->first_line = this->next_line;
+        this->next_line += std::count(chunk->data.begin(), chunk->data.end(), '\n');
+    }
+
+    return chunk;
+}
+
+std::optional<ParallelChunkParser::Chunk> ParallelChunkParser::read_stream_chunk() {
+    if (this->input_exhausted) {
+        return std::nullopt;
+    }
+
+    std::string data = std::move(this->carry);
+    this->carry.clear();
+
+    // read until there is at least one complete line, lines may be longer than chunk_size.
+    // carry never contains a newline, so any newline that is found was just read
+    while (true) {
+        auto const old_size = data.size();
+        data.resize(old_size + this->chunk_size);
+        this->input->read(data.data() + old_size, static_cast<std::streamsize>(this->chunk_size));
+        data.resize(old_size + static_cast<size_t>(this->input->gcount()));
+
+        if (data.size() < old_size + this->chunk_size) {
+            // the last chunk does not need to end on a line boundary
+            this->input_exhausted = true;
+            break;
+        }
+
+        if (auto const last_newline = data.find_last_of('\n'); last_newline != std::string::npos) {
+            this->carry.assign(data, last_newline + 1);
+            data.resize(last_newline + 1);
+            break;
+        }
+    }
+
+    if (data.empty()) {
+        return std::nullopt;
+    }
+
+    Chunk chunk{.seq = 0, .first_line = 0, .owned_data = std::move(data), .data = {}};
+    chunk.data = chunk.owned_data;
+    return chunk;
+}
+
+std::optional<ParallelChunkParser::Chunk> ParallelChunkParser::slice_buffer_chunk() noexcept {
+    if (this->buffer_pos >= this->buffer.size()) {
+        return std::nullopt;
+    }
+
+    auto end = std::min(this->buffer_pos + this->chunk_size, this->buffer.size());
+    if (end < this->buffer.size()) {
+        // extend to the end of the current line
+        auto const newline = this->buffer.find('\n', end - 1);
+        end = newline == std::string_view::npos ? this->buffer.size() : newline + 1;
+    }
+
+    Chunk chunk{.seq = 0, .first_line = 0, .owned_data = {}, .data = this->buffer.substr(this->buffer_pos, end - this->buffer_pos)};
+    this->buffer_pos = end;
+    return chunk;
+}
+
+std::vector<ParallelChunkParser::value_type> ParallelChunkParser::parse_chunk(Chunk const &chunk) const {
+    std::vector<value_type> values;
+    for (IStreamQuadIterator qit{chunk.data, this->flags, IStreamQuadIterator::prefix_storage_type{}, this->node_storage, this->syntax}; qit != IStreamQuadIterator{}; ++qit) {
+        if (qit->has_value()) {
+            values.push_back(*qit);
+        } else {
+            auto error = qit->error();
+            error.line += chunk.first_line - 1;
+            values.push_back(nonstd::make_unexpected(std::move(error)));
+        }
+    }
+
+    return values;
+}
+
+void ParallelChunkParser::work() noexcept {
+    try {
+        while (true) {
+            {
+                std::unique_lock lock{this->results_mutex};
+                this->space_cv.wait(lock, [this]() noexcept {
+                    return this->stop || this->in_flight < this->max_in_flight;
+                });
+
+                if (this->stop) {
+                    break;
+                }
+
+                ++this->in_flight;
+            }
+
+            auto chunk = this->read_chunk();
+            if (!chunk.has_value()) {
+                std::lock_guard lock{this->results_mutex};
+                --this->in_flight;
+                break;
+            }
+
+            auto values = this->parse_chunk(*chunk);
+
+            {
+                std::lock_guard lock{this->results_mutex};
+                this->results.emplace(chunk->seq, std::move(values));
+            }
+            this->results_cv.notify_all();
+        }
+    } catch (...) {
+        // exceptions must not escape the thread, hand the first one to the consumer and stop the other workers
+        {
+            std::lock_guard lock{this->results_mutex};
+            if (this->worker_error == nullptr) {
+                this->worker_error = std::current_exception();
+            }
+            this->stop = true;
+        }
+        this->space_cv.notify_all();
+    }
+
+    {
+        std::lock_guard lock{this->results_mutex};
+        --this->running_workers;
+    }
+    this->results_cv.notify_all();
+}
+
+ParallelChunkParser::value_type const *ParallelChunkParser::next() {
+    while (this->current_pos >= this->current.size()) {
+        std::unique_lock lock{this->results_mutex};
+
+        auto it = this->results.end();
+        this->results_cv.wait(lock, [this, &it]() noexcept {
+            it = this->ordered ? this->results.find(this->next_result_seq) : this->results.begin();
+            return it != this->results.end() || this->running_workers == 0 || this->worker_error != nullptr;
+        });
+
+        if (this->worker_error != nullptr) {
+            std::rethrow_exception(std::exchange(this->worker_error, nullptr));
+        }
+
+        if (it == this->results.end()) {
+            // all workers are done and every result was consumed
+            return nullptr;
+        }
+
+        this->current = std::move(it->second);
+        this->current_pos = 0;
+        this->results.erase(it);
+        ++this->next_result_seq;
+        --this->in_flight;
+
+        lock.unlock();
+        this->space_cv.notify_one();
+    }
+
+    return &this->current[this->current_pos++];
+}
+
+}  // namespace rdf4cpp::rdf::parser
@@ -0,0 +1,120 @@
+#ifndef RDF4CPP_PARSER_PRIVATE_PARALLELCHUNKPARSER_HPP
+#define RDF4CPP_PARSER_PRIVATE_PARALLELCHUNKPARSER_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <istream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <rdf4cpp/rdf/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/rdf/parser/ParallelParsingOptions.hpp>
+
+namespace rdf4cpp::rdf::parser {
+
+/**
+ * Parses a line-based input (N-Triples or N-Quads) on a pool of threads.
+ *
+ * The input (a stream or an in-memory buffer) is read sequentially and split into chunks at line boundaries. Every worker thread
+ * takes the next chunk, parses it with its own IStreamQuadIterator against the shared NodeStorage and hands in the results.
+ * The number of chunks that are read but not yet consumed is bounded, so memory usage does not depend on the size of the input.
+ *
+ * Line numbers of ParsingErrors refer to the whole input, not to the chunk.
+ * If a worker throws (e.g. std::bad_alloc or an exception of the input stream), all workers stop and the exception is rethrown by next().
+ */
+struct ParallelChunkParser {
+    using value_type = IStreamQuadIterator::value_type;
+
+private:
+    struct Chunk {
+        size_t seq;
+        uint64_t first_line;
+        std::string owned_data;  ///< only used if the input is read from a stream
+        std::string_view data;
+    };
+
+    std::unique_ptr<std::istream> input;  ///< nullptr if buffer is the input
+    std::string_view buffer;
+    ParsingFlags flags;
+    ParsingSyntax syntax;
+    storage::node::NodeStorage node_storage;
+    size_t chunk_size;
+    bool ordered;
+
+    // guarded by input_mutex
+    std::mutex input_mutex;
+    std::string carry;  ///< start of the next chunk, i.e. the incomplete last line of the previous chunk
+    size_t buffer_pos = 0;
+    size_t next_seq = 0;
+    uint64_t next_line = 1;
+    bool input_exhausted = false;
+
+    // guarded by results_mutex
+    std::mutex results_mutex;
+    std::condition_variable results_cv;  ///< notified when a result is added or a worker exits
+    std::condition_variable space_cv;    ///< notified when a result is consumed or on stop
+    std::map<size_t, std::vector<value_type>> results;
+    size_t next_result_seq = 0;  ///< next sequence number to yield if ordered
+    size_t in_flight = 0;        ///< chunks that were started but not yet consumed
+    size_t max_in_flight;
+    size_t running_workers;
+    bool stop = false;
+    std::exception_ptr worker_error;  ///< first exception thrown by a worker, rethrown by next()
+
+    // owned by the consumer
+    std::vector<value_type> current;
+    size_t current_pos = 0;
+
+    std::vector<std::thread> workers;
+
+    [[nodiscard]] std::optional<Chunk> read_chunk();
+    [[nodiscard]] std::optional<Chunk> read_stream_chunk();
+    [[nodiscard]] std::optional<Chunk> slice_buffer_chunk() noexcept;
+    [[nodiscard]] std::vector<value_type> parse_chunk(Chunk const &chunk) const;
+    void work() noexcept;
+    void start_workers(size_t num_threads);
+    void stop_workers() noexcept;
+
+public:
+    /**
+     * Starts parsing input.
+     * @param input input to parse, must contain N-Triples or N-Quads
+     * @param options see ParallelParsingOptions
+     * @param flags flags for every chunk parser
+     * @param node_storage NodeStorage shared by all chunk parsers, must be thread-safe
+     */
+    ParallelChunkParser(std::unique_ptr<std::istream> input, ParallelParsingOptions const &options, ParsingFlags flags, storage::node::NodeStorage node_storage);
+
+    /**
+     * Starts parsing an in-memory buffer, e.g. a memory mapped file. Chunks are views into buffer, nothing is copied.
+     * @param buffer input to parse, must contain N-Triples or N-Quads and outlive this
+     * @see ParallelChunkParser(std::unique_ptr<std::istream>, ParallelParsingOptions const &, ParsingFlags, storage::node::NodeStorage)
+     */
+    ParallelChunkParser(std::string_view buffer, ParallelParsingOptions const &options, ParsingFlags flags, storage::node::NodeStorage node_storage);
+
+    ParallelChunkParser(ParallelChunkParser const &) = delete;
+    ParallelChunkParser &operator=(ParallelChunkParser const &) = delete;
+
+    /**
+     * Stops and joins all workers
+     */
+    ~ParallelChunkParser() noexcept;
+
+    /**
+     * Blocks until the next parsed value is available.
+     * @return pointer to the next value, valid until the next call to next(), or nullptr if all values were yielded
+     * @throws the first exception thrown by a worker, once. Parsing stops in that case, later calls only yield values that were already parsed.
+     */
+    [[nodiscard]] value_type const *next();
+};
+
+}  // namespace rdf4cpp::rdf::parser
+
+#endif  //RDF4CPP_PARSER_PRIVATE_PARALLELCHUNKPARSER_HPP
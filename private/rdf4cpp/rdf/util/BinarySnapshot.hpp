@@ -0,0 +1,218 @@
+#ifndef RDF4CPP_PRIVATE_UTIL_BINARYSNAPSHOT_HPP
+#define RDF4CPP_PRIVATE_UTIL_BINARYSNAPSHOT_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Layout of the binary Dataset snapshots written by writer::BinarySnapshotWriter and read by parser::read_binary_snapshot.
+ * Fixed size integers are stored in native byte order, variable size integers as LEB128 varints.
+ *
+ * Every node in the snapshot has a local id, the ids are assigned section by section: first all IRIs, then all blank nodes, then all Literals.
+ *
+ * - Header
+ * - IRI section: Header::iri_count IRIs sorted lexicographically and front coded, i.e. each one is stored as
+ *      varint length of the prefix shared with the previous IRI, varint length of the remaining suffix, suffix bytes
+ * - blank node section: Header::bnode_count identifiers, front coded like the IRIs
+ * - Literal section: Header::literal_count Literals, each stored as
+ *      LiteralKind (1 byte), varint local id of the datatype IRI, varint length + bytes of the lexical form, varint length + bytes of the language tag
+ * - quad section: Header::quad_count quads, each stored as 4 local ids (graph, subject, predicate, object) of Header::id_width bits,
+ *      bit-packed into word_count_for(4 * quad_count * id_width) uint64_t words (least significant bits first)
+ */
+namespace rdf4cpp::rdf::util::binary_snapshot {
+
+static constexpr std::array<char, 8> magic{'R', 'D', 'F', '4', 'C', 'P', 'P', 'S'};
+static constexpr uint64_t version = 1;
+
+struct Header {
+    std::array<char, 8> magic;
+    uint64_t version;
+    uint64_t iri_count;
+    uint64_t bnode_count;
+    uint64_t literal_count;
+    uint64_t quad_count;
+    uint64_t id_width;  ///< number of bits per local id in the quad section
+};
+
+enum struct LiteralKind : uint8_t {
+    Lexical = 0,  ///< the lexical form is stored as-is in the NodeStorage, can be interned directly
+    Typed = 1,    ///< inlined or stored by value, needs to go through the datatype registry
+};
+
+/**
+ * @return number of bits needed to represent all local ids if there are node_count nodes
+ */
+constexpr uint64_t id_width_for(uint64_t const node_count) noexcept {
+    return node_count <= 1 ? 1 : std::bit_width(node_count - 1);
+}
+
+/**
+ * Packs integers of a fixed bit width into uint64_t words
+ */
+struct BitPacker {
+    uint64_t width;
+    std::vector<uint64_t> words;
+    uint64_t bit_pos = 0;
+
+    void push(uint64_t const value) {
+        auto const word = bit_pos / 64;
+        auto const shift = bit_pos % 64;
+
+        if (word >= words.size()) {
+            words.push_back(0);
+        }
+        words[word] |= value << shift;
+
+        if (shift + width > 64) {
+            // value is split between two words
+            words.push_back(value >> (64 - shift));
+        }
+
+        bit_pos += width;
+    }
+};
+
+/**
+ * @return the integer of the given width starting at bit_pos in words
+ * @warning words must contain at least bit_pos + width bits
+ */
+inline uint64_t unpack(uint64_t const *words, uint64_t const bit_pos, uint64_t const width) noexcept {
+    auto const word = bit_pos / 64;
+    auto const shift = bit_pos % 64;
+    auto const mask = width == 64 ? ~uint64_t{0} : (uint64_t{1} << width) - 1;
+
+    auto value = words[word] >> shift;
+    if (shift + width > 64) {
+        value |= words[word + 1] << (64 - shift);
+    }
+    return value & mask;
+}
+
+/**
+ * @return number of uint64_t words needed to store bit_count bits
+ */
+constexpr uint64_t word_count_for(uint64_t const bit_count) noexcept {
+    return (bit_count + 63) / 64;
+}
+
+/**
+ * Appends the encoded snapshot parts to a buffer
+ */
+struct Encoder {
+    std::string &out;
+
+    template<typename T>
+    void write_fixed(T const &value) {
+        out.append(reinterpret_cast<char const *>(&value), sizeof(value));
+    }
+
+    void write_varint(uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void write_string(std::string_view const str) {
+        write_varint(str.size());
+        out.append(str);
+    }
+
+    /**
+     * Writes str front coded relative to prev
+     */
+    void write_front_coded(std::string_view const prev, std::string_view const str) {
+        auto const max_shared = std::min(prev.size(), str.size());
+
+        size_t shared = 0;
+        while (shared < max_shared && prev[shared] == str[shared]) {
+            ++shared;
+        }
+
+        write_varint(shared);
+        write_string(str.substr(shared));
+    }
+};
+
+/**
+ * Reads the encoded snapshot parts from a buffer
+ * @throws std::runtime_error on any read past the end of the buffer
+ */
+struct Decoder {
+    std::string_view in;
+    size_t pos = 0;
+
+    [[noreturn]] static void truncated() {
+        throw std::runtime_error{"binary snapshot is truncated or corrupted"};
+    }
+
+    template<typename T>
+    T read_fixed() {
+        if (in.size() - pos < sizeof(T)) {
+            truncated();
+        }
+
+        T value;
+        std::memcpy(&value, in.data() + pos, sizeof(T));
+        pos += sizeof(T);
+        return value;
+    }
+
+    uint64_t read_varint() {
+        uint64_t value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7) {
+            if (pos >= in.size()) {
+                truncated();
+            }
+
+            auto const byte = static_cast<uint8_t>(in[pos++]);
+            value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+            if ((byte & 0x80) == 0) {
+                return value;
+            }
+        }
+
+        truncated();
+    }
+
+    std::string_view read_string() {
+        auto const size = read_varint();
+        if (in.size() - pos < size) {
+            truncated();
+        }
+
+        auto const str = in.substr(pos, size);
+        pos += size;
+        return str;
+    }
+
+    /**
+     * Reads a string written by Encoder::write_front_coded and appends it to out
+     * @param prev_offset offset of the previous string in out
+     * @param prev_size size of the previous string
+     */
+    void read_front_coded(std::string &out, size_t const prev_offset, size_t const prev_size) {
+        auto const shared = read_varint();
+        if (shared > prev_size) {
+            truncated();
+        }
+
+        auto const suffix = read_string();
+        out.reserve(out.size() + shared + suffix.size());  // the shared prefix is copied from out itself
+        out.append(out.data() + prev_offset, shared);
+        out.append(suffix);
+    }
+};
+
+}  // namespace rdf4cpp::rdf::util::binary_snapshot
+
+#endif  //RDF4CPP_PRIVATE_UTIL_BINARYSNAPSHOT_HPP
@@ -1,6 +1,220 @@
+#ifndef RDF4CPP_PRIVATE_UTIL_UTF8_HPP
+#define RDF4CPP_PRIVATE_UTIL_UTF8_HPP
+
 // Work around different directory structure for utfcpp when using conan vs fetch content
 #if __has_include(<utf8.h>)
 #include <utf8.h>
 #else
 #include <utfcpp/utf8.h>
 #endif
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * UTF-8 kernels for the string functions of Literal.
+ * The input is processed in blocks of detail::block_size bytes: blocks that only contain ASCII are skipped with a single
+ * vector comparison (AVX2 or SSE2 depending on the target, 8 byte SWAR otherwise), only blocks that contain multibyte
+ * sequences are decoded byte by byte.
+ */
+namespace rdf4cpp::rdf::util::utf8_simd {
+
+namespace detail {
+
+#if defined(__AVX2__)
+inline constexpr size_t block_size = 32;
+
+inline bool block_is_ascii(char const *block) noexcept {
+    auto const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block));
+    return _mm256_movemask_epi8(v) == 0;
+}
+
+inline size_t block_continuation_count(char const *block) noexcept {
+    // continuation bytes (0x80 - 0xBF) are exactly the bytes that are less than 0xC0 as signed chars
+    auto const v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(block));
+    auto const is_continuation = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0xC0)), v);
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(is_continuation))));
+}
+#elif defined(__SSE2__)
+inline constexpr size_t block_size = 16;
+
+inline bool block_is_ascii(char const *block) noexcept {
+    auto const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(block));
+    return _mm_movemask_epi8(v) == 0;
+}
+
+inline size_t block_continuation_count(char const *block) noexcept {
+    // continuation bytes (0x80 - 0xBF) are exactly the bytes that are less than 0xC0 as signed chars
+    auto const v = _mm_loadu_si128(reinterpret_cast<__m128i const *>(block));
+    auto const is_continuation = _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(0xC0)));
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(is_continuation))));
+}
+#else
+inline constexpr size_t block_size = sizeof(uint64_t);
+inline constexpr uint64_t high_bits = 0x8080808080808080;
+
+inline uint64_t load_block(char const *block) noexcept {
+    uint64_t word;
+    std::memcpy(&word, block, sizeof(word));
+    return word;
+}
+
+inline bool block_is_ascii(char const *block) noexcept {
+    return (load_block(block) & high_bits) == 0;
+}
+
+inline size_t block_continuation_count(char const *block) noexcept {
+    // continuation bytes have the bit pattern 10xxxxxx, shifting by one moves bit 6 of each byte onto bit 7
+    auto const word = load_block(block);
+    return static_cast<size_t>(std::popcount(word & ~(word << 1) & high_bits));
+}
+#endif
+
+constexpr bool is_continuation(char const ch) noexcept {
+    return (static_cast<unsigned char>(ch) & 0xC0) == 0x80;
+}
+
+/**
+ * @return the length of the UTF-8 sequence starting at s[ix] or 0 if it is not a valid sequence
+ * @see https://datatracker.ietf.org/doc/html/rfc3629#section-4
+ */
+constexpr size_t sequence_length(std::string_view const s, size_t const ix) noexcept {
+    auto const byte = [&](size_t const off) noexcept -> unsigned {
+        return ix + off < s.size() ? static_cast<unsigned char>(s[ix + off]) : 0;
+    };
+    auto const in_range = [](unsigned const b, unsigned const lo, unsigned const hi) noexcept {
+        return b >= lo && b <= hi;
+    };
+
+    auto const lead = byte(0);
+    if (lead < 0x80) {
+        return 1;
+    }
+
+    if (in_range(lead, 0xC2, 0xDF)) {
+        return in_range(byte(1), 0x80, 0xBF) ? 2 : 0;
+    }
+
+    if (in_range(lead, 0xE0, 0xEF)) {
+        auto const lo = lead == 0xE0 ? 0xA0u : 0x80u; // no overlong encodings
+        auto const hi = lead == 0xED ? 0x9Fu : 0xBFu; // no surrogates
+        return in_range(byte(1), lo, hi) && in_range(byte(2), 0x80, 0xBF) ? 3 : 0;
+    }
+
+    if (in_range(lead, 0xF0, 0xF4)) {
+        auto const lo = lead == 0xF0 ? 0x90u : 0x80u; // no overlong encodings
+        auto const hi = lead == 0xF4 ? 0x8Fu : 0xBFu; // nothing above U+10FFFF
+        return in_range(byte(1), lo, hi) && in_range(byte(2), 0x80, 0xBF) && in_range(byte(3), 0x80, 0xBF) ? 4 : 0;
+    }
+
+    return 0;
+}
+
+} // namespace detail
+
+/**
+ * @return true if s only consists of ASCII characters
+ */
+inline bool is_ascii(std::string_view const s) noexcept {
+    size_t ix = 0;
+    for (; ix + detail::block_size <= s.size(); ix += detail::block_size) {
+        if (!detail::block_is_ascii(s.data() + ix)) {
+            return false;
+        }
+    }
+
+    for (; ix < s.size(); ++ix) {
+        if (static_cast<unsigned char>(s[ix]) >= 0x80) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @return true if s is valid UTF-8
+ */
+inline bool is_valid(std::string_view const s) noexcept {
+    size_t ix = 0;
+    while (ix < s.size()) {
+        auto const block_end = ix + detail::block_size;
+
+        if (block_end <= s.size() && detail::block_is_ascii(s.data() + ix)) [[likely]] {
+            ix = block_end;
+            continue;
+        }
+
+        // decode until the end of the block (or s), the next block might be ASCII again
+        do {
+            auto const len = detail::sequence_length(s, ix);
+            if (len == 0) {
+                return false;
+            }
+            ix += len;
+        } while (ix < block_end && ix < s.size());
+    }
+
+    return true;
+}
+
+/**
+ * @return the number of code points in s or std::nullopt if s is not valid UTF-8
+ */
+inline std::optional<size_t> code_point_count(std::string_view const s) noexcept {
+    if (!is_valid(s)) {
+        return std::nullopt;
+    }
+
+    // in valid UTF-8 every code point has exactly one non-continuation byte
+    size_t continuation_bytes = 0;
+    size_t ix = 0;
+    for (; ix + detail::block_size <= s.size(); ix += detail::block_size) {
+        continuation_bytes += detail::block_continuation_count(s.data() + ix);
+    }
+
+    for (; ix < s.size(); ++ix) {
+        continuation_bytes += static_cast<size_t>(detail::is_continuation(s[ix]));
+    }
+
+    return s.size() - continuation_bytes;
+}
+
+/**
+ * @param s UTF-8 encoded string
+ * @param n index of a code point in s
+ * @return the byte offset of the n-th code point of s or s.size() if s has at most n code points
+ */
+inline size_t code_point_offset(std::string_view const s, size_t n) noexcept {
+    size_t ix = 0;
+    for (; ix + detail::block_size <= s.size(); ix += detail::block_size) {
+        auto const code_points_in_block = detail::block_size - detail::block_continuation_count(s.data() + ix);
+        if (code_points_in_block > n) {
+            break; // n-th code point starts in this block
+        }
+        n -= code_points_in_block;
+    }
+
+    for (; ix < s.size(); ++ix) {
+        if (!detail::is_continuation(s[ix])) {
+            if (n == 0) {
+                return ix;
+            }
+            --n;
+        }
+    }
+
+    return s.size();
+}
+
+} // namespace rdf4cpp::rdf::util::utf8_simd
+
+#endif  //RDF4CPP_PRIVATE_UTIL_UTF8_HPP
@@ -3,11 +3,16 @@
 
 #include <rdf4cpp/rdf/ClosedNamespace.hpp>
 #include <rdf4cpp/rdf/Dataset.hpp>
+#include <rdf4cpp/rdf/LiteralBatch.hpp>
 #include <rdf4cpp/rdf/Namespace.hpp>
 #include <rdf4cpp/rdf/Node.hpp>
 #include <rdf4cpp/rdf/namespaces.hpp>
+#include <rdf4cpp/rdf/parser/BinarySnapshotReader.hpp>
 #include <rdf4cpp/rdf/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/rdf/query/BasicGraphPattern.hpp>
 #include <rdf4cpp/rdf/version.hpp>
+#include <rdf4cpp/rdf/writer/BinarySnapshotWriter.hpp>
+#include <rdf4cpp/rdf/writer/BufferedWriter.hpp>
 #include <rdf4cpp/rdf/writer/NNodeWriter.hpp>
 #include <rdf4cpp/rdf/writer/NQuadsWriter.hpp>
 #include <rdf4cpp/rdf/writer/NTriplesWriter.hpp>
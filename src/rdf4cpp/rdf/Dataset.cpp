@@ -1,7 +1,10 @@
 #include "Dataset.hpp"
 
 #include <rdf4cpp/rdf/Graph.hpp>
+
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace rdf4cpp::rdf {
 Dataset::Dataset(Dataset::DatasetStorage dataset_storage) : dataset_storage(std::move(dataset_storage)) {}
@@ -12,6 +15,29 @@ Dataset::Dataset(Dataset::NodeStorage node_storage)
 void Dataset::add(const Quad &quad) {
     dataset_storage.add(quad.to_node_storage(backend().node_storage()));
 }
+void Dataset::add_bulk(std::span<Quad const> quads) {
+    auto const storage_id = backend().node_storage().id();
+    auto const in_storage = std::all_of(quads.begin(), quads.end(), [storage_id](Quad const &quad) {
+        return std::all_of(quad.begin(), quad.end(), [storage_id](Node const &node) {
+            return node.backend_handle().node_storage_id() == storage_id;
+        });
+    });
+
+    if (in_storage) {
+        dataset_storage.add_bulk(quads);
+        return;
+    }
+
+    std::vector<Quad> converted;
+    converted.reserve(quads.size());
+    for (auto const &quad : quads) {
+        converted.push_back(quad.to_node_storage(backend().node_storage()));
+    }
+    dataset_storage.add_bulk(converted);
+}
+size_t Dataset::load_from(parser::IStreamQuadIterator &quad_iterator) {
+    return dataset_storage.load_from(quad_iterator);
+}
 bool Dataset::contains(const Quad &quad) const {
     return dataset_storage.contains(quad.to_node_storage(backend().node_storage()));
 }
@@ -24,6 +50,9 @@ size_t Dataset::size() const {
 size_t Dataset::size(const IRI &graph_name) const {
     return dataset_storage.size(static_cast<IRI>(graph_name.to_node_storage(backend().node_storage())));
 }
+size_t Dataset::estimate_cardinality(const query::QuadPattern &quad_pattern) const {
+    return dataset_storage.estimate_cardinality(quad_pattern.to_node_storage(backend().node_storage()));
+}
 Graph Dataset::graph(const IRI &graph_name) {
     return {dataset_storage, graph_name};
 }
@@ -7,6 +7,7 @@
 #include <rdf4cpp/rdf/storage/tuple/DefaultDatasetBackend.hpp>
 
 #include <memory>
+#include <span>
 #include <utility>
 
 
@@ -26,13 +27,28 @@ class Dataset {
 public:
     template<typename BackendImpl, typename... Args>
     static inline Dataset new_instance(Args... args) {
-        return {DatasetStorage::new_instance<BackendImpl>(args...)};
+        return Dataset{DatasetStorage::new_instance<BackendImpl>(args...)};
     }
 
     explicit Dataset(NodeStorage node_storage = NodeStorage::default_instance());
 
     void add(const Quad &quad);
 
+    /**
+     * Adds all quads at once, which is considerably faster than adding them one by one for some backends.
+     * @param quads quads to be added, they are moved into the NodeStorage of this Dataset if necessary
+     * @throws std::logic_error if a Quad is not valid
+     */
+    void add_bulk(std::span<Quad const> quads);
+
+    /**
+     * Adds all remaining quads of quad_iterator at once, skipping ParsingErrors.
+     * @param quad_iterator source of quads, is at the end afterwards
+     * @return number of ParsingErrors that were skipped
+     * @throws std::logic_error if a Quad is not valid
+     */
+    size_t load_from(parser::IStreamQuadIterator &quad_iterator);
+
     [[nodiscard]] bool contains(const Quad &quad) const;
 
     [[nodiscard]] query::SolutionSequence match(const query::QuadPattern &quad_pattern) const;
@@ -41,6 +57,12 @@ public:
 
     [[nodiscard]] size_t size(const IRI &graph_name) const;
 
+    /**
+     * Estimates the number of solutions of quad_pattern without evaluating it.
+     * @see IDatasetBackend::estimate_cardinality
+     */
+    [[nodiscard]] size_t estimate_cardinality(const query::QuadPattern &quad_pattern) const;
+
     Graph graph(const IRI &graph_name);
 
     Graph graph();
@@ -10,6 +10,7 @@
 #include <uni_algo/case.h>
 
 #include <rdf4cpp/rdf/IRI.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/InlinedNumericOps.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/FallbackLiteralBackend.hpp>
 #include <rdf4cpp/rdf/util/CaseInsensitiveCharTraits.hpp>
 #include <rdf4cpp/rdf/util/Utf8.hpp>
@@ -18,6 +19,33 @@
 
 namespace rdf4cpp::rdf {
 
+/**
+ * Looks up the result of deriving a Literal from input in the DerivedLiteralCache of node_storage.
+ * If it is not cached the result is computed by calling derive and then cached.
+ *
+ * The cache is bypassed if it is not enabled or if input does not belong to node_storage, since
+ * the cache would otherwise refer to nodes of another NodeStorage which might be destroyed at any time.
+ */
+template<typename Derive>
+static Literal cached_derivation(Literal const &input, storage::node::DerivedLiteralCache::Operation const op, uint64_t const arg,
+                                 storage::node::NodeStorage &node_storage, Derive derive) {
+    auto *cache = node_storage.derived_literal_cache();
+    if (cache == nullptr || input.null() || input.backend_handle().node_storage_id() != node_storage.id()) {
+        return derive();
+    }
+
+    storage::node::DerivedLiteralCache::Key const key{.input = input.backend_handle(), .op = op, .arg = arg};
+    if (auto const cached = cache->lookup(key); cached.has_value()) {
+        Literal res;
+        res.backend_handle() = *cached;
+        return res;
+    }
+
+    auto res = derive();
+    cache->insert(key, res.backend_handle());
+    return res;
+}
+
 Literal::Literal(Node::NodeBackendHandle handle) noexcept
     : Node{handle} {}
 
@@ -46,7 +74,7 @@ Literal Literal::make_noninlined_typed_unchecked(std::string_view lexical_form,
                                      node_storage.id()}};
 }
 
-Literal Literal::make_noninlined_special_unchecked(std::any &&value, storage::node::identifier::LiteralType fixed_id, Node::NodeStorage &node_storage) noexcept {
+Literal Literal::make_noninlined_special_unchecked(datatypes::registry::AnyValue &&value, storage::node::identifier::LiteralType fixed_id, Node::NodeStorage &node_storage) noexcept {
     return Literal{NodeBackendHandle{node_storage.find_or_make_id(storage::node::view::ValueLiteralBackendView{
                                              .datatype = fixed_id,
                                              .value = std::move(value)}),
@@ -74,7 +102,7 @@ Literal Literal::make_inlined_typed_unchecked(uint64_t inlined_value, storage::n
                                      true}};
 }
 
-Literal Literal::make_typed_unchecked(std::any &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, Node::NodeStorage &node_storage) noexcept {
+Literal Literal::make_typed_unchecked(datatypes::registry::AnyValue &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, Node::NodeStorage &node_storage) noexcept {
     if (entry.inlining_ops.has_value()) {
         if (auto const maybe_inlined = entry.inlining_ops->try_into_inlined_fptr(value); maybe_inlined.has_value()) {
             return Literal::make_inlined_typed_unchecked(*maybe_inlined, datatype.get_fixed(), node_storage);
@@ -129,6 +157,28 @@ Literal Literal::make_typed(std::string_view lexical_form, IRI const &datatype,
         throw std::invalid_argument{"cannot construct rdf:langString without a language tag, please call one of the other factory functions"};
     }
 
+    if (auto lit = Literal::try_make_typed(lexical_form, datatype, node_storage); lit.has_value()) [[likely]] {
+        return std::move(*lit);
+    }
+
+    // invalid lexical form, let the datatype report its specific parsing error
+    auto const *entry = DatatypeRegistry::get_entry(datatype_identifier);
+    assert(entry != nullptr);
+    (void) entry->factory_fptr(lexical_form);
+
+    throw std::runtime_error{"XSD Parsing Error"};
+}
+
+nonstd::expected<Literal, datatypes::DynamicError> Literal::try_make_typed(std::string_view lexical_form, IRI const &datatype, Node::NodeStorage &node_storage) noexcept {
+    using namespace datatypes::registry;
+
+    DatatypeIDView const datatype_identifier{datatype};
+
+    if (datatype_identifier == datatypes::rdf::LangString::datatype_id) {
+        // see: https://www.w3.org/TR/rdf11-concepts/#section-Graph-Literal
+        return nonstd::make_unexpected(datatypes::DynamicError::InvalidValueForCast);
+    }
+
     if (datatype_identifier == datatypes::xsd::String::datatype_id) {
         return Literal::make_simple_unchecked(lexical_form, node_storage);
     }
@@ -136,8 +186,12 @@ Literal Literal::make_typed(std::string_view lexical_form, IRI const &datatype,
     if (auto const *entry = DatatypeRegistry::get_entry(datatype_identifier); entry != nullptr) {
         // exists => canonize
 
-        auto cpp_value = entry->factory_fptr(lexical_form);
-        return Literal::make_typed_unchecked(std::move(cpp_value), datatype_identifier, *entry, node_storage);
+        auto cpp_value = entry->try_factory_fptr(lexical_form);
+        if (!cpp_value.has_value()) {
+            return nonstd::make_unexpected(cpp_value.error());
+        }
+
+        return Literal::make_typed_unchecked(std::move(*cpp_value), datatype_identifier, *entry, node_storage);
     } else {
         // doesn't exist in the registry no way to canonicalize
         return Literal::make_noninlined_typed_unchecked(lexical_form, datatype, node_storage);
@@ -174,6 +228,11 @@ Literal Literal::to_node_storage(Node::NodeStorage &node_storage) const noexcept
         return *this;
     }
 
+    if (this->is_inlined()) {
+        // the value is contained in the handle, nothing needs to be sent over
+        return Literal::make_inlined_typed_unchecked(handle_.node_id().literal_id().value, handle_.node_id().literal_type(), node_storage);
+    }
+
     auto literal_view = handle_.literal_backend();
     auto const node_id = literal_view.visit(
             [&](storage::node::view::LexicalFormLiteralBackendView &lexical) noexcept {
@@ -278,7 +337,9 @@ Literal Literal::as_lexical_form(NodeStorage &node_storage) const noexcept {
         return Literal{};
     }
 
-    return Literal::make_simple_unchecked(this->lexical_form(), node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::LexicalForm, 0, node_storage, [&]() noexcept {
+        return Literal::make_simple_unchecked(this->lexical_form(), node_storage);
+    });
 }
 
 util::CowString Literal::simplified_lexical_form() const noexcept {
@@ -362,59 +423,63 @@ Literal Literal::as_language_tag_eq(Literal const &other, Node::NodeStorage &nod
 
 Literal::operator std::string() const noexcept {
     // TODO: escape non-standard chars correctly
-    auto const quoted_lexical_into_stream = [](std::ostream &out, std::string_view const lexical) noexcept {
+    auto const quoted_lexical_into_string = [](std::string &out, std::string_view const lexical) noexcept {
         // TODO: escape everything that needs to be escaped in N-Tripels/N-Quads
 
-        out << "\"";
+        out.reserve(out.size() + lexical.size() + 2);
+        out.push_back('"');
         for (auto const character : lexical) {
             switch (character) {
                 case '\\': {
-                    out << R"(\\)";
+                    out.append(R"(\\)");
                     break;
                 }
                 case '\n': {
-                    out << R"(\n)";
+                    out.append(R"(\n)");
                     break;
                 }
                 case '\r': {
-                    out << R"(\r)";
+                    out.append(R"(\r)");
                     break;
                 }
                 case '"': {
-                    out << R"(\")";
+                    out.append(R"(\")");
                     break;
                 }
                 [[likely]] default : {
-                    out << character;
+                    out.push_back(character);
                     break;
                 }
             }
         }
-        out << "\"";
+        out.push_back('"');
     };
 
-    std::ostringstream oss;
+    std::string ret;
 
     if (this->is_inlined()) {
-        quoted_lexical_into_stream(oss, this->lexical_form());
+        quoted_lexical_into_string(ret, this->lexical_form());
 
         // rdf:langString is not inlined, therefore can only have datatype not lang tag
         auto const &dtype_iri = NodeStorage::find_iri_backend_view(storage::node::identifier::datatype_iri_handle_for_fixed_lit_handle(handle_));
 
-        oss << "^^" << dtype_iri.n_string();
+        ret.append("^^");
+        ret.append(dtype_iri.n_string());
     } else if (this->datatype_eq<datatypes::rdf::LangString>()) {
         auto const value = this->value<datatypes::rdf::LangString>();
 
-        quoted_lexical_into_stream(oss, value.lexical_form);
-        oss << '@' << value.language_tag;
+        quoted_lexical_into_string(ret, value.lexical_form);
+        ret.push_back('@');
+        ret.append(value.language_tag);
     } else {
         handle_.literal_backend().visit(
                 [&](storage::node::view::LexicalFormLiteralBackendView const &lexical) noexcept {
                     auto const &dtype_iri = NodeStorage::find_iri_backend_view(NodeBackendHandle{lexical.datatype_id,
                                                                                                  storage::node::identifier::RDFNodeType::IRI,
                                                                                                  handle_.node_storage_id()});
-                    quoted_lexical_into_stream(oss, lexical.lexical_form);
-                    oss << "^^" << dtype_iri.n_string();
+                    quoted_lexical_into_string(ret, lexical.lexical_form);
+                    ret.append("^^");
+                    ret.append(dtype_iri.n_string());
                 },
                 [&](storage::node::view::ValueLiteralBackendView const &any) noexcept {
                     auto const &dtype_iri = NodeStorage::find_iri_backend_view(
@@ -423,12 +488,13 @@ Literal::operator std::string() const noexcept {
                     auto const to_string = datatypes::registry::DatatypeRegistry::get_to_canonical_string(this->datatype_id());
                     assert(to_string != nullptr);
 
-                    quoted_lexical_into_stream(oss, to_string(any.value));
-                    oss << "^^" << dtype_iri.n_string();
+                    quoted_lexical_into_string(ret, to_string(any.value));
+                    ret.append("^^");
+                    ret.append(dtype_iri.n_string());
                 });
     }
 
-    return oss.str();
+    return ret;
 }
 bool Literal::is_literal() const noexcept { return true; }
 bool Literal::is_variable() const noexcept { return false; }
@@ -450,7 +516,7 @@ std::ostream &operator<<(std::ostream &os, const Literal &literal) {
     return os;
 }
 
-std::any Literal::value() const noexcept {
+datatypes::registry::AnyValue Literal::erased_value() const noexcept {
     using namespace datatypes;
 
     auto const datatype = this->datatype_id();
@@ -463,38 +529,57 @@ std::any Literal::value() const noexcept {
         return ops->from_inlined_fptr(inlined_value);
     }
 
-    auto const backend = handle_.literal_backend();
+    auto backend = handle_.literal_backend();
 
     if (datatype == rdf::LangString::datatype_id) {
         auto const &lex = backend.get_lexical();
 
-        return std::any{registry::LangStringRepr{
+        return registry::AnyValue{registry::LangStringRepr{
                 .lexical_form = lex.lexical_form,
                 .language_tag = lex.language_tag}};
     }
 
     if (datatype == xsd::String::datatype_id) {
         auto const &lex = backend.get_lexical();
-        return std::any{lex.lexical_form};
+        return registry::AnyValue{lex.lexical_form};
     }
 
-    return backend.visit(
+    return std::move(backend).visit(
             [&datatype](storage::node::view::LexicalFormLiteralBackendView const &lexical) noexcept {
                 if (auto const factory = registry::DatatypeRegistry::get_factory(datatype); factory != nullptr) {
                     return factory(lexical.lexical_form);
                 }
 
-                return std::any{};
+                return registry::AnyValue{};
             },
-            [&datatype](storage::node::view::ValueLiteralBackendView const &any) noexcept {
+            [&datatype](storage::node::view::ValueLiteralBackendView &&any) noexcept {
                 assert(any.datatype == datatype);
                 (void)datatype;
 
-                return any.value;
+                return std::move(any.value);
             });
 }
 
+std::any Literal::value() const noexcept {
+    return this->erased_value().into_any();
+}
+
 Literal Literal::cast(IRI const &target, Node::NodeStorage &node_storage) const noexcept {
+    if (this->null()) {
+        return Literal{};
+    }
+
+    if (target.backend_handle().node_storage_id() != node_storage.id()) {
+        // the cache key would refer to an IRI of a foreign NodeStorage
+        return this->cast_impl(target, node_storage);
+    }
+
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::Cast, target.backend_handle().raw(), node_storage, [&]() noexcept {
+        return this->cast_impl(target, node_storage);
+    });
+}
+
+Literal Literal::cast_impl(IRI const &target, Node::NodeStorage &node_storage) const noexcept {
     using namespace datatypes::registry;
     using namespace datatypes::xsd;
 
@@ -511,11 +596,7 @@ Literal Literal::cast(IRI const &target, Node::NodeStorage &node_storage) const
 
     if (this_dtid == String::datatype_id) {
         // string -> any
-        try {
-            return Literal::make_typed(this->lexical_form(), target, node_storage);
-        } catch (std::runtime_error const &) {
-            return Literal{};
-        }
+        return Literal::try_make_typed(this->lexical_form(), target, node_storage).value_or(Literal{});
     }
 
     if (target_dtid == String::datatype_id) {
@@ -570,9 +651,9 @@ Literal Literal::cast(IRI const &target, Node::NodeStorage &node_storage) const
 
     if (auto const common_conversion = DatatypeRegistry::get_common_type_conversion(this_e->conversion_table, target_e->conversion_table); common_conversion.has_value()) {
         // general cast
-        // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of std::any wrapping and unwrapping for the former 2
+        // TODO: if performance is bad split into separate cases for up-, down- and cross-casting to avoid one set of AnyValue wrapping and unwrapping for the former 2
 
-        auto const common_type_value = common_conversion->convert_lhs(this->value()); // upcast to common
+        auto const common_type_value = common_conversion->convert_lhs(this->erased_value()); // upcast to common
         auto target_value = common_conversion->inverted_convert_rhs(common_type_value); // downcast to target
         if (!target_value.has_value()) {
             // downcast failed
@@ -594,6 +675,22 @@ Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, No
         return Literal{};
     }
 
+    if (this->is_inlined() && other.is_inlined()) {
+        // fast path: both operands are inlined fixed id numerics, the operation can be carried out
+        // on the inlined values without going through the registry
+        if (auto const *inlined_ops = inlined_numeric_ops::get_numeric_binops(this->handle_.node_id().literal_type(), other.handle_.node_id().literal_type());
+            inlined_ops != nullptr) {
+
+            if (auto const inlined_op = op_select(*inlined_ops); inlined_op != nullptr) {
+                if (auto const res = inlined_op(this->handle_.node_id().literal_id().value, other.handle_.node_id().literal_id().value); res.has_value()) {
+                    return Literal::make_inlined_typed_unchecked(res->value, res->datatype, node_storage);
+                }
+
+                // operation failed or result not inlineable, retry below to get the exact same result as the general path
+            }
+        }
+    }
+
     auto const this_datatype = this->datatype_id();
     auto const *this_entry = DatatypeRegistry::get_entry(this_datatype);
     assert(this_entry != nullptr);
@@ -605,8 +702,8 @@ Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, No
     auto const other_datatype = other.datatype_id();
 
     if (this_datatype == other_datatype && this_entry->numeric_ops->is_impl()) {
-        DatatypeRegistry::NumericOpResult op_res = op_select(this_entry->numeric_ops->get_impl())(this->value(),
-                                                                                                  other.value());
+        DatatypeRegistry::NumericOpResult op_res = op_select(this_entry->numeric_ops->get_impl())(this->erased_value(),
+                                                                                                  other.erased_value());
 
         if (!op_res.result_value.has_value()) {
             return Literal{};
@@ -651,8 +748,8 @@ Literal Literal::numeric_binop_impl(OpSelect op_select, Literal const &other, No
         assert(equalized_entry->numeric_ops.has_value());
         assert(equalized_entry->numeric_ops->is_impl());
 
-        DatatypeRegistry::NumericOpResult op_res = op_select(equalized_entry->numeric_ops->get_impl())(equalizer->convert_lhs(this->value()),
-                                                                                                       equalizer->convert_rhs(other.value()));
+        DatatypeRegistry::NumericOpResult op_res = op_select(equalized_entry->numeric_ops->get_impl())(equalizer->convert_lhs(this->erased_value()),
+                                                                                                       equalizer->convert_rhs(other.erased_value()));
 
         if (!op_res.result_value.has_value()) {
             return Literal{};
@@ -693,9 +790,9 @@ Literal Literal::numeric_unop_impl(OpSelect op_select, NodeStorage &node_storage
             auto const impl_converter = DatatypeRegistry::get_numeric_op_impl_conversion(*this_entry);
             auto const target_num_ops = DatatypeRegistry::get_entry(impl_converter.target_type_id);
 
-            return std::make_pair(target_num_ops, impl_converter.convert(this->value()));
+            return std::make_pair(target_num_ops, impl_converter.convert(this->erased_value()));
         } else {
-            return std::make_pair(this_entry, this->value());
+            return std::make_pair(this_entry, this->erased_value());
         }
     }();
 
@@ -752,7 +849,7 @@ std::partial_ordering Literal::compare_impl(Literal const &other, std::strong_or
             return std::partial_ordering::unordered;
         }
 
-        return this_entry->compare_fptr(this->value(), other.value());
+        return this_entry->compare_fptr(this->erased_value(), other.erased_value());
     } else {
         if (out_alternative_ordering != nullptr) {
             // types are different, the only useful alternative ordering is the type ordering
@@ -784,8 +881,8 @@ std::partial_ordering Literal::compare_impl(Literal const &other, std::strong_or
 
         assert(equalized_compare_fptr != nullptr);
 
-        return equalized_compare_fptr(equalizer->convert_lhs(this->value()),
-                                      equalizer->convert_rhs(other.value()));
+        return equalized_compare_fptr(equalizer->convert_lhs(this->erased_value()),
+                                      equalizer->convert_rhs(other.erased_value()));
     }
 }
 
@@ -1122,7 +1219,7 @@ util::TriBool Literal::ebv() const noexcept {
         return util::TriBool::Err;
     }
 
-    return ebv(this->value());
+    return ebv(this->erased_value());
 }
 
 Literal Literal::as_ebv(NodeStorage &node_storage) const noexcept {
@@ -1159,11 +1256,7 @@ std::optional<size_t> Literal::strlen() const noexcept {
     }
 
     auto const lf = this->lexical_form();
-    try {
-        return utf8::distance(lf.begin(), lf.end());
-    } catch (utf8::exception const &) {
-        return std::nullopt;
-    }
+    return util::utf8_simd::code_point_count(lf);
 }
 
 Literal Literal::as_strlen(Node::NodeStorage &node_storage) const noexcept {
@@ -1171,12 +1264,14 @@ Literal Literal::as_strlen(Node::NodeStorage &node_storage) const noexcept {
         return Literal{};
     }
 
-    auto const len = this->strlen();
-    if (!len.has_value()) {
-        return Literal{};
-    }
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::StrLen, 0, node_storage, [&]() noexcept {
+        auto const len = this->strlen();
+        if (!len.has_value()) {
+            return Literal{};
+        }
 
-    return Literal::make_typed_from_value<datatypes::xsd::Integer>(datatypes::xsd::Integer::cpp_type{*len}, node_storage);
+        return Literal::make_typed_from_value<datatypes::xsd::Integer>(datatypes::xsd::Integer::cpp_type{*len}, node_storage);
+    });
 }
 
 util::TriBool Literal::language_tag_matches_range(std::string_view const lang_range) const noexcept {
@@ -1481,10 +1576,23 @@ Literal Literal::uppercase(Node::NodeStorage &node_storage) const noexcept {
         return Literal{};
     }
 
-    auto const s = this->lexical_form();
-    auto const upper = una::cases::to_uppercase_utf8(s.view());
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::UpperCase, 0, node_storage, [&]() noexcept {
+        auto const s = this->lexical_form();
 
-    return Literal::make_string_like_copy_lang_tag(upper, *this, node_storage);
+        if (util::utf8_simd::is_ascii(s)) {
+            // the unicode case mapping of ASCII characters is the ASCII one
+            std::string upper{s.view()};
+            std::transform(upper.begin(), upper.end(), upper.begin(), [](char const ch) noexcept {
+                return ch >= 'a' && ch <= 'z' ? static_cast<char>(ch - 'a' + 'A') : ch;
+            });
+
+            return Literal::make_string_like_copy_lang_tag(upper, *this, node_storage);
+        }
+
+        auto const upper = una::cases::to_uppercase_utf8(s.view());
+
+        return Literal::make_string_like_copy_lang_tag(upper, *this, node_storage);
+    });
 }
 
 Literal Literal::lowercase(Node::NodeStorage &node_storage) const noexcept {
@@ -1492,10 +1600,23 @@ Literal Literal::lowercase(Node::NodeStorage &node_storage) const noexcept {
         return Literal{};
     }
 
-    auto const s = this->lexical_form();
-    const auto lower = una::cases::to_lowercase_utf8(s.view());
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::LowerCase, 0, node_storage, [&]() noexcept {
+        auto const s = this->lexical_form();
+
+        if (util::utf8_simd::is_ascii(s)) {
+            // the unicode case mapping of ASCII characters is the ASCII one
+            std::string lower{s.view()};
+            std::transform(lower.begin(), lower.end(), lower.begin(), [](char const ch) noexcept {
+                return ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+            });
+
+            return Literal::make_string_like_copy_lang_tag(lower, *this, node_storage);
+        }
 
-    return Literal::make_string_like_copy_lang_tag(lower, *this, node_storage);
+        const auto lower = una::cases::to_lowercase_utf8(s.view());
+
+        return Literal::make_string_like_copy_lang_tag(lower, *this, node_storage);
+    });
 }
 
 Literal Literal::concat(Literal const &other, Node::NodeStorage &node_storage) const noexcept {
@@ -1516,44 +1637,34 @@ Literal Literal::concat(Literal const &other, Node::NodeStorage &node_storage) c
 }
 
 Literal Literal::encode_for_uri(std::string_view string, NodeStorage &node_storage) {
-    try {
-        std::stringstream stream{};
-        auto it = utf8::iterator(string.begin(), string.begin(), string.end());
-        const auto end = utf8::iterator(string.end(), string.begin(), string.end());
-        // note that ASCII is a subset of UTF-8
-        auto is_valid = [](const uint32_t cp) {
-            if (cp >= static_cast<uint32_t>(static_cast<unsigned char>('A')) && cp <= static_cast<uint32_t>(static_cast<unsigned char>('Z')))
-                return true;
-            if (cp >= static_cast<uint32_t>(static_cast<unsigned char>('a')) && cp <= static_cast<uint32_t>(static_cast<unsigned char>('z')))
-                return true;
-            if (cp >= static_cast<uint32_t>(static_cast<unsigned char>('0')) && cp <= static_cast<uint32_t>(static_cast<unsigned char>('9')))
-                return true;
-            if (cp == static_cast<uint32_t>(static_cast<unsigned char>('-')) || cp == static_cast<uint32_t>(static_cast<unsigned char>('_')) ||
-                cp == static_cast<uint32_t>(static_cast<unsigned char>('.')) || cp == static_cast<uint32_t>(static_cast<unsigned char>('~')))
-                return true;
-            return false;
-        };
-        while (it != end) {
-            const uint32_t cp = *it;
-            if (is_valid(cp)) {
-                stream << static_cast<char>(static_cast<unsigned char>(cp));  // all URI allowed characters are ASCII, so this cast is valid
-            } else {
-                char utf[4]{};
-                const char *utf_end = utf8::append(cp, utf);  // at maximum outputs 4 chars
-                char *utf_it = utf;
-                while (utf_it != utf_end) {
-                    char buff[3]{};                                                                                         // biggest char is FF\0
-                    std::snprintf(buff, sizeof(buff), "%.2X", static_cast<uint32_t>(static_cast<unsigned char>(*utf_it)));  // make sure we 0-extend instead of sign-extend
-                    stream << '%' << buff;
-                    ++utf_it;
-                }
-            }
-            ++it;
-        }
-        return make_simple_unchecked(stream.view(), node_storage);
-    } catch (const utf8::exception &e) {  // anything invalid UTF-8 related
+    if (!util::utf8_simd::is_valid(string)) {
         return Literal{};
     }
+
+    // note that ASCII is a subset of UTF-8
+    auto const is_unreserved = [](char const ch) noexcept {
+        return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z') || (ch >= '0' && ch <= '9')
+               || ch == '-' || ch == '_' || ch == '.' || ch == '~';
+    };
+
+    // percent encoding every byte of a non-ASCII code point is exactly the percent encoding of its UTF-8 representation
+    static constexpr std::string_view hex_digits = "0123456789ABCDEF";
+
+    std::string encoded;
+    encoded.reserve(string.size());
+
+    for (char const ch : string) {
+        if (is_unreserved(ch)) {
+            encoded.push_back(ch);
+        } else {
+            auto const byte = static_cast<unsigned char>(ch);
+            encoded.push_back('%');
+            encoded.push_back(hex_digits[byte >> 4]);
+            encoded.push_back(hex_digits[byte & 0xF]);
+        }
+    }
+
+    return make_simple_unchecked(encoded, node_storage);
 }
 
 Literal Literal::encode_for_uri(NodeStorage &node_storage) const {
@@ -1570,11 +1681,11 @@ Literal Literal::substr(size_t start, size_t len, Node::NodeStorage &node_storag
 
     auto const s = this->lexical_form();
 
-    if (start > s.size()) {
-        return Literal::make_string_like_copy_lang_tag("", *this, node_storage);
-    }
+    // start and len count code points, not bytes
+    auto const first = util::utf8_simd::code_point_offset(s, start);
+    auto const rest = s.view().substr(first);
 
-    auto const substr = s.view().substr(start, len);
+    auto const substr = len == std::string_view::npos ? rest : rest.substr(0, util::utf8_simd::code_point_offset(rest, len));
     return Literal::make_string_like_copy_lang_tag(substr, *this, node_storage);
 }
 
@@ -1639,23 +1750,33 @@ Literal Literal::hash_with(const char *alg, NodeStorage &node_storage) const {
 }
 
 Literal Literal::md5(NodeStorage &node_storage) const {
-    return this->hash_with("MD5", node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::MD5, 0, node_storage, [&]() {
+        return this->hash_with("MD5", node_storage);
+    });
 }
 
 Literal Literal::sha1(NodeStorage &node_storage) const {
-    return this->hash_with("SHA1", node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::SHA1, 0, node_storage, [&]() {
+        return this->hash_with("SHA1", node_storage);
+    });
 }
 
 Literal Literal::sha256(NodeStorage &node_storage) const {
-    return this->hash_with("SHA2-256", node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::SHA256, 0, node_storage, [&]() {
+        return this->hash_with("SHA2-256", node_storage);
+    });
 }
 
 Literal Literal::sha384(NodeStorage &node_storage) const {
-    return this->hash_with("SHA2-384", node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::SHA384, 0, node_storage, [&]() {
+        return this->hash_with("SHA2-384", node_storage);
+    });
 }
 
 Literal Literal::sha512(NodeStorage &node_storage) const {
-    return this->hash_with("SHA2-512", node_storage);
+    return cached_derivation(*this, storage::node::DerivedLiteralCache::Operation::SHA512, 0, node_storage, [&]() {
+        return this->hash_with("SHA2-512", node_storage);
+    });
 }
 
 bool lang_matches(std::string_view const lang_tag, std::string_view const lang_range) noexcept {
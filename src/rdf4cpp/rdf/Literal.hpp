@@ -32,7 +32,8 @@ private:
     /**
      * the implementation for all numeric, binary operations
      *
-     * @tparam OpSelect a function NumericOps -> binop_fptr_t
+     * @tparam OpSelect a function NumericOps -> binop_fptr_t, it is also used to select the operation
+     *      from datatypes::registry::inlined_numeric_ops::NumericBinOps if both operands are inlined
      * @param op_select is used to select the specific operation to be carried out
      * @param other rhs of the operation
      * @param node_storage the node storage that the resulting value will be put in
@@ -88,6 +89,12 @@ private:
      */
     [[nodiscard]] bool is_fixed_not_numeric() const noexcept;
 
+    /**
+     * Constructs a datatype specific container from Literal, like value() but without wrapping it in a std::any.
+     * This is used to pass values to the type-erased functions of the DatatypeRegistry.
+     * @return the value of this. will be empty if type is not registered.
+     */
+    [[nodiscard]] datatypes::registry::AnyValue erased_value() const noexcept;
 
     /**
      * @return if this datatype is either xsd:string or rdf:langString
@@ -104,7 +111,7 @@ private:
      */
     [[nodiscard]] static Literal make_noninlined_typed_unchecked(std::string_view lexical_form, IRI const &datatype, NodeStorage &node_storage) noexcept;
 
-    [[nodiscard]] static Literal make_noninlined_special_unchecked(std::any &&value, storage::node::identifier::LiteralType fixed_id, NodeStorage &node_storage) noexcept;
+    [[nodiscard]] static Literal make_noninlined_special_unchecked(datatypes::registry::AnyValue &&value, storage::node::identifier::LiteralType fixed_id, NodeStorage &node_storage) noexcept;
 
     /**
      * Creates an inlined Literal without any safety checks
@@ -117,7 +124,7 @@ private:
     /**
      * Creates an inlined or non-inlined typed Literal without any safety checks
      */
-    [[nodiscard]] static Literal make_typed_unchecked(std::any &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, NodeStorage &node_storage) noexcept;
+    [[nodiscard]] static Literal make_typed_unchecked(datatypes::registry::AnyValue &&value, datatypes::registry::DatatypeIDView datatype, datatypes::registry::DatatypeRegistry::DatatypeEntry const &entry, NodeStorage &node_storage) noexcept;
 
     /**
      * Creates a language-tagged Literal directly without any safety checks
@@ -186,6 +193,18 @@ public:
     [[nodiscard]] static Literal make_typed(std::string_view lexical_form, IRI const &datatype,
                                             NodeStorage &node_storage = NodeStorage::default_instance());
 
+    /**
+     * Constructs a Literal from a lexical form and a datatype without throwing if the lexical form is invalid.
+     * This is intended for bulk input (e.g. parsing) where malformed literals are expected to be common.
+     * @param lexical_form the lexical form
+     * @param datatype the datatype
+     * @param node_storage optional custom node_storage used to store the literal
+     * @return the literal or DynamicError::InvalidValueForCast (or DynamicError::OverOrUnderFlow) if lexical_form is not valid for datatype
+     *      or datatype is rdf:langString
+     */
+    [[nodiscard]] static nonstd::expected<Literal, datatypes::DynamicError> try_make_typed(std::string_view lexical_form, IRI const &datatype,
+                                                                                            NodeStorage &node_storage = NodeStorage::default_instance()) noexcept;
+
 
     /**
      * Constructs a Literal from a lexical form and a datatype provided as a template parameter.
@@ -214,7 +233,7 @@ public:
 
         if constexpr (datatypes::HasFixedId<T>) {
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
-                return Literal::make_noninlined_special_unchecked(std::any{std::move(value)}, T::fixed_id, node_storage);
+                return Literal::make_noninlined_special_unchecked(datatypes::registry::AnyValue{std::move(value)}, T::fixed_id, node_storage);
             }
         }
 
@@ -257,7 +276,7 @@ public:
             if (node_storage.has_specialized_storage_for(T::fixed_id)) {
                 return Literal{NodeBackendHandle{node_storage.find_or_make_id(storage::node::view::ValueLiteralBackendView{
                                                          .datatype = T::fixed_id,
-                                                         .value = std::any{compatible_value}}),
+                                                         .value = datatypes::registry::AnyValue{compatible_value}}),
                                         storage::node::identifier::RDFNodeType::Literal, node_storage.id()}};
             }
         }
@@ -374,6 +393,13 @@ public:
      */
     [[nodiscard]] Literal cast(IRI const &target, NodeStorage &node_storage = NodeStorage::default_instance()) const noexcept;
 
+private:
+    /**
+     * Implementation of cast(IRI const &, NodeStorage &) without looking at the DerivedLiteralCache
+     */
+    [[nodiscard]] Literal cast_impl(IRI const &target, NodeStorage &node_storage) const noexcept;
+
+public:
     /**
      * Identical to Literal::cast except with compile time specified target type.
      */
@@ -503,7 +529,7 @@ public:
                     },
                     [](storage::node::view::ValueLiteralBackendView const &any) noexcept {
                         assert(any.datatype == T::datatype_id);
-                        return std::any_cast<typename T::cpp_type>(any.value);
+                        return any.value.get<typename T::cpp_type>();
                     });
         }
     }
@@ -900,7 +926,7 @@ public:
     [[nodiscard]] Literal encode_for_uri(NodeStorage &node_storage = NodeStorage::default_instance()) const;
 
     /**
-     * akin to std::string_view::substr
+     * akin to std::string_view::substr but counting unicode code points instead of bytes
      * @see https://en.cppreference.com/w/cpp/string/basic_string_view/substr
      * @warning 0-based indexing
      *
@@ -0,0 +1,484 @@
+#include "LiteralBatch.hpp"
+
+#include <rdf4cpp/rdf/datatypes/registry/InlinedNumericOps.hpp>
+
+#include <array>
+#include <cassert>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace rdf4cpp::rdf::literal_batch {
+
+namespace {
+
+using storage::node::NodeStorage;
+using storage::node::identifier::LiteralType;
+using storage::node::identifier::NodeBackendHandle;
+
+/**
+ * The fixed id datatypes whose inlined values are plain arithmetic values, for these
+ * comparisons and ebv can be evaluated in a tight loop
+ */
+using arithmetic_types = mz::type_list<datatypes::xsd::Float,
+                                       datatypes::xsd::Double,
+                                       datatypes::xsd::Boolean,
+                                       datatypes::xsd::Long,
+                                       datatypes::xsd::Int,
+                                       datatypes::xsd::Short,
+                                       datatypes::xsd::Byte,
+                                       datatypes::xsd::UnsignedLong,
+                                       datatypes::xsd::UnsignedInt,
+                                       datatypes::xsd::UnsignedShort,
+                                       datatypes::xsd::UnsignedByte>;
+
+/**
+ * @return the literal type of the block if all literals in it are inlined and have the same type, otherwise std::nullopt
+ */
+std::optional<LiteralType> uniform_inlined_type(Literal const *block, size_t const size) noexcept {
+    if (!block[0].backend_handle().is_inlined()) {
+        return std::nullopt;
+    }
+
+    auto const type = block[0].backend_handle().node_id().literal_type();
+    for (size_t ix = 1; ix < size; ++ix) {
+        auto const &handle = block[ix].backend_handle();
+        if (!handle.is_inlined() || handle.node_id().literal_type() != type) {
+            return std::nullopt;
+        }
+    }
+
+    return type;
+}
+
+uint64_t inlined_value(Literal const &literal) noexcept {
+    return literal.backend_handle().node_id().literal_id().value;
+}
+
+Literal make_inlined(datatypes::registry::inlined_numeric_ops::InlinedValue const &value, NodeStorage &node_storage) noexcept {
+    using namespace storage::node::identifier;
+
+    Literal ret;
+    ret.backend_handle() = NodeBackendHandle{NodeID{LiteralID{value.value}, value.datatype},
+                                             RDFNodeType::Literal,
+                                             node_storage.id(),
+                                             true};
+    return ret;
+}
+
+template<typename OpSelect>
+void numeric_binop_batch(OpSelect op_select, std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out, NodeStorage &node_storage) noexcept {
+    assert(lhs.size() == rhs.size());
+    assert(out.size() >= lhs.size());
+
+    for (size_t block_start = 0; block_start < lhs.size(); block_start += block_size) {
+        auto const size = std::min(block_size, lhs.size() - block_start);
+        auto const *lhs_block = lhs.data() + block_start;
+        auto const *rhs_block = rhs.data() + block_start;
+        auto *out_block = out.data() + block_start;
+
+        datatypes::registry::inlined_numeric_ops::binop_fptr_t inlined_op = nullptr;
+
+        if (auto const lhs_type = uniform_inlined_type(lhs_block, size); lhs_type.has_value()) {
+            if (auto const rhs_type = uniform_inlined_type(rhs_block, size); rhs_type.has_value()) {
+                if (auto const *ops = datatypes::registry::inlined_numeric_ops::get_numeric_binops(*lhs_type, *rhs_type); ops != nullptr) {
+                    inlined_op = op_select(*ops);
+                }
+            }
+        }
+
+        if (inlined_op != nullptr) {
+            for (size_t ix = 0; ix < size; ++ix) {
+                if (auto const res = inlined_op(inlined_value(lhs_block[ix]), inlined_value(rhs_block[ix])); res.has_value()) [[likely]] {
+                    out_block[ix] = make_inlined(*res, node_storage);
+                } else {
+                    // failed or not inlineable, the scalar version knows what to do
+                    out_block[ix] = op_select(lhs_block[ix], rhs_block[ix], node_storage);
+                }
+            }
+        } else {
+            for (size_t ix = 0; ix < size; ++ix) {
+                out_block[ix] = op_select(lhs_block[ix], rhs_block[ix], node_storage);
+            }
+        }
+    }
+}
+
+enum struct Comparison {
+    EQ,
+    NE,
+    LT,
+    LE,
+    GT,
+    GE,
+};
+
+/**
+ * Compares two values of the same arithmetic type with the semantics of the C++ operators, i.e. any comparison with NaN is false.
+ */
+template<Comparison cmp, typename T>
+constexpr bool compare(T const &lhs, T const &rhs) noexcept {
+    if constexpr (cmp == Comparison::EQ) {
+        return lhs == rhs;
+    } else if constexpr (cmp == Comparison::NE) {
+        return lhs < rhs || lhs > rhs;
+    } else if constexpr (cmp == Comparison::LT) {
+        return lhs < rhs;
+    } else if constexpr (cmp == Comparison::LE) {
+        return lhs <= rhs;
+    } else if constexpr (cmp == Comparison::GT) {
+        return lhs > rhs;
+    } else {
+        return lhs >= rhs;
+    }
+}
+
+#if defined(__AVX2__)
+template<Comparison cmp>
+__m256d compare_vector(__m256d const lhs, __m256d const rhs) noexcept {
+    // ordered predicates, false if either operand is NaN
+    if constexpr (cmp == Comparison::EQ) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+    } else if constexpr (cmp == Comparison::NE) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_NEQ_OQ);
+    } else if constexpr (cmp == Comparison::LT) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ);
+    } else if constexpr (cmp == Comparison::LE) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ);
+    } else if constexpr (cmp == Comparison::GT) {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ);
+    } else {
+        return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ);
+    }
+}
+
+template<Comparison cmp>
+__m256 compare_vector(__m256 const lhs, __m256 const rhs) noexcept {
+    if constexpr (cmp == Comparison::EQ) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_EQ_OQ);
+    } else if constexpr (cmp == Comparison::NE) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_NEQ_OQ);
+    } else if constexpr (cmp == Comparison::LT) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+    } else if constexpr (cmp == Comparison::LE) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ);
+    } else if constexpr (cmp == Comparison::GT) {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ);
+    } else {
+        return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ);
+    }
+}
+
+/**
+ * Compares all full vectors at the start of the values and sets their bits in mask.
+ * @return the number of compared values
+ */
+template<Comparison cmp>
+size_t compare_vectors(double const *lhs, double const *rhs, size_t const size, uint64_t &mask) noexcept {
+    size_t ix = 0;
+    for (; ix + 4 <= size; ix += 4) {
+        auto const res = compare_vector<cmp>(_mm256_loadu_pd(lhs + ix), _mm256_loadu_pd(rhs + ix));
+        mask |= static_cast<uint64_t>(_mm256_movemask_pd(res)) << ix;
+    }
+    return ix;
+}
+
+template<Comparison cmp>
+size_t compare_vectors(float const *lhs, float const *rhs, size_t const size, uint64_t &mask) noexcept {
+    size_t ix = 0;
+    for (; ix + 8 <= size; ix += 8) {
+        auto const res = compare_vector<cmp>(_mm256_loadu_ps(lhs + ix), _mm256_loadu_ps(rhs + ix));
+        mask |= static_cast<uint64_t>(_mm256_movemask_ps(res)) << ix;
+    }
+    return ix;
+}
+#elif defined(__SSE2__)
+template<Comparison cmp>
+__m128d compare_vector(__m128d const lhs, __m128d const rhs) noexcept {
+    // all of these are ordered, i.e. false if either operand is NaN. cmpneq is unordered, so NE is composed of LT and GT
+    if constexpr (cmp == Comparison::EQ) {
+        return _mm_cmpeq_pd(lhs, rhs);
+    } else if constexpr (cmp == Comparison::NE) {
+        return _mm_or_pd(_mm_cmplt_pd(lhs, rhs), _mm_cmpgt_pd(lhs, rhs));
+    } else if constexpr (cmp == Comparison::LT) {
+        return _mm_cmplt_pd(lhs, rhs);
+    } else if constexpr (cmp == Comparison::LE) {
+        return _mm_cmple_pd(lhs, rhs);
+    } else if constexpr (cmp == Comparison::GT) {
+        return _mm_cmpgt_pd(lhs, rhs);
+    } else {
+        return _mm_cmpge_pd(lhs, rhs);
+    }
+}
+
+template<Comparison cmp>
+__m128 compare_vector(__m128 const lhs, __m128 const rhs) noexcept {
+    if constexpr (cmp == Comparison::EQ) {
+        return _mm_cmpeq_ps(lhs, rhs);
+    } else if constexpr (cmp == Comparison::NE) {
+        return _mm_or_ps(_mm_cmplt_ps(lhs, rhs), _mm_cmpgt_ps(lhs, rhs));
+    } else if constexpr (cmp == Comparison::LT) {
+        return _mm_cmplt_ps(lhs, rhs);
+    } else if constexpr (cmp == Comparison::LE) {
+        return _mm_cmple_ps(lhs, rhs);
+    } else if constexpr (cmp == Comparison::GT) {
+        return _mm_cmpgt_ps(lhs, rhs);
+    } else {
+        return _mm_cmpge_ps(lhs, rhs);
+    }
+}
+
+/**
+ * Compares all full vectors at the start of the values and sets their bits in mask.
+ * @return the number of compared values
+ */
+template<Comparison cmp>
+size_t compare_vectors(double const *lhs, double const *rhs, size_t const size, uint64_t &mask) noexcept {
+    size_t ix = 0;
+    for (; ix + 2 <= size; ix += 2) {
+        auto const res = compare_vector<cmp>(_mm_loadu_pd(lhs + ix), _mm_loadu_pd(rhs + ix));
+        mask |= static_cast<uint64_t>(_mm_movemask_pd(res)) << ix;
+    }
+    return ix;
+}
+
+template<Comparison cmp>
+size_t compare_vectors(float const *lhs, float const *rhs, size_t const size, uint64_t &mask) noexcept {
+    size_t ix = 0;
+    for (; ix + 4 <= size; ix += 4) {
+        auto const res = compare_vector<cmp>(_mm_loadu_ps(lhs + ix), _mm_loadu_ps(rhs + ix));
+        mask |= static_cast<uint64_t>(_mm_movemask_ps(res)) << ix;
+    }
+    return ix;
+}
+#endif
+
+/**
+ * @return a mask in which bit ix is set iff compare<cmp>(lhs[ix], rhs[ix])
+ */
+template<Comparison cmp, typename V>
+uint64_t compare_values(V const *lhs, V const *rhs, size_t const size) noexcept {
+    uint64_t mask = 0;
+    size_t ix = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    if constexpr (std::is_same_v<V, double> || std::is_same_v<V, float>) {
+        ix = compare_vectors<cmp>(lhs, rhs, size, mask);
+    }
+#endif
+
+    // integers (and the tail) are left to auto-vectorization
+    for (; ix < size; ++ix) {
+        mask |= static_cast<uint64_t>(compare<cmp>(lhs[ix], rhs[ix])) << ix;
+    }
+
+    return mask;
+}
+
+template<Comparison cmp>
+bool scalar_compare(Literal const &lhs, Literal const &rhs) noexcept {
+    if constexpr (cmp == Comparison::EQ) {
+        return lhs.eq(rhs) == util::TriBool::True;
+    } else if constexpr (cmp == Comparison::NE) {
+        return lhs.ne(rhs) == util::TriBool::True;
+    } else if constexpr (cmp == Comparison::LT) {
+        return lhs.lt(rhs) == util::TriBool::True;
+    } else if constexpr (cmp == Comparison::LE) {
+        return lhs.le(rhs) == util::TriBool::True;
+    } else if constexpr (cmp == Comparison::GT) {
+        return lhs.gt(rhs) == util::TriBool::True;
+    } else {
+        return lhs.ge(rhs) == util::TriBool::True;
+    }
+}
+
+/**
+ * Same results as the scalar comparisons for literals of the same arithmetic type T.
+ * Literals with identical handles are always equivalent, even if the value is NaN, for any other NaN the comparison is an error.
+ */
+template<Comparison cmp, typename T>
+uint64_t compare_block(Literal const *lhs, Literal const *rhs, size_t const size) noexcept {
+    std::array<typename T::cpp_type, block_size> lhs_values;
+    std::array<typename T::cpp_type, block_size> rhs_values;
+    uint64_t same_handle = 0;
+
+    for (size_t ix = 0; ix < size; ++ix) {
+        lhs_values[ix] = T::from_inlined(inlined_value(lhs[ix]));
+        rhs_values[ix] = T::from_inlined(inlined_value(rhs[ix]));
+        same_handle |= static_cast<uint64_t>(lhs[ix].backend_handle() == rhs[ix].backend_handle()) << ix;
+    }
+
+    auto const mask = compare_values<cmp>(lhs_values.data(), rhs_values.data(), size);
+
+    if constexpr (cmp == Comparison::EQ || cmp == Comparison::LE || cmp == Comparison::GE) {
+        return mask | same_handle;
+    } else {
+        return mask & ~same_handle;
+    }
+}
+
+template<typename T>
+uint64_t ebv_block(Literal const *operand, size_t const size) noexcept {
+    uint64_t mask = 0;
+    for (size_t ix = 0; ix < size; ++ix) {
+        mask |= static_cast<uint64_t>(T::effective_boolean_value(T::from_inlined(inlined_value(operand[ix])))) << ix;
+    }
+
+    return mask;
+}
+
+/**
+ * Table of block kernels indexed by the underlying value of the LiteralType of the block, nullptr if there is no kernel for the type
+ */
+template<typename Kernel, typename MakeKernel>
+consteval std::array<Kernel, 1 << LiteralType::width> make_kernel_table(MakeKernel make_kernel) {
+    std::array<Kernel, 1 << LiteralType::width> table{};
+
+    [&]<size_t... ixs>(std::index_sequence<ixs...>) {
+        ((table[arithmetic_types::select<ixs>::fixed_id.to_underlying()] = make_kernel.template operator()<typename arithmetic_types::template select<ixs>>()), ...);
+    }(std::make_index_sequence<arithmetic_types::length>{});
+
+    return table;
+}
+
+using compare_kernel_t = uint64_t (*)(Literal const *lhs, Literal const *rhs, size_t size) noexcept;
+using ebv_kernel_t = uint64_t (*)(Literal const *operand, size_t size) noexcept;
+
+template<Comparison cmp>
+constexpr auto compare_kernels = make_kernel_table<compare_kernel_t>([]<typename T>() {
+    return &compare_block<cmp, T>;
+});
+
+constexpr auto ebv_kernels = make_kernel_table<ebv_kernel_t>([]<typename T>() {
+    return &ebv_block<T>;
+});
+
+template<Comparison cmp>
+void compare_batch(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    assert(lhs.size() == rhs.size());
+    assert(out_mask.size() >= bitmask_words(lhs.size()));
+
+    for (size_t block_start = 0; block_start < lhs.size(); block_start += block_size) {
+        auto const size = std::min(block_size, lhs.size() - block_start);
+        auto const *lhs_block = lhs.data() + block_start;
+        auto const *rhs_block = rhs.data() + block_start;
+
+        compare_kernel_t kernel = nullptr;
+
+        if (auto const lhs_type = uniform_inlined_type(lhs_block, size); lhs_type.has_value()) {
+            if (auto const rhs_type = uniform_inlined_type(rhs_block, size); rhs_type == lhs_type) {
+                kernel = compare_kernels<cmp>[lhs_type->to_underlying()];
+            }
+        }
+
+        uint64_t mask = 0;
+        if (kernel != nullptr) {
+            mask = kernel(lhs_block, rhs_block, size);
+        } else {
+            for (size_t ix = 0; ix < size; ++ix) {
+                mask |= static_cast<uint64_t>(scalar_compare<cmp>(lhs_block[ix], rhs_block[ix])) << ix;
+            }
+        }
+
+        out_mask[block_start / block_size] = mask;
+    }
+}
+
+}  // namespace
+
+void add(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out, NodeStorage &node_storage) noexcept {
+    numeric_binop_batch(util::Overloaded{
+                                [](auto const &num_ops) noexcept {
+                                    return num_ops.add_fptr;
+                                },
+                                [](Literal const &l, Literal const &r, NodeStorage &ns) noexcept {
+                                    return l.add(r, ns);
+                                }},
+                        lhs, rhs, out, node_storage);
+}
+
+void sub(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out, NodeStorage &node_storage) noexcept {
+    numeric_binop_batch(util::Overloaded{
+                                [](auto const &num_ops) noexcept {
+                                    return num_ops.sub_fptr;
+                                },
+                                [](Literal const &l, Literal const &r, NodeStorage &ns) noexcept {
+                                    return l.sub(r, ns);
+                                }},
+                        lhs, rhs, out, node_storage);
+}
+
+void mul(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out, NodeStorage &node_storage) noexcept {
+    numeric_binop_batch(util::Overloaded{
+                                [](auto const &num_ops) noexcept {
+                                    return num_ops.mul_fptr;
+                                },
+                                [](Literal const &l, Literal const &r, NodeStorage &ns) noexcept {
+                                    return l.mul(r, ns);
+                                }},
+                        lhs, rhs, out, node_storage);
+}
+
+void div(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out, NodeStorage &node_storage) noexcept {
+    numeric_binop_batch(util::Overloaded{
+                                [](auto const &num_ops) noexcept {
+                                    return num_ops.div_fptr;
+                                },
+                                [](Literal const &l, Literal const &r, NodeStorage &ns) noexcept {
+                                    return l.div(r, ns);
+                                }},
+                        lhs, rhs, out, node_storage);
+}
+
+void eq(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::EQ>(lhs, rhs, out_mask);
+}
+
+void ne(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::NE>(lhs, rhs, out_mask);
+}
+
+void lt(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::LT>(lhs, rhs, out_mask);
+}
+
+void le(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::LE>(lhs, rhs, out_mask);
+}
+
+void gt(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::GT>(lhs, rhs, out_mask);
+}
+
+void ge(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept {
+    compare_batch<Comparison::GE>(lhs, rhs, out_mask);
+}
+
+void ebv(std::span<Literal const> operand, std::span<uint64_t> out_mask) noexcept {
+    assert(out_mask.size() >= bitmask_words(operand.size()));
+
+    for (size_t block_start = 0; block_start < operand.size(); block_start += block_size) {
+        auto const size = std::min(block_size, operand.size() - block_start);
+        auto const *block = operand.data() + block_start;
+
+        ebv_kernel_t kernel = nullptr;
+        if (auto const type = uniform_inlined_type(block, size); type.has_value()) {
+            kernel = ebv_kernels[type->to_underlying()];
+        }
+
+        uint64_t mask = 0;
+        if (kernel != nullptr) {
+            mask = kernel(block, size);
+        } else {
+            for (size_t ix = 0; ix < size; ++ix) {
+                mask |= static_cast<uint64_t>(block[ix].ebv() == util::TriBool::True) << ix;
+            }
+        }
+
+        out_mask[block_start / block_size] = mask;
+    }
+}
+
+}  // namespace rdf4cpp::rdf::literal_batch
@@ -0,0 +1,108 @@
+#ifndef RDF4CPP_LITERALBATCH_HPP
+#define RDF4CPP_LITERALBATCH_HPP
+
+#include <rdf4cpp/rdf/Literal.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/**
+ * Batch versions of Literal operations, e.g. for evaluating FILTER and BIND expressions over many solutions at once.
+ *
+ * The inputs are processed in blocks of block_size rows. If all Literals in a block are inlined and of the same fixed numeric or boolean type,
+ * the operation is carried out directly on the inlined values in a tight loop (without any registry lookups).
+ * Comparisons of xsd:double and xsd:float use AVX2 or SSE2 if the target supports them, all other tight loops are left to auto-vectorization.
+ * All other blocks fall back to the scalar Literal operations, so the results are always exactly the same as for the scalar versions.
+ *
+ * Boolean results are written into bitmasks: the result for row i is bit (i % 64) of word (i / 64).
+ * A bit is set iff the scalar operation returns TriBool::True, i.e. errors are treated as false like in a FILTER.
+ * Unused bits in the last word are set to 0.
+ */
+namespace rdf4cpp::rdf::literal_batch {
+
+/**
+ * Number of rows that are processed together, equal to the number of bits in a bitmask word
+ */
+static constexpr size_t block_size = 64;
+
+/**
+ * @return the number of uint64_t words needed for a bitmask of size rows
+ */
+constexpr size_t bitmask_words(size_t const size) noexcept {
+    return (size + block_size - 1) / block_size;
+}
+
+/**
+ * out[i] = lhs[i].add(rhs[i], node_storage)
+ * @pre lhs.size() == rhs.size() && out.size() >= lhs.size()
+ */
+void add(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out,
+         storage::node::NodeStorage &node_storage = storage::node::NodeStorage::default_instance()) noexcept;
+
+/**
+ * out[i] = lhs[i].sub(rhs[i], node_storage)
+ * @pre lhs.size() == rhs.size() && out.size() >= lhs.size()
+ */
+void sub(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out,
+         storage::node::NodeStorage &node_storage = storage::node::NodeStorage::default_instance()) noexcept;
+
+/**
+ * out[i] = lhs[i].mul(rhs[i], node_storage)
+ * @pre lhs.size() == rhs.size() && out.size() >= lhs.size()
+ */
+void mul(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out,
+         storage::node::NodeStorage &node_storage = storage::node::NodeStorage::default_instance()) noexcept;
+
+/**
+ * out[i] = lhs[i].div(rhs[i], node_storage)
+ * @pre lhs.size() == rhs.size() && out.size() >= lhs.size()
+ */
+void div(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<Literal> out,
+         storage::node::NodeStorage &node_storage = storage::node::NodeStorage::default_instance()) noexcept;
+
+/**
+ * Bitmask of lhs[i].eq(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void eq(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of lhs[i].ne(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void ne(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of lhs[i].lt(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void lt(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of lhs[i].le(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void le(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of lhs[i].gt(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void gt(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of lhs[i].ge(rhs[i])
+ * @pre lhs.size() == rhs.size() && out_mask.size() >= bitmask_words(lhs.size())
+ */
+void ge(std::span<Literal const> lhs, std::span<Literal const> rhs, std::span<uint64_t> out_mask) noexcept;
+
+/**
+ * Bitmask of operand[i].ebv()
+ * @pre out_mask.size() >= bitmask_words(operand.size())
+ */
+void ebv(std::span<Literal const> operand, std::span<uint64_t> out_mask) noexcept;
+
+}  // namespace rdf4cpp::rdf::literal_batch
+
+#endif  //RDF4CPP_LITERALBATCH_HPP
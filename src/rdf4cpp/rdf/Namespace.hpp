@@ -2,7 +2,7 @@
 #define RDF4CPP_NAMESPACE_HPP
 
 #include <rdf4cpp/rdf/IRI.hpp>
-#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
 #include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
 
 #include <string>
@@ -39,7 +39,7 @@ protected:
      * Cache storing the <div>NodeBackendHandle</div> for prefixes. This saves roundtrips to NodeStorage.
      */
     mutable storage::util::tsl::sparse_map<std::string, storage::node::identifier::NodeBackendHandle,
-                                   storage::util::robin_hood::hash<std::string_view>, std::equal_to<>>
+                                   storage::util::wyhash::hash<std::string_view>, std::equal_to<>>
             cache_;
 
 public:
@@ -0,0 +1,204 @@
+#ifndef RDF4CPP_REGISTRY_ANYVALUE_HPP
+#define RDF4CPP_REGISTRY_ANYVALUE_HPP
+
+#include <any>
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rdf4cpp::rdf::datatypes::registry {
+
+/**
+ * A move-only, type-erased container for a single value of any type, similar to std::any.
+ * This is the value representation used by the type-erased functions of the DatatypeRegistry.
+ *
+ * In contrast to std::any, values of all types that fit into inline_size bytes (this includes the cpp_types
+ * of all fixed id datatypes) are stored inline, so creating, moving and accessing them never allocates.
+ * Bigger types are stored on the heap.
+ */
+class AnyValue {
+public:
+    static constexpr size_t inline_size = 48;
+    static constexpr size_t inline_align = 16;
+
+    /**
+     * Whether values of type T are stored inline (i.e. without allocation) in an AnyValue
+     */
+    template<typename T>
+    static constexpr bool stored_inline = sizeof(T) <= inline_size
+                                          && alignof(T) <= inline_align
+                                          && std::is_nothrow_move_constructible_v<T>;
+
+private:
+    struct VTable {
+        void (*destroy)(AnyValue &self) noexcept;
+        void (*move)(AnyValue &dst, AnyValue &src) noexcept;  // moves the value of src into dst and destroys it in src
+        void (*copy)(AnyValue &dst, AnyValue const &src);
+        std::any (*into_any)(AnyValue &self);
+    };
+
+    template<typename T>
+    struct Handler {
+        static T *get(AnyValue &self) noexcept {
+            if constexpr (stored_inline<T>) {
+                return std::launder(reinterpret_cast<T *>(self.storage));
+            } else {
+                return *std::launder(reinterpret_cast<T **>(self.storage));
+            }
+        }
+
+        template<typename... Args>
+        static void construct(AnyValue &self, Args &&...args) {
+            if constexpr (stored_inline<T>) {
+                ::new (self.storage) T(std::forward<Args>(args)...);
+            } else {
+                ::new (self.storage) T *(new T(std::forward<Args>(args)...));
+            }
+        }
+
+        static void destroy(AnyValue &self) noexcept {
+            if constexpr (stored_inline<T>) {
+                get(self)->~T();
+            } else {
+                delete get(self);
+            }
+        }
+
+        static void move(AnyValue &dst, AnyValue &src) noexcept {
+            if constexpr (stored_inline<T>) {
+                ::new (dst.storage) T(std::move(*get(src)));
+                get(src)->~T();
+            } else {
+                ::new (dst.storage) T *(get(src));
+            }
+        }
+
+        static void copy(AnyValue &dst, AnyValue const &src) {
+            construct(dst, *get(const_cast<AnyValue &>(src)));
+        }
+
+        static std::any into_any(AnyValue &self) {
+            return std::any{std::move(*get(self))};
+        }
+
+        static constexpr VTable vtable{.destroy = &destroy, .move = &move, .copy = &copy, .into_any = &into_any};
+    };
+
+    alignas(inline_align) std::byte storage[inline_size];
+    VTable const *vtable = nullptr;  ///< identifies the type of the contained value, nullptr if empty
+
+    void reset() noexcept {
+        if (this->vtable != nullptr) {
+            this->vtable->destroy(*this);
+            this->vtable = nullptr;
+        }
+    }
+
+public:
+    /**
+     * Constructs an empty AnyValue
+     */
+    AnyValue() noexcept = default;
+
+    /**
+     * Constructs an AnyValue containing value
+     */
+    template<typename T>
+        requires (!std::is_same_v<std::remove_cvref_t<T>, AnyValue> && std::is_copy_constructible_v<std::remove_cvref_t<T>>)
+    AnyValue(T &&value) noexcept(stored_inline<std::remove_cvref_t<T>> && std::is_nothrow_constructible_v<std::remove_cvref_t<T>, T>)  // NOLINT(google-explicit-constructor)
+        : vtable{&Handler<std::remove_cvref_t<T>>::vtable} {
+        Handler<std::remove_cvref_t<T>>::construct(*this, std::forward<T>(value));
+    }
+
+    AnyValue(AnyValue &&other) noexcept : vtable{other.vtable} {
+        if (this->vtable != nullptr) {
+            this->vtable->move(*this, other);
+            other.vtable = nullptr;
+        }
+    }
+
+    AnyValue &operator=(AnyValue &&other) noexcept {
+        if (this != &other) {
+            this->reset();
+
+            if (other.vtable != nullptr) {
+                other.vtable->move(*this, other);
+                this->vtable = std::exchange(other.vtable, nullptr);
+            }
+        }
+
+        return *this;
+    }
+
+    AnyValue(AnyValue const &) = delete;
+    AnyValue &operator=(AnyValue const &) = delete;
+
+    ~AnyValue() {
+        this->reset();
+    }
+
+    [[nodiscard]] bool has_value() const noexcept {
+        return this->vtable != nullptr;
+    }
+
+    /**
+     * @return true if this contains a value of type T
+     */
+    template<typename T>
+    [[nodiscard]] bool holds() const noexcept {
+        return this->vtable == &Handler<T>::vtable;
+    }
+
+    /**
+     * Accesses the contained value.
+     * @warning this must contain a value of type T
+     */
+    template<typename T>
+    [[nodiscard]] T const &get() const noexcept {
+        assert(this->holds<T>());
+        return *Handler<T>::get(const_cast<AnyValue &>(*this));
+    }
+
+    /**
+     * Accesses the contained value.
+     * @warning this must contain a value of type T
+     */
+    template<typename T>
+    [[nodiscard]] T &get() noexcept {
+        assert(this->holds<T>());
+        return *Handler<T>::get(*this);
+    }
+
+    /**
+     * Explicitly copies this, AnyValue is not implicitly copyable to avoid accidental copies of big values.
+     * @return an AnyValue containing a copy of the value of this
+     */
+    [[nodiscard]] AnyValue clone() const {
+        AnyValue ret;
+        if (this->vtable != nullptr) {
+            this->vtable->copy(ret, *this);
+            ret.vtable = this->vtable;
+        }
+
+        return ret;
+    }
+
+    /**
+     * Moves the contained value into a std::any, this is empty afterwards
+     */
+    [[nodiscard]] std::any into_any() && {
+        if (this->vtable == nullptr) {
+            return std::any{};
+        }
+
+        auto any = this->vtable->into_any(*this);
+        this->reset();
+        return any;
+    }
+};
+
+}  // namespace rdf4cpp::rdf::datatypes::registry
+
+#endif  //RDF4CPP_REGISTRY_ANYVALUE_HPP
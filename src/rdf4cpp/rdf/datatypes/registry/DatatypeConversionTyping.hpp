@@ -1,12 +1,12 @@
 #ifndef RDF4CPP_DATATYPECONVERSIONTYPING_HPP
 #define RDF4CPP_DATATYPECONVERSIONTYPING_HPP
 
-#include <any>
 #include <concepts>
 #include <tuple>
 #include <type_traits>
 
 #include <rdf4cpp/rdf/datatypes/LiteralDatatype.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/AnyValue.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/DatatypeID.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/util/TypeList.hpp>
 
@@ -72,8 +72,8 @@ concept ConversionTable = conversion_typing_detail::IsConversionTable<T>::value;
  * A type erased version of a ConversionEntry.
  */
 struct RuntimeConversionEntry {
-    using convert_fptr_t = std::any (*)(std::any const &) noexcept;
-    using inverted_convert_fptr_t = nonstd::expected<std::any, DynamicError> (*)(std::any const &) noexcept;
+    using convert_fptr_t = AnyValue (*)(AnyValue const &) noexcept;
+    using inverted_convert_fptr_t = nonstd::expected<AnyValue, DynamicError> (*)(AnyValue const &) noexcept;
 
     DatatypeID target_type_id;
     convert_fptr_t convert;
@@ -91,19 +91,19 @@ struct RuntimeConversionEntry {
 
         return RuntimeConversionEntry{
                 .target_type_id = std::move(target_type_iri),
-                .convert = [](std::any const &value) noexcept -> std::any {
-                    auto const actual_value = std::any_cast<typename Entry::source_type::cpp_type>(value);
-                    return std::any{Entry::convert(actual_value)};
+                .convert = [](AnyValue const &value) noexcept -> AnyValue {
+                    auto const &actual_value = value.get<typename Entry::source_type::cpp_type>();
+                    return AnyValue{Entry::convert(actual_value)};
                 },
-                .inverted_convert = [](std::any const &value) noexcept -> nonstd::expected<std::any, DynamicError> {
-                    auto const actual_value = std::any_cast<typename Entry::target_type::cpp_type>(value);
-                    auto const maybe_converted = Entry::inverse_convert(actual_value);
+                .inverted_convert = [](AnyValue const &value) noexcept -> nonstd::expected<AnyValue, DynamicError> {
+                    auto const &actual_value = value.get<typename Entry::target_type::cpp_type>();
+                    auto maybe_converted = Entry::inverse_convert(actual_value);
 
                     if (!maybe_converted.has_value()) {
                         return nonstd::make_unexpected(maybe_converted.error());
                     }
 
-                    return std::any{*maybe_converted};
+                    return AnyValue{std::move(*maybe_converted)};
                 }};
     }
 };
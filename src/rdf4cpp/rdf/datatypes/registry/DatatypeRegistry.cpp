@@ -62,6 +62,14 @@ DatatypeRegistry::factory_fptr_t DatatypeRegistry::get_factory(DatatypeIDView co
     return res.has_value() ? *res : nullptr;
 }
 
+DatatypeRegistry::try_factory_fptr_t DatatypeRegistry::get_try_factory(DatatypeIDView const datatype_id) noexcept {
+    auto const res = find_map_entry(datatype_id, [](auto const &entry) noexcept {
+        return entry.try_factory_fptr;
+    });
+
+    return res.has_value() ? *res : nullptr;
+}
+
 DatatypeRegistry::to_string_fptr_t DatatypeRegistry::get_to_canonical_string(DatatypeIDView const datatype_id) noexcept {
     auto const res = find_map_entry(datatype_id, [](auto const &entry) noexcept {
         return entry.to_canonical_string_fptr;
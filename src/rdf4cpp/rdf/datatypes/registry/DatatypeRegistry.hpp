@@ -2,10 +2,10 @@
 #define RDF4CPP_DATATYPEREGISTRY_HPP
 
 #include <rdf4cpp/rdf/datatypes/LiteralDatatype.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/AnyValue.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/DatatypeConversion.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/FixedIdMappings.hpp>
 
-#include <any>
 #include <algorithm>
 #include <functional>
 #include <optional>
@@ -28,22 +28,27 @@ public:
     /**
      * Constructs an instance of a type from a string.
      */
-    using factory_fptr_t = std::any (*)(std::string_view);
-    using to_string_fptr_t = std::string (*)(std::any const &) noexcept;
-    using ebv_fptr_t = bool (*)(std::any const &) noexcept;
-    using try_into_inlined_fptr_t = std::optional<uint64_t> (*)(std::any const &) noexcept;
-    using from_inlined_fptr_t = std::any (*)(uint64_t) noexcept;
+    using factory_fptr_t = AnyValue (*)(std::string_view);
+
+    /**
+     * Constructs an instance of a type from a string without throwing if the string is not a valid lexical form.
+     */
+    using try_factory_fptr_t = nonstd::expected<AnyValue, DynamicError> (*)(std::string_view) noexcept;
+    using to_string_fptr_t = std::string (*)(AnyValue const &) noexcept;
+    using ebv_fptr_t = bool (*)(AnyValue const &) noexcept;
+    using try_into_inlined_fptr_t = std::optional<uint64_t> (*)(AnyValue const &) noexcept;
+    using from_inlined_fptr_t = AnyValue (*)(uint64_t) noexcept;
 
     struct NumericOpResult {
         DatatypeID result_type_id;
-        nonstd::expected<std::any, DynamicError> result_value;
+        nonstd::expected<AnyValue, DynamicError> result_value;
     };
 
-    using nullop_fptr_t = std::any (*)() noexcept;
-    using unop_fptr_t = NumericOpResult (*)(std::any const &) noexcept;
-    using binop_fptr_t = NumericOpResult (*)(std::any const &, std::any const &) noexcept;
+    using nullop_fptr_t = AnyValue (*)() noexcept;
+    using unop_fptr_t = NumericOpResult (*)(AnyValue const &) noexcept;
+    using binop_fptr_t = NumericOpResult (*)(AnyValue const &, AnyValue const &) noexcept;
 
-    using compare_fptr_t = std::partial_ordering (*)(std::any const &, std::any const &) noexcept;
+    using compare_fptr_t = std::partial_ordering (*)(AnyValue const &, AnyValue const &) noexcept;
 
     struct NumericOpsImpl {
         nullop_fptr_t zero_value_fptr; // 0
@@ -100,6 +105,7 @@ public:
     struct DatatypeEntry {
         std::string datatype_iri;                   // datatype IRI string
         factory_fptr_t factory_fptr;                // construct from string
+        try_factory_fptr_t try_factory_fptr;        // construct from string, without throwing on invalid input
         to_string_fptr_t to_canonical_string_fptr;  // convert to canonical string
         to_string_fptr_t to_simplified_string_fptr; // convert to simplified string (e.g. for casting to xsd:string)
 
@@ -116,6 +122,7 @@ public:
             return DatatypeEntry{
                     .datatype_iri = "",
                     .factory_fptr = nullptr,
+                    .try_factory_fptr = nullptr,
                     .to_canonical_string_fptr = nullptr,
                     .to_simplified_string_fptr = nullptr,
                     .ebv_fptr = nullptr,
@@ -129,6 +136,7 @@ public:
             return DatatypeEntry{
                     .datatype_iri = std::string{datatype_iri},
                     .factory_fptr = nullptr,
+                    .try_factory_fptr = nullptr,
                     .to_canonical_string_fptr = nullptr,
                     .to_simplified_string_fptr = nullptr,
                     .ebv_fptr = nullptr,
@@ -223,12 +231,19 @@ public:
     [[nodiscard]] static std::optional<std::string_view> get_iri(DatatypeIDView datatype_id) noexcept;
 
     /**
-     * Get a factory_fptr_t for a datatype. The factory_fptr_t can be used like `std::any type_instance = factory_fptr("types string representation")`.
+     * Get a factory_fptr_t for a datatype. The factory_fptr_t can be used like `AnyValue type_instance = factory_fptr("types string representation")`.
      * @param datatype_id datatype id for the corresponding datatype
      * @return function pointer or nullptr
      */
     [[nodiscard]] static factory_fptr_t get_factory(DatatypeIDView datatype_id) noexcept;
 
+    /**
+     * Get a try_factory_fptr_t for a datatype. The try_factory_fptr_t can be used like `nonstd::expected<AnyValue, DynamicError> type_instance = try_factory_fptr("types string representation")`.
+     * @param datatype_id datatype id for the corresponding datatype
+     * @return function pointer or nullptr
+     */
+    [[nodiscard]] static try_factory_fptr_t get_try_factory(DatatypeIDView datatype_id) noexcept;
+
     /**
      * Get a to_canonical_string function for a datatype. The factory_fptr_t can be used like `std::string str_repr = to_canonical_string_fptr(any_typed_arg)`.
      * @param datatype_id datatype id for the corresponding datatype
@@ -371,8 +386,8 @@ inline void DatatypeRegistry::add() noexcept {
 
     auto const ebv_fptr = []() -> ebv_fptr_t {
         if constexpr (datatypes::LogicalLiteralDatatype<LiteralDatatype_t>) {
-            return [](std::any const &operand) noexcept -> bool {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            return [](AnyValue const &operand) noexcept -> bool {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
                 return LiteralDatatype_t::effective_boolean_value(operand_val);
             };
         } else {
@@ -382,9 +397,9 @@ inline void DatatypeRegistry::add() noexcept {
 
     auto const compare_fptr = []() -> compare_fptr_t {
         if constexpr (datatypes::ComparableLiteralDatatype<LiteralDatatype_t>) {
-            return [](std::any const &lhs, std::any const &rhs) noexcept -> std::partial_ordering {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            return [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> std::partial_ordering {
+                auto const &lhs_val = lhs.get<typename LiteralDatatype_t::cpp_type>();
+                auto const &rhs_val = rhs.get<typename LiteralDatatype_t::cpp_type>();
 
                 return LiteralDatatype_t::compare(lhs_val, rhs_val);
             };
@@ -403,14 +418,22 @@ inline void DatatypeRegistry::add() noexcept {
 
     DatatypeEntry entry{
             .datatype_iri = std::string{LiteralDatatype_t::identifier},
-            .factory_fptr = [](std::string_view string_repr) -> std::any {
+            .factory_fptr = [](std::string_view string_repr) -> AnyValue {
                 return LiteralDatatype_t::from_string(string_repr);
             },
-            .to_canonical_string_fptr = [](std::any const &value) noexcept -> std::string {
-                return LiteralDatatype_t::to_canonical_string(std::any_cast<typename LiteralDatatype_t::cpp_type>(value));
+            .try_factory_fptr = [](std::string_view string_repr) noexcept -> nonstd::expected<AnyValue, DynamicError> {
+                auto value = LiteralDatatype_t::try_from_string(string_repr);
+                if (!value.has_value()) {
+                    return nonstd::make_unexpected(value.error());
+                }
+
+                return AnyValue{std::move(*value)};
             },
-            .to_simplified_string_fptr = [](std::any const &value) noexcept -> std::string {
-                return LiteralDatatype_t::to_simplified_string(std::any_cast<typename LiteralDatatype_t::cpp_type>(value));
+            .to_canonical_string_fptr = [](AnyValue const &value) noexcept -> std::string {
+                return LiteralDatatype_t::to_canonical_string(value.get<typename LiteralDatatype_t::cpp_type>());
+            },
+            .to_simplified_string_fptr = [](AnyValue const &value) noexcept -> std::string {
+                return LiteralDatatype_t::to_simplified_string(value.get<typename LiteralDatatype_t::cpp_type>());
             },
             .ebv_fptr = ebv_fptr,
             .numeric_ops = num_ops,
@@ -419,6 +442,9 @@ inline void DatatypeRegistry::add() noexcept {
             .conversion_table = RuntimeConversionTable::from_concrete<conversion_table_t>()};
 
     if constexpr (FixedIdLiteralDatatype<LiteralDatatype_t>) {
+        static_assert(AnyValue::stored_inline<typename LiteralDatatype_t::cpp_type>,
+                      "values of fixed id datatypes must fit into the inline storage of AnyValue");
+
         DatatypeRegistry::add_fixed(std::move(entry), LiteralDatatype_t::fixed_id);
     } else {
         DatatypeRegistry::add(std::move(entry));
@@ -451,9 +477,9 @@ struct SelectOpResIRI {
 };
 
 template<typename T>
-[[nodiscard]] nonstd::expected<std::any, DynamicError> map_expected(nonstd::expected<T, DynamicError> const &e) noexcept {
+[[nodiscard]] nonstd::expected<AnyValue, DynamicError> map_expected(nonstd::expected<T, DynamicError> &&e) noexcept {
     if (e.has_value()) {
-        return *e;
+        return std::move(*e);
     } else {
         return nonstd::make_unexpected(e.error());
     }
@@ -464,92 +490,92 @@ template<datatypes::NumericImplLiteralDatatype LiteralDatatype_t>
 DatatypeRegistry::NumericOpsImpl DatatypeRegistry::make_numeric_ops_impl() noexcept {
     return NumericOpsImpl{
             // 0
-            .zero_value_fptr = []() noexcept -> std::any {
+            .zero_value_fptr = []() noexcept -> AnyValue {
                 return LiteralDatatype_t::zero_value();
             },
             // 1
-            .one_value_fptr = []() noexcept -> std::any {
+            .one_value_fptr = []() noexcept -> AnyValue {
                 return LiteralDatatype_t::one_value();
             },
             // a + b
-            .add_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> NumericOpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .add_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> NumericOpResult {
+                auto const &lhs_val = lhs.get<typename LiteralDatatype_t::cpp_type>();
+                auto const &rhs_val = rhs.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::add_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::add(lhs_val, rhs_val))};
             },
             // a - b
-            .sub_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> NumericOpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .sub_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> NumericOpResult {
+                auto const &lhs_val = lhs.get<typename LiteralDatatype_t::cpp_type>();
+                auto const &rhs_val = rhs.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::sub_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::sub(lhs_val, rhs_val))};
             },
             // a * b
-            .mul_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> NumericOpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .mul_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> NumericOpResult {
+                auto const &lhs_val = lhs.get<typename LiteralDatatype_t::cpp_type>();
+                auto const &rhs_val = rhs.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::mul_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::mul(lhs_val, rhs_val))};
             },
             // a / b
-            .div_fptr = [](std::any const &lhs, std::any const &rhs) noexcept -> NumericOpResult {
-                auto const &lhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(lhs);
-                auto const &rhs_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(rhs);
+            .div_fptr = [](AnyValue const &lhs, AnyValue const &rhs) noexcept -> NumericOpResult {
+                auto const &lhs_val = lhs.get<typename LiteralDatatype_t::cpp_type>();
+                auto const &rhs_val = rhs.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::div_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::div(lhs_val, rhs_val))};
             },
             // +a
-            .pos_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .pos_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::pos_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::pos(operand_val))};
             },
             // -a
-            .neg_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .neg_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::neg_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::neg(operand_val))};
             },
             // abs(a)
-            .abs_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .abs_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::abs_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::abs(operand_val))};
             },
             // round(a)
-            .round_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .round_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::round_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::round(operand_val))};
             },
             // floor(a)
-            .floor_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .floor_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::floor_result, LiteralDatatype_t>::select(),
                         .result_value = detail::map_expected(LiteralDatatype_t::floor(operand_val))};
             },
             // ceil(a)
-            .ceil_fptr = [](std::any const &operand) noexcept -> NumericOpResult {
-                auto const &operand_val = std::any_cast<typename LiteralDatatype_t::cpp_type>(operand);
+            .ceil_fptr = [](AnyValue const &operand) noexcept -> NumericOpResult {
+                auto const &operand_val = operand.get<typename LiteralDatatype_t::cpp_type>();
 
                 return NumericOpResult{
                         .result_type_id = detail::SelectOpResIRI<typename LiteralDatatype_t::ceil_result, LiteralDatatype_t>::select(),
@@ -560,11 +586,11 @@ DatatypeRegistry::NumericOpsImpl DatatypeRegistry::make_numeric_ops_impl() noexc
 template<datatypes::InlineableLiteralDatatype LiteralDatatype_t>
 DatatypeRegistry::InliningOps DatatypeRegistry::make_inlining_ops() noexcept {
     return InliningOps {
-        .try_into_inlined_fptr = [](std::any const &value) noexcept -> std::optional<uint64_t> {
-            auto const &val = std::any_cast<typename LiteralDatatype_t::cpp_type>(value);
+        .try_into_inlined_fptr = [](AnyValue const &value) noexcept -> std::optional<uint64_t> {
+            auto const &val = value.get<typename LiteralDatatype_t::cpp_type>();
             return LiteralDatatype_t::try_into_inlined(val);
         },
-        .from_inlined_fptr = [](uint64_t inlined_value) noexcept -> std::any {
+        .from_inlined_fptr = [](uint64_t inlined_value) noexcept -> AnyValue {
             return LiteralDatatype_t::from_inlined(inlined_value);
         }};
 }
@@ -0,0 +1,322 @@
+#ifndef RDF4CPP_REGISTRY_INLINEDNUMERICOPS_HPP
+#define RDF4CPP_REGISTRY_INLINEDNUMERICOPS_HPP
+
+#include <rdf4cpp/rdf/datatypes/LiteralDatatype.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/DatatypeConversion.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/DatatypeRegistry.hpp>
+#include <rdf4cpp/rdf/datatypes/xsd.hpp>
+#include <rdf4cpp/rdf/storage/node/identifier/LiteralType.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+/**
+ * Statically dispatched numeric binary operations for inlined values of fixed id numeric datatypes.
+ *
+ * For every pair of numeric fixed ids the common type of the operands is determined at compile time by the same search
+ * that DatatypeRegistry::get_common_numeric_op_type_conversion performs at runtime. The generated functions work
+ * directly on the inlined bits of both operands and produce the inlined bits of the result, so neither the registry nor AnyValue is involved.
+ */
+namespace rdf4cpp::rdf::datatypes::registry::inlined_numeric_ops {
+
+/**
+ * The numeric fixed id datatypes, the datatype at index i has the fixed id LiteralType::from_parts(true, i)
+ */
+using numeric_types = mz::type_list<xsd::Float,
+                                    xsd::Double,
+                                    xsd::Decimal,
+                                    xsd::Integer,
+                                    xsd::NonPositiveInteger,
+                                    xsd::Long,
+                                    xsd::NonNegativeInteger,
+                                    xsd::NegativeInteger,
+                                    xsd::Int,
+                                    xsd::UnsignedLong,
+                                    xsd::PositiveInteger,
+                                    xsd::Short,
+                                    xsd::UnsignedInt,
+                                    xsd::Byte,
+                                    xsd::UnsignedShort,
+                                    xsd::UnsignedByte>;
+
+static_assert([]<size_t... ixs>(std::index_sequence<ixs...>) {
+    return ((numeric_types::select<ixs>::fixed_id == storage::node::identifier::LiteralType::from_parts(true, ixs)) && ...);
+}(std::make_index_sequence<numeric_types::length>{}), "numeric_types must be ordered by fixed id");
+
+/**
+ * The result of an operation on inlined values
+ */
+struct InlinedValue {
+    storage::node::identifier::LiteralType datatype;
+    uint64_t value;
+};
+
+/**
+ * @return the result of the operation or std::nullopt if the operation failed
+ *      or its result cannot be inlined. In both cases the operation needs to be retried using the DatatypeRegistry.
+ */
+using binop_fptr_t = std::optional<InlinedValue> (*)(uint64_t lhs, uint64_t rhs) noexcept;
+
+/**
+ * Binary operations for a pair of operand types, named like the ones in DatatypeRegistry::NumericOpsImpl
+ * so that the same operation selectors can be used for both.
+ * A function pointer is nullptr if the operation is not available on inlined values for this pair.
+ */
+struct NumericBinOps {
+    binop_fptr_t add_fptr = nullptr;  // a + b
+    binop_fptr_t sub_fptr = nullptr;  // a - b
+    binop_fptr_t mul_fptr = nullptr;  // a * b
+    binop_fptr_t div_fptr = nullptr;  // a / b
+};
+
+namespace detail {
+
+/**
+ * The shape of a compile-time ConversionTable and the target type of every entry,
+ * in a form that can be indexed with runtime values during constant evaluation.
+ */
+struct ConversionTableShape {
+    static constexpr size_t max_rank = 8;
+
+    size_t s_rank;
+    std::array<size_t, max_rank> p_ranks;
+    std::array<std::array<std::string_view, max_rank>, max_rank> targets;
+};
+
+template<ConversionTable Table>
+consteval ConversionTableShape make_table_shape() {
+    static_assert(Table::length <= ConversionTableShape::max_rank);
+
+    ConversionTableShape shape{};
+    shape.s_rank = Table::length;
+
+    [&]<size_t... s_offs>(std::index_sequence<s_offs...>) {
+        ([&]<size_t s_off>() {
+            using layer_t = typename Table::template select<s_off>;
+            static_assert(layer_t::length <= ConversionTableShape::max_rank);
+
+            shape.p_ranks[s_off] = layer_t::length;
+            [&]<size_t... p_offs>(std::index_sequence<p_offs...>) {
+                ((shape.targets[s_off][p_offs] = std::string_view{layer_t::template select<p_offs>::target_type::identifier}), ...);
+            }(std::make_index_sequence<layer_t::length>{});
+        }.template operator()<s_offs>(), ...);
+    }(std::make_index_sequence<Table::length>{});
+
+    return shape;
+}
+
+/**
+ * Indices of the conversions to the common type in the conversion tables of both operands
+ */
+struct CommonConversionIndices {
+    size_t lhs_s_off;
+    size_t lhs_p_off;
+    size_t rhs_s_off;
+    size_t rhs_p_off;
+};
+
+/**
+ * Compile-time version of DatatypeRegistry::get_common_type_conversion, must be kept in sync with it
+ */
+consteval std::optional<CommonConversionIndices> find_common_conversion(ConversionTableShape const &lhs, ConversionTableShape const &rhs,
+                                                                        size_t const lhs_init_soff, size_t const rhs_init_soff) {
+    auto const find_conv_impl = [](ConversionTableShape const &lesser, ConversionTableShape const &greater,
+                                   size_t const lesser_init_soff, size_t const greater_init_soff) -> std::optional<CommonConversionIndices> {
+        auto const lesser_s_rank = lesser.s_rank - lesser_init_soff;
+        auto const greater_s_rank = greater.s_rank - greater_init_soff;
+
+        size_t lesser_s_off = lesser_init_soff;
+        size_t greater_s_off = greater_init_soff + greater_s_rank - lesser_s_rank;
+
+        while (lesser_s_off < lesser.s_rank && greater_s_off < greater.s_rank) {
+            auto const lesser_p_rank = lesser.p_ranks[lesser_s_off];
+            auto const greater_p_rank = greater.p_ranks[greater_s_off];
+
+            auto const [lesser_p_off, greater_p_off] = lesser_p_rank < greater_p_rank
+                                                               ? std::make_pair(size_t{0}, greater_p_rank - lesser_p_rank)
+                                                               : std::make_pair(lesser_p_rank - greater_p_rank, size_t{0});
+
+            if (lesser_p_off < lesser_p_rank && greater_p_off < greater_p_rank
+                && lesser.targets[lesser_s_off][lesser_p_off] == greater.targets[greater_s_off][greater_p_off]) {
+                return CommonConversionIndices{lesser_s_off, lesser_p_off, greater_s_off, greater_p_off};
+            }
+
+            lesser_s_off += 1;
+            greater_s_off += 1;
+        }
+
+        return std::nullopt;
+    };
+
+    if (lhs.s_rank - lhs_init_soff < rhs.s_rank - rhs_init_soff) {
+        return find_conv_impl(lhs, rhs, lhs_init_soff, rhs_init_soff);
+    }
+
+    auto const res = find_conv_impl(rhs, lhs, rhs_init_soff, lhs_init_soff);
+    if (!res.has_value()) {
+        return std::nullopt;
+    }
+
+    return CommonConversionIndices{res->rhs_s_off, res->rhs_p_off, res->lhs_s_off, res->lhs_p_off};
+}
+
+template<NumericLiteralDatatype T, ConversionTable Table>
+consteval size_t numeric_init_soff() {
+    if constexpr (NumericStubLiteralDatatype<T>) {
+        return *conversion_detail::calculate_subtype_offset<typename T::numeric_impl_type, Table>();
+    } else {
+        return 0;
+    }
+}
+
+/**
+ * The conversions of Lhs and Rhs to their common type for numeric operations
+ */
+template<NumericLiteralDatatype Lhs, NumericLiteralDatatype Rhs>
+struct CommonNumericConversion {
+    using lhs_table = decltype(make_conversion_table_for<Lhs>());
+    using rhs_table = decltype(make_conversion_table_for<Rhs>());
+
+    static constexpr std::optional<CommonConversionIndices> indices = find_common_conversion(make_table_shape<lhs_table>(), make_table_shape<rhs_table>(),
+                                                                                              numeric_init_soff<Lhs, lhs_table>(), numeric_init_soff<Rhs, rhs_table>());
+};
+
+template<NumericLiteralDatatype Lhs, NumericLiteralDatatype Rhs>
+    requires (CommonNumericConversion<Lhs, Rhs>::indices.has_value())
+struct CommonNumericConversionEntries {
+    static constexpr CommonConversionIndices indices = *CommonNumericConversion<Lhs, Rhs>::indices;
+
+    using lhs = typename CommonNumericConversion<Lhs, Rhs>::lhs_table::template select<indices.lhs_s_off>::template select<indices.lhs_p_off>;
+    using rhs = typename CommonNumericConversion<Lhs, Rhs>::rhs_table::template select<indices.rhs_s_off>::template select<indices.rhs_p_off>;
+    using common_type = typename lhs::target_type;
+};
+
+// a + b
+template<NumericImplLiteralDatatype T>
+struct add_op {
+    using result_type = typename registry::detail::SelectOpRes<typename T::add_result, T>::type;
+
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::add(lhs, rhs);
+    }
+};
+
+// a - b
+template<NumericImplLiteralDatatype T>
+struct sub_op {
+    using result_type = typename registry::detail::SelectOpRes<typename T::sub_result, T>::type;
+
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::sub(lhs, rhs);
+    }
+};
+
+// a * b
+template<NumericImplLiteralDatatype T>
+struct mul_op {
+    using result_type = typename registry::detail::SelectOpRes<typename T::mul_result, T>::type;
+
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::mul(lhs, rhs);
+    }
+};
+
+// a / b
+template<NumericImplLiteralDatatype T>
+struct div_op {
+    using result_type = typename registry::detail::SelectOpRes<typename T::div_result, T>::type;
+
+    static auto apply(typename T::cpp_type const &lhs, typename T::cpp_type const &rhs) noexcept {
+        return T::div(lhs, rhs);
+    }
+};
+
+template<InlineableLiteralDatatype Lhs, InlineableLiteralDatatype Rhs, template<typename> typename Op>
+std::optional<InlinedValue> inlined_binop(uint64_t const lhs, uint64_t const rhs) noexcept {
+    using conversions = CommonNumericConversionEntries<Lhs, Rhs>;
+    using op = Op<typename conversions::common_type>;
+
+    auto const result = op::apply(conversions::lhs::convert(Lhs::from_inlined(lhs)),
+                                  conversions::rhs::convert(Rhs::from_inlined(rhs)));
+
+    if (!result.has_value()) {
+        return std::nullopt;
+    }
+
+    auto const inlined = op::result_type::try_into_inlined(*result);
+    if (!inlined.has_value()) {
+        return std::nullopt;
+    }
+
+    return InlinedValue{.datatype = op::result_type::fixed_id, .value = *inlined};
+}
+
+template<typename Lhs, typename Rhs, template<typename> typename Op>
+consteval binop_fptr_t make_inlined_binop() {
+    using result_type = typename Op<typename CommonNumericConversionEntries<Lhs, Rhs>::common_type>::result_type;
+
+    if constexpr (InlineableLiteralDatatype<result_type>) {
+        return &inlined_binop<Lhs, Rhs, Op>;
+    } else {
+        // result can never be inlined, e.g. xsd:decimal for a division of integers
+        return nullptr;
+    }
+}
+
+template<typename Lhs, typename Rhs>
+consteval NumericBinOps make_numeric_binops() {
+    if constexpr (InlineableLiteralDatatype<Lhs> && InlineableLiteralDatatype<Rhs>) {
+        if constexpr (CommonNumericConversion<Lhs, Rhs>::indices.has_value()) {
+            static_assert(NumericImplLiteralDatatype<typename CommonNumericConversionEntries<Lhs, Rhs>::common_type>,
+                          "common type of numeric datatypes must be impl-numeric");
+
+            return NumericBinOps{.add_fptr = make_inlined_binop<Lhs, Rhs, add_op>(),
+                                 .sub_fptr = make_inlined_binop<Lhs, Rhs, sub_op>(),
+                                 .mul_fptr = make_inlined_binop<Lhs, Rhs, mul_op>(),
+                                 .div_fptr = make_inlined_binop<Lhs, Rhs, div_op>()};
+        }
+    }
+
+    return NumericBinOps{};
+}
+
+/**
+ * Operations for every pair of numeric fixed ids, indexed by lhs_type_id * numeric_types::length + rhs_type_id
+ */
+inline constexpr auto numeric_binops = []<size_t... ixs>(std::index_sequence<ixs...>) {
+    return std::array<NumericBinOps, sizeof...(ixs)>{
+            make_numeric_binops<typename numeric_types::template select<ixs / numeric_types::length>,
+                                typename numeric_types::template select<ixs % numeric_types::length>>()...};
+}(std::make_index_sequence<numeric_types::length * numeric_types::length>{});
+
+}  // namespace detail
+
+/**
+ * @param lhs_type literal type of the lhs operand
+ * @param rhs_type literal type of the rhs operand
+ * @return the operations for inlined operands of the given types or nullptr if
+ *      both types are not numeric fixed ids
+ */
+inline NumericBinOps const *get_numeric_binops(storage::node::identifier::LiteralType const lhs_type,
+                                               storage::node::identifier::LiteralType const rhs_type) noexcept {
+    if (!lhs_type.is_numeric() || !rhs_type.is_numeric()) {
+        return nullptr;
+    }
+
+    auto const lhs_ix = lhs_type.type_id();
+    auto const rhs_ix = rhs_type.type_id();
+
+    if (lhs_ix >= numeric_types::length || rhs_ix >= numeric_types::length) {
+        return nullptr;
+    }
+
+    return &detail::numeric_binops[lhs_ix * numeric_types::length + rhs_ix];
+}
+
+}  // namespace rdf4cpp::rdf::datatypes::registry::inlined_numeric_ops
+
+#endif  //RDF4CPP_REGISTRY_INLINEDNUMERICOPS_HPP
@@ -5,6 +5,7 @@
 #include <rdf4cpp/rdf/datatypes/registry/DatatypeMapping.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/DatatypeRegistry.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/FixedIdMappings.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/util/CharConvExt.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/util/ConstexprString.hpp>
 #include <rdf4cpp/rdf/datatypes/registry/util/Inlining.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/LiteralID.hpp>
@@ -65,16 +66,37 @@ struct Default {
         // If this implementation is used the user forgot to provide their own.
         static_assert(detail::always_false_v<cpp_type>, "'from_string' is not implemented for this type!");
     }
+
+    /**
+     * Non-throwing version of from_string.
+     * If not further specified, it is implemented by catching the exception thrown by from_string.
+     * Datatypes that are parsed frequently should specialize it to avoid the cost of exception unwinding for malformed input.
+     * @return instance of datatype_t or DynamicError::InvalidValueForCast (or DynamicError::OverOrUnderFlow) if the string is not a valid lexical form
+     */
+    inline static nonstd::expected<cpp_type, DynamicError> try_from_string(std::string_view s) noexcept {
+        try {
+            return from_string(s);
+        } catch (std::exception const &) {
+            return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+        }
+    }
+
     /**
      * Returns string representation of a datatype_t.
      * @param value the value
      * @return <div>value</div>'s canonical string representation
      */
     inline static std::string to_canonical_string(cpp_type const &value) noexcept {
-        // If not further specified, to_canonical_string is instantiated via operator<<. If operator<< is not defined for cpp_type instantiation will fail.
-        std::stringstream str_s;
-        str_s << value;
-        return str_s.str();
+        if constexpr (std::integral<cpp_type> && sizeof(cpp_type) > 1) {
+            // same output as operator<<, but without going through iostreams
+            // (bool and character types are excluded, operator<< does not print them as numbers)
+            return util::to_chars_canonical(value);
+        } else {
+            // If not further specified, to_canonical_string is instantiated via operator<<. If operator<< is not defined for cpp_type instantiation will fail.
+            std::stringstream str_s;
+            str_s << value;
+            return str_s.str();
+        }
     }
 
     /**
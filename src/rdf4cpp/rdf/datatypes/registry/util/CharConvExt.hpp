@@ -1,6 +1,8 @@
 #ifndef RDF4CPP_REGISTRY_CHARCONVEXT_HPP
 #define RDF4CPP_REGISTRY_CHARCONVEXT_HPP
 
+#include <rdf4cpp/rdf/datatypes/LiteralDatatype.hpp>
+
 #include <algorithm>
 #include <cassert>
 #include <charconv>
@@ -8,51 +10,127 @@
 #include <concepts>
 #include <stdexcept>
 
+#include <nonstd/expected.hpp>
+
 namespace rdf4cpp::rdf::datatypes::registry::util {
 
+namespace detail  {
 /**
- * Parses a valid string representation of a integral number
+ * equivalent to static_cast<size_t>(1 + std::log10(value))
+ * only exists because the above is not a constexpr in clang
+ */
+template<typename T>
+constexpr size_t log10ceil(T const value) noexcept {
+    if (value < 10) {
+        return 1;
+    }
+    return 1 + log10ceil(value / 10);
+}
+} // namespace detail
+
+/**
+ * The maximum number of chars that to_chars_canonical(value, first) writes for a value of type T.
+ */
+template<typename T>
+inline constexpr size_t to_chars_canonical_max_size = []() {
+    if constexpr (std::floating_point<T>) {
+        // +1 for minus in mantissa
+        // +1 for integral part
+        // +1 for dot
+        // +1 for E
+        // +1 for minus in exponent
+        // at least 2 for exponent because the (c++) standard says so (https://en.cppreference.com/w/cpp/utility/to_chars)
+        return 5 + std::numeric_limits<T>::max_digits10 + std::max(2ul, detail::log10ceil(std::numeric_limits<T>::max_exponent10));
+    } else {
+        static_assert(std::integral<T>);
+        // +1 because of definition of digits10 https://en.cppreference.com/w/cpp/types/numeric_limits/digits10
+        // +1 for sign
+        return std::numeric_limits<T>::digits10 + 1 + static_cast<size_t>(std::is_signed_v<T>);
+    }
+}();
+
+/**
+ * Parses a string representation of a integral number without throwing
  *
  * @tparam I the resulting integral type
  * @param s the string to be parsed
- * @return the resulting value
- * @throws std::runtime_error if the string cannot be parsed
+ * @return the resulting value or DynamicError::InvalidValueForCast if the string is not a valid integer
+ *      or DynamicError::OverOrUnderFlow if the value does not fit into I
  */
 template<std::integral I>
-I from_chars(std::string_view s) {
+nonstd::expected<I, DynamicError> try_from_chars(std::string_view s) noexcept {
     if (s.starts_with('+')) {
         // from_chars does not allow initial +
         s.remove_prefix(1);
+
+        if (s.starts_with('-')) [[unlikely]] {
+            return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+        }
     }
 
     I value;
     auto const res = std::from_chars(s.data(), s.data() + s.size(), value);
 
-    if (res.ec != std::errc{} || res.ptr != s.data() + s.size()) {
-        throw std::runtime_error{"xsd integer parsing error: " + std::make_error_code(res.ec).message()};
-    } else {
-        return value;
+    if (res.ec == std::errc::result_out_of_range) [[unlikely]] {
+        return nonstd::make_unexpected(DynamicError::OverOrUnderFlow);
     }
+
+    if (res.ec != std::errc{} || res.ptr != s.data() + s.size()) [[unlikely]] {
+        return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+    }
+
+    return value;
 }
 
 /**
- * Serializes an integral type into its (SPARQL) _canonical_ representation.
+ * Parses a valid string representation of a integral number
+ *
+ * @tparam I the resulting integral type
+ * @param s the string to be parsed
+ * @return the resulting value
+ * @throws std::runtime_error if the string cannot be parsed
+ */
+template<std::integral I>
+I from_chars(std::string_view s) {
+    auto const value = try_from_chars<I>(s);
+
+    if (!value.has_value()) {
+        throw std::runtime_error{value.error() == DynamicError::OverOrUnderFlow
+                                         ? "xsd integer parsing error: value out of range"
+                                         : "xsd integer parsing error: invalid lexical form"};
+    }
+
+    return *value;
+}
+
+/**
+ * Serializes an integral type into its (SPARQL) _canonical_ representation into a caller provided buffer.
  * see https://www.w3.org/TR/2004/REC-xmlschema-2-20041028/#dt-integer
  *
  * @param value the value to be serialized
+ * @param first start of the output buffer, must have space for at least to_chars_canonical_max_size<I> chars
+ * @return pointer one past the last written char
  */
 template<std::integral I>
-std::string to_chars_canonical(I const value) noexcept {
-    // +1 because of definition of digits10 https://en.cppreference.com/w/cpp/types/numeric_limits/digits10
-    // +1 for sign
-    static constexpr size_t buf_sz = std::numeric_limits<I>::digits10 + 1 + static_cast<size_t>(std::is_signed_v<I>);
+char *to_chars_canonical(I const value, char *first) noexcept {
+    std::to_chars_result const res = std::to_chars(first, first + to_chars_canonical_max_size<I>, value);
+    assert(res.ec == std::errc{});
 
-    std::array<char, buf_sz> buf;
-    std::to_chars_result const res = std::to_chars(buf.data(), buf.data() + buf.size(), value);
+    return res.ptr;
+}
 
-    assert(res.ec == std::errc{});
+/**
+ * Serializes an integral type into its (SPARQL) _canonical_ representation.
+ * see https://www.w3.org/TR/2004/REC-xmlschema-2-20041028/#dt-integer
+ *
+ * @param value the value to be serialized
+ */
+template<std::integral I>
+std::string to_chars_canonical(I const value) noexcept {
+    std::array<char, to_chars_canonical_max_size<I>> buf;
+    char const *last = to_chars_canonical(value, buf.data());
 
-    return std::string{buf.data(), static_cast<std::string::size_type>(res.ptr - buf.data())};
+    return std::string{buf.data(), static_cast<std::string::size_type>(last - buf.data())};
 }
 
 /**
@@ -70,87 +148,101 @@ std::string to_chars_simplified(I const value) noexcept {
 }
 
 /**
- * Parses a valid string representation of a floating point number
+ * Parses a string representation of a floating point number without throwing
  *
  * @tparam F the result floating point type
  * @param s the string to be parsed
- * @return the resulting value
- * @throws std::runtime_error if the string cannot be parsed
+ * @return the resulting value or DynamicError::InvalidValueForCast if the string is not a valid floating point number
+ *      or DynamicError::OverOrUnderFlow if the value is not representable by F
  */
 template<std::floating_point F>
-F from_chars(std::string_view s) {
+nonstd::expected<F, DynamicError> try_from_chars(std::string_view s) noexcept {
     if (s.starts_with('+')) {
         // from_chars does not allow initial +
         s.remove_prefix(1);
+
+        if (s.starts_with('-')) [[unlikely]] {
+            return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+        }
     }
 
     F value;
     std::from_chars_result const res = std::from_chars(s.data(), s.data() + s.size(), value, std::chars_format::general);
 
-    if (res.ec != std::errc{} || res.ptr != s.data() + s.size()) {
+    if (res.ec == std::errc::result_out_of_range) [[unlikely]] {
+        return nonstd::make_unexpected(DynamicError::OverOrUnderFlow);
+    }
+
+    if (res.ec != std::errc{} || res.ptr != s.data() + s.size()) [[unlikely]] {
         // parsing did not reach end of string => it contains invalid characters
-        throw std::runtime_error{"xsd floating point parsing error: " + std::make_error_code(res.ec).message()};
+        return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
     }
 
     return value;
 }
 
-namespace detail  {
 /**
- * equivalent to static_cast<size_t>(1 + std::log10(value))
- * only exists because the above is not a constexpr in clang
+ * Parses a valid string representation of a floating point number
+ *
+ * @tparam F the result floating point type
+ * @param s the string to be parsed
+ * @return the resulting value
+ * @throws std::runtime_error if the string cannot be parsed
  */
-template<typename T>
-constexpr size_t log10ceil(T const value) noexcept {
-    if (value < 10) {
-        return 1;
+template<std::floating_point F>
+F from_chars(std::string_view s) {
+    auto const value = try_from_chars<F>(s);
+
+    if (!value.has_value()) {
+        throw std::runtime_error{value.error() == DynamicError::OverOrUnderFlow
+                                         ? "xsd floating point parsing error: value out of range"
+                                         : "xsd floating point parsing error: invalid lexical form"};
     }
-    return 1 + log10ceil(value / 10);
+
+    return *value;
 }
-} // namespace detail
 
 /**
- * Serializes a floating point number into its (SPARQL) _canonical_ string representation.
- * This is always scientific notation.
+ * Serializes a floating point number into its (SPARQL) _canonical_ string representation into a caller provided buffer.
+ * This is always scientific notation with the shortest mantissa that round-trips.
  * see https://www.w3.org/TR/2004/REC-xmlschema-2-20041028/#dt-float
  *
  * @param value the value to be serialized
+ * @param first start of the output buffer, must have space for at least to_chars_canonical_max_size<F> chars
+ * @return pointer one past the last written char
  */
 template<std::floating_point F>
-std::string to_chars_canonical(F const value) noexcept {
+char *to_chars_canonical(F const value, char *first) noexcept {
+    auto const write = [first](std::string_view const s) noexcept {
+        return std::copy(s.begin(), s.end(), first);
+    };
+
     if (std::isnan(value)) {
-        return "NaN";
+        return write("NaN");
     }
 
     if (std::isinf(value)) {
         if (value > 0) {
-            return "INF";
+            return write("INF");
         } else {
-            return "-INF";
+            return write("-INF");
         }
     }
 
-    // +1 for minus in mantissa
-    // +1 for integral part
-    // +1 for dot
-    // +1 for E
-    // +1 for minus in exponent
-    // at least 2 for exponent because the (c++) standard says so (https://en.cppreference.com/w/cpp/utility/to_chars)
-    static constexpr size_t buf_sz = 5 + std::numeric_limits<F>::max_digits10 + std::max(2ul, detail::log10ceil(std::numeric_limits<F>::max_exponent10));
-    std::array<char, buf_sz> buf;
+    char *const buf_end = first + to_chars_canonical_max_size<F>;
 
-    std::to_chars_result res = std::to_chars(buf.data(), buf.data() + buf.size(), value, std::chars_format::scientific);
+    std::to_chars_result res = std::to_chars(first, buf_end, value, std::chars_format::scientific);
     assert(res.ec == std::errc{});
 
-    auto *e_ptr = std::find(buf.data(), res.ptr, 'e');
+    auto *e_ptr = std::find(first, res.ptr, 'e');
     assert(e_ptr != res.ptr); // serializing in scientific notation, there must be an 'e'
     *e_ptr = 'E'; // convert 'e' to 'E' as required by the SPARQL standard
 
-    if (auto *dot_ptr = buf.data() + 1; dot_ptr == e_ptr) {
+    if (auto *dot_ptr = first + 1 + static_cast<ptrdiff_t>(*first == '-'); dot_ptr == e_ptr) {
         // mantissa is in integer format therefore missing '.0' after mantissa
 
         // make space for '.0' by shifting exponent right
-        std::shift_right(e_ptr, buf.data() + buf.size(), 2);
+        std::shift_right(e_ptr, buf_end, 2);
 
         // write '.0'
         dot_ptr[0] = '.';
@@ -178,7 +270,22 @@ std::string to_chars_canonical(F const value) noexcept {
         res.ptr = std::shift_left(e_ptr + 1 + (1 - shift_off), res.ptr, shift_amt + shift_off); // shift out all leading zeros and plus sign from exponent
     }
 
-    return std::string{buf.data(), static_cast<std::string::size_type>(res.ptr - buf.data())};
+    return res.ptr;
+}
+
+/**
+ * Serializes a floating point number into its (SPARQL) _canonical_ string representation.
+ * This is always scientific notation with the shortest mantissa that round-trips.
+ * see https://www.w3.org/TR/2004/REC-xmlschema-2-20041028/#dt-float
+ *
+ * @param value the value to be serialized
+ */
+template<std::floating_point F>
+std::string to_chars_canonical(F const value) noexcept {
+    std::array<char, to_chars_canonical_max_size<F>> buf;
+    char const *last = to_chars_canonical(value, buf.data());
+
+    return std::string{buf.data(), static_cast<std::string::size_type>(last - buf.data())};
 }
 
 /**
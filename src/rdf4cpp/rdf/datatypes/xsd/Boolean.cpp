@@ -6,12 +6,22 @@ namespace rdf4cpp::rdf::datatypes::registry {
 
 template<>
 capabilities::Default<xsd_boolean>::cpp_type capabilities::Default<xsd_boolean>::from_string(std::string_view s) {
+    auto const value = try_from_string(s);
+    if (!value.has_value()) {
+        throw std::runtime_error{"XSD Parsing Error"};
+    }
+
+    return *value;
+}
+
+template<>
+nonstd::expected<capabilities::Default<xsd_boolean>::cpp_type, DynamicError> capabilities::Default<xsd_boolean>::try_from_string(std::string_view s) noexcept {
     if (s == "true" || s == "1") {
         return true;
     } else if (s == "false" || s == "0") {
         return false;
     } else {
-        throw std::runtime_error{"XSD Parsing Error"};
+        return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
     }
 }
 
@@ -20,6 +20,9 @@ struct DatatypeMapping<xsd_boolean> {
 template<>
 capabilities::Default<xsd_boolean>::cpp_type capabilities::Default<xsd_boolean>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_boolean>::cpp_type, DynamicError> capabilities::Default<xsd_boolean>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_boolean>::to_canonical_string(cpp_type const &value) noexcept;
 
@@ -1,26 +1,64 @@
 #include <rdf4cpp/rdf/datatypes/xsd/Decimal.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
-#include <regex>
 
 namespace rdf4cpp::rdf::datatypes::registry {
 
 template<>
 capabilities::Default<xsd_decimal>::cpp_type capabilities::Default<xsd_decimal>::from_string(std::string_view s) {
-    // https://www.w3.org/TR/xmlschema11-2/#decimal
-    static std::regex const decimal_regex{R"#((\+|-)?([0-9]+(\.[0-9]*)?|\.[0-9]+))#", std::regex_constants::optimize};
-
-    if (!std::regex_match(s.begin(), s.end(), decimal_regex)) {
+    auto value = try_from_string(s);
+    if (!value.has_value()) {
         throw std::runtime_error{"XSD Parsing Error"};
     }
 
-    if (s.starts_with('+')) {
+    return std::move(*value);
+}
+
+template<>
+nonstd::expected<capabilities::Default<xsd_decimal>::cpp_type, DynamicError> capabilities::Default<xsd_decimal>::try_from_string(std::string_view s) noexcept {
+    // https://www.w3.org/TR/xmlschema11-2/#decimal
+    // lexical space: (\+|-)?([0-9]+(\.[0-9]*)?|\.[0-9]+)
+
+    auto const is_digit = [](char const ch) noexcept { return ch >= '0' && ch <= '9'; };
+
+    std::string_view unsigned_part = s;
+    if (unsigned_part.starts_with('+')) {
         s.remove_prefix(1);
+        unsigned_part.remove_prefix(1);
+    } else if (unsigned_part.starts_with('-')) {
+        unsigned_part.remove_prefix(1);
+    }
+
+    auto const dot_pos = unsigned_part.find('.');
+    auto const integral_part = unsigned_part.substr(0, dot_pos);
+    auto const fractional_part = dot_pos == std::string_view::npos ? std::string_view{} : unsigned_part.substr(dot_pos + 1);
+
+    if ((integral_part.empty() && fractional_part.empty())
+        || !std::ranges::all_of(integral_part, is_digit)
+        || !std::ranges::all_of(fractional_part, is_digit)) {
+        return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+    }
+
+    if (fractional_part.empty() && integral_part.size() <= static_cast<size_t>(std::numeric_limits<int64_t>::digits10)) {
+        // integral value that fits into int64_t, avoid going through boost's string parsing
+        int64_t value = 0;
+        for (char const ch : integral_part) {
+            value = value * 10 + (ch - '0');
+        }
+
+        return cpp_type{s.starts_with('-') ? -value : value};
+    }
+
+    cpp_type value{s};
+    if (isinf(value)) [[unlikely]] {
+        return nonstd::make_unexpected(DynamicError::OverOrUnderFlow);
     }
 
-    return cpp_type{s};
+    return value;
 }
 
 template<>
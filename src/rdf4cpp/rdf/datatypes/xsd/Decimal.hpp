@@ -30,6 +30,9 @@ struct DatatypePromotionSpecializationOverride<xsd_decimal> {
 template<>
 capabilities::Default<xsd_decimal>::cpp_type capabilities::Default<xsd_decimal>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_decimal>::cpp_type, DynamicError> capabilities::Default<xsd_decimal>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_decimal>::to_canonical_string(const cpp_type &value) noexcept;
 
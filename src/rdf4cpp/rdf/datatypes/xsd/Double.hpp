@@ -15,6 +15,9 @@ struct DatatypeMapping<xsd_double> {
 template<>
 capabilities::Default<xsd_double>::cpp_type capabilities::Default<xsd_double>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_double>::cpp_type, DynamicError> capabilities::Default<xsd_double>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_double>::to_canonical_string(cpp_type const &value) noexcept;
 
@@ -10,6 +10,11 @@ capabilities::Default<xsd_float>::cpp_type capabilities::Default<xsd_float>::fro
     return util::from_chars<cpp_type>(s);
 }
 
+template<>
+nonstd::expected<capabilities::Default<xsd_float>::cpp_type, DynamicError> capabilities::Default<xsd_float>::try_from_string(std::string_view s) noexcept {
+    return util::try_from_chars<cpp_type>(s);
+}
+
 template<>
 std::string capabilities::Default<xsd_float>::to_canonical_string(cpp_type const &value) noexcept {
     return util::to_chars_canonical(value);
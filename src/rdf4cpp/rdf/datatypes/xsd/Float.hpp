@@ -21,6 +21,9 @@ struct DatatypePromotionMapping<xsd_float> {
 template<>
 capabilities::Default<xsd_float>::cpp_type capabilities::Default<xsd_float>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_float>::cpp_type, DynamicError> capabilities::Default<xsd_float>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_float>::to_canonical_string(cpp_type const &value) noexcept;
 
@@ -27,6 +27,12 @@ struct DatatypeNumericStubMapping<xsd_non_negative_integer> {
 template<>
 capabilities::Default<xsd_non_negative_integer>::cpp_type capabilities::Default<xsd_non_negative_integer>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_non_negative_integer>::cpp_type, DynamicError> capabilities::Default<xsd_non_negative_integer>::try_from_string(std::string_view s) noexcept;
+
+template<>
+std::string capabilities::Default<xsd_non_negative_integer>::to_canonical_string(cpp_type const &value) noexcept;
+
 template<>
 bool capabilities::Logical<xsd_non_negative_integer>::effective_boolean_value(cpp_type const &value) noexcept;
 
@@ -6,19 +6,33 @@ namespace rdf4cpp::rdf::datatypes::registry {
 
 template<>
 capabilities::Default<xsd_positive_integer>::cpp_type capabilities::Default<xsd_positive_integer>::from_string(std::string_view s) {
-    cpp_type ret;
+    auto value = try_from_string(s);
+    if (!value.has_value()) {
+        throw std::runtime_error{value.error() == DynamicError::OverOrUnderFlow
+                                         ? "xsd:positiveInteger parsing error: found non-positive value"
+                                         : "xsd:positiveInteger parsing error: invalid lexical form"};
+    }
+
+    return std::move(*value);
+}
 
-    try {
-        ret = cpp_type{s};
-    } catch (std::runtime_error const &e) {
-        throw std::runtime_error{std::string{"xsd:positiveInteger parsing error: "} + e.what()};
+template<>
+nonstd::expected<capabilities::Default<xsd_positive_integer>::cpp_type, DynamicError> capabilities::Default<xsd_positive_integer>::try_from_string(std::string_view s) noexcept {
+    auto value = capabilities::Default<xsd_integer>::try_from_string(s);
+    if (!value.has_value()) {
+        return value;
     }
 
-    if (ret < 1) {
-        throw std::runtime_error{"xsd:positiveInteger parsing error: found non-positive value"};
+    if (*value < 1) {
+        return nonstd::make_unexpected(DynamicError::OverOrUnderFlow);
     }
 
-    return ret;
+    return value;
+}
+
+template<>
+std::string capabilities::Default<xsd_positive_integer>::to_canonical_string(cpp_type const &value) noexcept {
+    return capabilities::Default<xsd_integer>::to_canonical_string(value);
 }
 
 template<>
@@ -28,6 +28,12 @@ struct DatatypeNumericStubMapping<xsd_positive_integer> {
 template<>
 capabilities::Default<xsd_positive_integer>::cpp_type capabilities::Default<xsd_positive_integer>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_positive_integer>::cpp_type, DynamicError> capabilities::Default<xsd_positive_integer>::try_from_string(std::string_view s) noexcept;
+
+template<>
+std::string capabilities::Default<xsd_positive_integer>::to_canonical_string(cpp_type const &value) noexcept;
+
 template<>
 bool capabilities::Logical<xsd_positive_integer>::effective_boolean_value(cpp_type const &) noexcept;
 
@@ -29,6 +29,9 @@ struct DatatypeNumericStubMapping<xsd_unsigned_short> {
 template<>
 capabilities::Default<xsd_unsigned_short>::cpp_type capabilities::Default<xsd_unsigned_short>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_unsigned_short>::cpp_type, DynamicError> capabilities::Default<xsd_unsigned_short>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_unsigned_short>::to_canonical_string(cpp_type const &value) noexcept;
 
@@ -29,6 +29,9 @@ struct DatatypeNumericStubMapping<xsd_byte> {
 template<>
 capabilities::Default<xsd_byte>::cpp_type capabilities::Default<xsd_byte>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_byte>::cpp_type, DynamicError> capabilities::Default<xsd_byte>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_byte>::to_canonical_string(cpp_type const &value) noexcept;
 
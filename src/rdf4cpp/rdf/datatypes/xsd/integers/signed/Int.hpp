@@ -29,6 +29,9 @@ struct DatatypeNumericStubMapping<xsd_int> {
 template<>
 capabilities::Default<xsd_int>::cpp_type capabilities::Default<xsd_int>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_int>::cpp_type, DynamicError> capabilities::Default<xsd_int>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_int>::to_canonical_string(cpp_type const &value) noexcept;
 
@@ -1,20 +1,69 @@
 #include <rdf4cpp/rdf/datatypes/xsd/integers/signed/Integer.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/util/CharConvExt.hpp>
 
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
 
 namespace rdf4cpp::rdf::datatypes::registry {
 
 template<>
 capabilities::Default<xsd_integer>::cpp_type capabilities::Default<xsd_integer>::from_string(std::string_view s) {
-    if (s.starts_with('+')) {
+    auto value = try_from_string(s);
+    if (!value.has_value()) {
+        throw std::runtime_error{"xsd:integer parsing error: invalid lexical form"};
+    }
+
+    return std::move(*value);
+}
+
+template<>
+nonstd::expected<capabilities::Default<xsd_integer>::cpp_type, DynamicError> capabilities::Default<xsd_integer>::try_from_string(std::string_view s) noexcept {
+    // https://www.w3.org/TR/xmlschema11-2/#integer
+    // lexical space: [\-+]?[0-9]+
+
+    bool const negative = s.starts_with('-');
+    if (negative || s.starts_with('+')) {
         s.remove_prefix(1);
     }
 
-    try {
-        return cpp_type{s};
-    } catch (std::runtime_error const &e) {
-        throw std::runtime_error{std::string{"xsd:integer parsing error: "} + e.what()};
+    if (s.empty() || !std::ranges::all_of(s, [](char const ch) noexcept { return ch >= '0' && ch <= '9'; })) {
+        return nonstd::make_unexpected(DynamicError::InvalidValueForCast);
+    }
+
+    // boost would interpret a leading zero as octal prefix
+    auto const first_non_zero = s.find_first_not_of('0');
+    if (first_non_zero == std::string_view::npos) {
+        return cpp_type{0};
     }
+    s.remove_prefix(first_non_zero);
+
+    if (s.size() <= static_cast<size_t>(std::numeric_limits<int64_t>::digits10)) {
+        // fits into int64_t, avoid going through boost's string parsing
+        int64_t value = 0;
+        for (char const ch : s) {
+            value = value * 10 + (ch - '0');
+        }
+
+        return cpp_type{negative ? -value : value};
+    }
+
+    cpp_type value{s};
+    if (negative) {
+        value.backend().negate();
+    }
+
+    return value;
+}
+
+template<>
+std::string capabilities::Default<xsd_integer>::to_canonical_string(cpp_type const &value) noexcept {
+    if (value >= std::numeric_limits<int64_t>::min() && value <= std::numeric_limits<int64_t>::max()) [[likely]] {
+        // avoid boost's generic conversion for values that fit into a machine word
+        return util::to_chars_canonical(value.convert_to<int64_t>());
+    }
+
+    return value.str();
 }
 
 template<>
@@ -28,6 +28,9 @@ struct DatatypeNumericStubMapping<xsd_long> {
 template<>
 capabilities::Default<xsd_long>::cpp_type capabilities::Default<xsd_long>::from_string(std::string_view s);
 
+template<>
+nonstd::expected<capabilities::Default<xsd_long>::cpp_type, DynamicError> capabilities::Default<xsd_long>::try_from_string(std::string_view s) noexcept;
+
 template<>
 std::string capabilities::Default<xsd_long>::to_canonical_string(cpp_type const &value) noexcept;
 
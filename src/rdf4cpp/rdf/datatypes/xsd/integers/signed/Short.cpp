@@ -8,6 +8,11 @@ capabilities::Default<xsd_short>::cpp_type capabilities::Default<xsd_short>::fro
     return util::from_chars<cpp_type>(s);
 }
 
+template<>
+nonstd::expected<capabilities::Default<xsd_short>::cpp_type, DynamicError> capabilities::Default<xsd_short>::try_from_string(std::string_view s) noexcept {
+    return util::try_from_chars<cpp_type>(s);
+}
+
 template<>
 std::string capabilities::Default<xsd_short>::to_canonical_string(cpp_type const &value) noexcept {
     return util::to_chars_canonical(value);
@@ -0,0 +1,171 @@
+#include <rdf4cpp/rdf/parser/BinarySnapshotReader.hpp>
+
+#include <rdf4cpp/rdf/util/BinarySnapshot.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rdf4cpp::rdf::parser {
+
+namespace {
+
+using namespace util::binary_snapshot;
+using namespace storage::node;
+
+/**
+ * Decodes count front coded strings
+ * @return the decoded strings, they point into arena
+ */
+std::vector<std::string_view> read_front_coded_section(Decoder &dec, uint64_t const count, std::string &arena) {
+    // offset and size into arena, string_views would dangle when arena is reallocated by the next string
+    std::vector<std::pair<size_t, size_t>> spans;
+    spans.reserve(count);
+
+    size_t prev_offset = 0;
+    size_t prev_size = 0;
+    for (uint64_t ix = 0; ix < count; ++ix) {
+        auto const offset = arena.size();
+        dec.read_front_coded(arena, prev_offset, prev_size);
+
+        prev_offset = offset;
+        prev_size = arena.size() - offset;
+        spans.emplace_back(prev_offset, prev_size);
+    }
+
+    // arena is complete now, it is no longer reallocated
+    std::vector<std::string_view> strings;
+    strings.reserve(count);
+    for (auto const &[offset, size] : spans) {
+        strings.push_back(std::string_view{arena}.substr(offset, size));
+    }
+    return strings;
+}
+
+template<typename View>
+void intern(NodeStorage &node_storage, std::vector<View> const &views, identifier::RDFNodeType const type, std::vector<identifier::NodeBackendHandle> &handles) {
+    std::vector<identifier::NodeID> ids(views.size());
+    node_storage.find_or_make_ids(std::span<View const>{views}, std::span{ids});
+
+    for (auto const id : ids) {
+        handles.emplace_back(id, type, node_storage.id());
+    }
+}
+
+}  // namespace
+
+void read_binary_snapshot(std::istream &is, Dataset &dataset) {
+    std::string const data{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+    Decoder dec{.in = data};
+
+    auto const header = dec.read_fixed<Header>();
+    if (header.magic != magic) {
+        throw std::runtime_error{"input is not a binary snapshot"};
+    }
+    if (header.version != version) {
+        throw std::runtime_error{"unsupported binary snapshot version " + std::to_string(header.version)};
+    }
+
+    auto const node_count = header.iri_count + header.bnode_count + header.literal_count;
+    // every node and every quad needs at least one byte or four bits respectively
+    if (header.id_width == 0 || header.id_width > 64 || node_count > data.size() || header.quad_count > 2 * data.size()) {
+        Decoder::truncated();
+    }
+
+    auto &node_storage = dataset.backend().node_storage();
+
+    std::vector<identifier::NodeBackendHandle> handles;  // local id -> handle
+    handles.reserve(node_count);
+
+    std::string iri_arena;
+    auto const iris = read_front_coded_section(dec, header.iri_count, iri_arena);
+    {
+        std::vector<view::IRIBackendView> views;
+        views.reserve(iris.size());
+        for (auto const iri : iris) {
+            views.push_back(view::IRIBackendView{.identifier = iri});
+        }
+        intern(node_storage, views, identifier::RDFNodeType::IRI, handles);
+    }
+
+    std::string bnode_arena;
+    auto const bnodes = read_front_coded_section(dec, header.bnode_count, bnode_arena);
+    {
+        std::vector<view::BNodeBackendView> views;
+        views.reserve(bnodes.size());
+        for (auto const bnode : bnodes) {
+            views.push_back(view::BNodeBackendView{.identifier = bnode});
+        }
+        intern(node_storage, views, identifier::RDFNodeType::BNode, handles);
+    }
+
+    {
+        // Literals that are stored lexically are interned in one batch, the others need the registry
+        std::vector<view::LiteralBackendView> lexical_views;
+        std::vector<uint64_t> lexical_local_ids;
+        std::vector<identifier::NodeID> lexical_ids;
+
+        for (uint64_t ix = 0; ix < header.literal_count; ++ix) {
+            auto const kind = dec.read_fixed<LiteralKind>();
+            auto const datatype_local_id = dec.read_varint();
+            auto const lexical_form = dec.read_string();
+            auto const language_tag = dec.read_string();
+
+            if (datatype_local_id >= header.iri_count) {
+                Decoder::truncated();
+            }
+
+            auto const datatype_handle = handles[datatype_local_id];
+            auto const datatype_id = datatype_handle.node_id();
+            auto const literal_type = identifier::iri_node_id_to_literal_type(datatype_id);
+
+            if (kind == LiteralKind::Lexical && !node_storage.has_specialized_storage_for(literal_type)) {
+                lexical_views.push_back(view::LexicalFormLiteralBackendView{.datatype_id = datatype_id,
+                                                                            .lexical_form = lexical_form,
+                                                                            .language_tag = language_tag});
+                lexical_local_ids.push_back(handles.size());
+                handles.emplace_back();  // filled in below
+            } else if (!language_tag.empty()) {
+                handles.push_back(Literal::make_lang_tagged(lexical_form, language_tag, node_storage).backend_handle());
+            } else {
+                handles.push_back(Literal::make_typed(lexical_form, IRI{datatype_handle}, node_storage).backend_handle());
+            }
+        }
+
+        lexical_ids.resize(lexical_views.size());
+        node_storage.find_or_make_ids(std::span<view::LiteralBackendView const>{lexical_views}, std::span{lexical_ids});
+        for (size_t ix = 0; ix < lexical_ids.size(); ++ix) {
+            handles[lexical_local_ids[ix]] = identifier::NodeBackendHandle{lexical_ids[ix], identifier::RDFNodeType::Literal, node_storage.id()};
+        }
+    }
+
+    auto const word_count = word_count_for(4 * header.quad_count * header.id_width);
+    if ((data.size() - dec.pos) / sizeof(uint64_t) < word_count) {
+        Decoder::truncated();
+    }
+
+    std::vector<uint64_t> words(word_count);
+    std::memcpy(words.data(), data.data() + dec.pos, word_count * sizeof(uint64_t));
+
+    uint64_t bit_pos = 0;
+    for (uint64_t ix = 0; ix < header.quad_count; ++ix) {
+        Quad quad;
+        for (auto &node : quad) {
+            auto const local_id = unpack(words.data(), bit_pos, header.id_width);
+            bit_pos += header.id_width;
+
+            if (local_id >= handles.size()) {
+                Decoder::truncated();
+            }
+            node.backend_handle() = handles[local_id];
+        }
+
+        dataset.add(quad);
+    }
+}
+
+}  // namespace rdf4cpp::rdf::parser
@@ -0,0 +1,22 @@
+#ifndef RDF4CPP_PARSER_BINARYSNAPSHOTREADER_HPP
+#define RDF4CPP_PARSER_BINARYSNAPSHOTREADER_HPP
+
+#include <rdf4cpp/rdf/Dataset.hpp>
+
+#include <istream>
+
+namespace rdf4cpp::rdf::parser {
+
+/**
+ * Loads a snapshot written by writer::BinarySnapshotWriter into dataset.
+ * All nodes are interned into the NodeStorage of dataset in batches (see NodeStorage::find_or_make_ids), then all quads are added to dataset.
+ *
+ * @param is stream to read from, should be opened in binary mode
+ * @param dataset dataset to add the quads to
+ * @throws std::runtime_error if the input is not a valid snapshot
+ */
+void read_binary_snapshot(std::istream &is, Dataset &dataset);
+
+}  // namespace rdf4cpp::rdf::parser
+
+#endif  //RDF4CPP_PARSER_BINARYSNAPSHOTREADER_HPP
@@ -15,8 +15,13 @@ IStreamQuadIterator::IStreamQuadIterator(std::default_sentinel_t) noexcept
     : impl{nullptr} {
 }
 
-IStreamQuadIterator::IStreamQuadIterator(std::istream &istream, ParsingFlags flags, prefix_storage_type prefixes, storage::node::NodeStorage node_storage) noexcept
-    : impl{std::make_unique<Impl>(istream, flags, std::move(prefixes), std::move(node_storage))} {
+IStreamQuadIterator::IStreamQuadIterator(std::istream &istream, ParsingFlags flags, prefix_storage_type prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept
+    : impl{std::make_unique<Impl>(istream, flags, std::move(prefixes), std::move(node_storage), syntax)} {
+    ++*this;
+}
+
+IStreamQuadIterator::IStreamQuadIterator(std::string_view buffer, ParsingFlags flags, prefix_storage_type prefixes, storage::node::NodeStorage node_storage, ParsingSyntax syntax) noexcept
+    : impl{std::make_unique<Impl>(buffer, flags, std::move(prefixes), std::move(node_storage), syntax)} {
     ++*this;
 }
 
@@ -40,6 +45,18 @@ IStreamQuadIterator &IStreamQuadIterator::operator++() {
     return *this;
 }
 
+size_t IStreamQuadIterator::next_batch(std::vector<Quad> &out, size_t max) {
+    if (max == 0 || this->is_at_end() || !this->cur.has_value()) {
+        return 0;
+    }
+
+    out.push_back(std::move(*this->cur));
+    auto const n = 1 + this->impl->next_batch(out, max - 1);
+
+    ++*this;
+    return n;
+}
+
 bool IStreamQuadIterator::operator==(IStreamQuadIterator const &other) const noexcept {
     return (this->is_at_end() && other.is_at_end()) || this->impl == other.impl;
 }
@@ -3,20 +3,23 @@
 
 #include <iterator>
 #include <memory>
+#include <string_view>
+#include <vector>
 
 #include <nonstd/expected.hpp>
 
 #include <rdf4cpp/rdf/Quad.hpp>
 #include <rdf4cpp/rdf/parser/ParsingError.hpp>
 #include <rdf4cpp/rdf/parser/ParsingFlags.hpp>
-#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/parser/ParsingSyntax.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
 #include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
 
 namespace rdf4cpp::rdf::parser {
 
 /**
  * Similar to std::istream_iterator<>.
- * Parses the given istream and tries to extract Quads given in TURTLE format.
+ * Parses the given istream and tries to extract Quads given in TURTLE format (or in N-Quads format, see ParsingSyntax).
  *
  * @note the iterator _starts on_ the first Quad
  * @note An exhausted iterator becomes the end-of-stream iterator.
@@ -46,7 +49,7 @@ struct IStreamQuadIterator {
     using prefix_storage_type = rdf4cpp::rdf::storage::util::tsl::sparse_map<
             std::string,
             std::string,
-            rdf4cpp::rdf::storage::util::robin_hood::hash<std::string_view>,
+            rdf4cpp::rdf::storage::util::wyhash::hash<std::string_view>,
             std::equal_to<>>;
 
 private:
@@ -75,13 +78,36 @@ public:
 
     explicit IStreamQuadIterator(std::istream &istream, ParsingFlags flags = ParsingFlags::none(),
                                  prefix_storage_type prefixes = {},
-                                 storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance()) noexcept;
+                                 storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance(),
+                                 ParsingSyntax syntax = ParsingSyntax::Turtle) noexcept;
+
+    /**
+     * Parses the given in-memory buffer directly instead of reading from an std::istream, e.g. a memory mapped file.
+     * @param buffer input, must outlive this iterator
+     */
+    explicit IStreamQuadIterator(std::string_view buffer, ParsingFlags flags = ParsingFlags::none(),
+                                 prefix_storage_type prefixes = {},
+                                 storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance(),
+                                 ParsingSyntax syntax = ParsingSyntax::Turtle) noexcept;
+
     ~IStreamQuadIterator() noexcept;
 
     reference operator*() const noexcept;
     pointer operator->() const noexcept;
     IStreamQuadIterator &operator++();
 
+    /**
+     * Appends the current Quad and up to max - 1 following Quads to out, as if by repeatedly dereferencing and incrementing
+     * but without the per-Quad overhead. Afterwards this is positioned on the element following the last appended Quad.
+     *
+     * Stops early on a ParsingError, without consuming it. The error can then be inspected via operator* and skipped with operator++.
+     *
+     * @param out buffer to append to, reserving capacity upfront avoids reallocations
+     * @param max maximum number of Quads to append
+     * @return number of Quads appended to out, 0 iff max == 0, this is the end-of-stream iterator or this is positioned on an error
+     */
+    size_t next_batch(std::vector<Quad> &out, size_t max);
+
     bool operator==(IStreamQuadIterator const &) const noexcept;
     bool operator!=(IStreamQuadIterator const &) const noexcept;
 };
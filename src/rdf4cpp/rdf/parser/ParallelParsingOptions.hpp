@@ -0,0 +1,42 @@
+#ifndef RDF4CPP_PARSER_PARALLELPARSINGOPTIONS_HPP
+#define RDF4CPP_PARSER_PARALLELPARSINGOPTIONS_HPP
+
+#include <rdf4cpp/rdf/parser/ParsingSyntax.hpp>
+
+#include <cstddef>
+
+namespace rdf4cpp::rdf::parser {
+
+/**
+ * Configures how RDFFileParser parses a file in parallel.
+ * The file is split into chunks at line boundaries and the chunks are parsed concurrently, each by its own parser.
+ *
+ * @warning Only suitable for line-based formats, i.e. N-Triples and N-Quads.
+ *      Statements spanning multiple lines may be split between chunks and prefixes are only known within the chunk that declares them.
+ */
+struct ParallelParsingOptions {
+    /**
+     * Number of parser threads. 0 means std::thread::hardware_concurrency().
+     */
+    size_t num_threads = 0;
+
+    /**
+     * Approximate number of bytes per chunk. Chunks are extended to the next line boundary.
+     */
+    size_t chunk_size = 4 * 1024 * 1024;
+
+    /**
+     * If true, Quads (and errors) are yielded in the order they appear in the file.
+     * If false, chunks are yielded as soon as they are parsed, which avoids waiting for slow chunks. The order within a chunk is preserved.
+     */
+    bool ordered = true;
+
+    /**
+     * Syntax of every chunk. N-Quads also accepts N-Triples, statements without a graph term are in the default graph.
+     */
+    ParsingSyntax syntax = ParsingSyntax::NQuads;
+};
+
+}  // namespace rdf4cpp::rdf::parser
+
+#endif  //RDF4CPP_PARSER_PARALLELPARSINGOPTIONS_HPP
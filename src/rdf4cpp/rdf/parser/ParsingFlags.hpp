@@ -9,6 +9,7 @@ namespace rdf4cpp::rdf::parser {
 enum struct ParsingFlag : uint8_t {
     Strict = 1 << 0,
     NoParsePrefix = 1 << 1,
+    MemoryMapped = 1 << 2,  ///< only used by RDFFileParser: read the file through a memory mapping instead of std::ifstream
 };
 
 struct ParsingFlags {
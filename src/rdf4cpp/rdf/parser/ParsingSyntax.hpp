@@ -0,0 +1,18 @@
+#ifndef RDF4CPP_PARSER_PARSINGSYNTAX_HPP
+#define RDF4CPP_PARSER_PARSINGSYNTAX_HPP
+
+#include <cstdint>
+
+namespace rdf4cpp::rdf::parser {
+
+/**
+ * The RDF syntax a parser reads.
+ */
+enum struct ParsingSyntax : uint8_t {
+    Turtle,  ///< Turtle, including N-Triples
+    NQuads,  ///< N-Quads, including N-Triples. Statements may have a graph term, prefixes and base directives are not allowed
+};
+
+}  // namespace rdf4cpp::rdf::parser
+
+#endif  //RDF4CPP_PARSER_PARSINGSYNTAX_HPP
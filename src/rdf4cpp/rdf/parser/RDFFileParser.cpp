@@ -1,4 +1,8 @@
 #include <rdf4cpp/rdf/parser/RDFFileParser.hpp>
+#include <rdf4cpp/rdf/parser/MappedFile.hpp>
+#include <rdf4cpp/rdf/parser/ParallelChunkParser.hpp>
+
+#include <utility>
 
 namespace rdf4cpp::rdf::parser {
 RDFFileParser::RDFFileParser(const std::string &file_path, ParsingFlags flags,
@@ -9,10 +13,28 @@ RDFFileParser::RDFFileParser(std::string &&file_path, ParsingFlags flags,
                                                    rdf4cpp::rdf::storage::node::NodeStorage node_storage)
     : file_path_(std::move(file_path)), flags_(flags), node_storage_(std::move(node_storage)) {
 }
+RDFFileParser::RDFFileParser(const std::string &file_path, ParallelParsingOptions parallel_options, ParsingFlags flags,
+                             rdf4cpp::rdf::storage::node::NodeStorage node_storage)
+    : file_path_(file_path), flags_(flags), node_storage_(std::move(node_storage)), parallel_options_(parallel_options) {
+}
+RDFFileParser::RDFFileParser(std::string &&file_path, ParallelParsingOptions parallel_options, ParsingFlags flags,
+                             rdf4cpp::rdf::storage::node::NodeStorage node_storage)
+    : file_path_(std::move(file_path)), flags_(flags), node_storage_(std::move(node_storage)), parallel_options_(parallel_options) {
+}
 RDFFileParser::Iterator RDFFileParser::begin() const {
+    if (flags_.contains(ParsingFlag::MemoryMapped)) {
+        if (auto mapping = MappedFile::open(file_path_); mapping != nullptr) {
+            if (parallel_options_.has_value())
+                return {std::move(mapping), *parallel_options_, flags_, node_storage_};
+            return {std::move(mapping), flags_, node_storage_};
+        }
+    }
+
     std::ifstream stream{file_path_};
     if (!stream.is_open())
         return {};
+    if (parallel_options_.has_value())
+        return {std::move(stream), *parallel_options_, flags_, node_storage_};
     return {std::move(stream), flags_, node_storage_};
 }
 std::default_sentinel_t RDFFileParser::end() const noexcept {
@@ -27,21 +49,67 @@ RDFFileParser::Iterator::Iterator(std::ifstream &&stream, ParsingFlags flags,
     : stream_(std::make_unique<std::ifstream>(std::move(stream))),
       iter_(std::make_unique<IStreamQuadIterator>(*stream_, flags, IStreamQuadIterator::prefix_storage_type{}, node_storage)) {
 }
+RDFFileParser::Iterator::Iterator(std::ifstream &&stream, ParallelParsingOptions const &parallel_options, ParsingFlags flags,
+                                  const rdf4cpp::rdf::storage::node::NodeStorage &node_storage)
+    : stream_(nullptr),
+      iter_(nullptr),
+      parallel_(std::make_unique<ParallelChunkParser>(std::make_unique<std::ifstream>(std::move(stream)), parallel_options, flags, node_storage)),
+      parallel_cur_(parallel_->next()) {
+}
+RDFFileParser::Iterator::Iterator(std::unique_ptr<MappedFile> &&mapping, ParsingFlags flags,
+                                  const rdf4cpp::rdf::storage::node::NodeStorage &node_storage)
+    : stream_(nullptr),
+      mapping_(std::move(mapping)),
+      iter_(std::make_unique<IStreamQuadIterator>(mapping_->view(), flags, IStreamQuadIterator::prefix_storage_type{}, node_storage)) {
+}
+RDFFileParser::Iterator::Iterator(std::unique_ptr<MappedFile> &&mapping, ParallelParsingOptions const &parallel_options, ParsingFlags flags,
+                                  const rdf4cpp::rdf::storage::node::NodeStorage &node_storage)
+    : stream_(nullptr),
+      mapping_(std::move(mapping)),
+      iter_(nullptr),
+      parallel_(std::make_unique<ParallelChunkParser>(mapping_->view(), parallel_options, flags, node_storage)),
+      parallel_cur_(parallel_->next()) {
+}
+RDFFileParser::Iterator::Iterator(Iterator &&other) noexcept = default;
+RDFFileParser::Iterator &RDFFileParser::Iterator::operator=(Iterator &&other) noexcept {
+    if (this != &other) {
+        // the parsers read from mapping_ and stream_, stop them before their input is released
+        parallel_.reset();
+        iter_.reset();
+        mapping_ = std::move(other.mapping_);
+        stream_ = std::move(other.stream_);
+        iter_ = std::move(other.iter_);
+        parallel_ = std::move(other.parallel_);
+        parallel_cur_ = std::exchange(other.parallel_cur_, nullptr);
+    }
+    return *this;
+}
+RDFFileParser::Iterator::~Iterator() noexcept = default;
 RDFFileParser::Iterator::reference RDFFileParser::Iterator::operator*() const noexcept {
+    if (parallel_ != nullptr)
+        return *parallel_cur_;
     return (*iter_).operator*();
 }
 RDFFileParser::Iterator::pointer RDFFileParser::Iterator::operator->() const noexcept {
+    if (parallel_ != nullptr)
+        return parallel_cur_;
     return (*iter_).operator->();
 }
 RDFFileParser::Iterator &RDFFileParser::Iterator::operator++() {
+    if (parallel_ != nullptr) {
+        parallel_cur_ = parallel_->next();
+        return *this;
+    }
     ++(*iter_);
     return *this;
 }
 bool RDFFileParser::Iterator::operator==(const RDFFileParser::Iterator &other) const noexcept {
-    return iter_ == other.iter_;
+    return iter_ == other.iter_ && parallel_ == other.parallel_;
 }
 bool operator==(const RDFFileParser::Iterator &iter, std::default_sentinel_t s) noexcept {
-    if (iter.stream_ == nullptr)
+    if (iter.parallel_ != nullptr)
+        return iter.parallel_cur_ == nullptr;
+    if (iter.iter_ == nullptr)
         return true;
     return (*iter.iter_) == s;
 }
@@ -2,9 +2,15 @@
 #define RDF4CPP_RDFFILEPARSER_HPP
 
 #include <rdf4cpp/rdf/parser/IStreamQuadIterator.hpp>
+#include <rdf4cpp/rdf/parser/ParallelParsingOptions.hpp>
 #include <fstream>
+#include <optional>
 
 namespace rdf4cpp::rdf::parser {
+
+struct ParallelChunkParser;
+struct MappedFile;
+
 /**
      * Similar to rdf4cpp::rdf::parser::IStreamQuadIterator
      * Parses the file by the given path and tries to extract Quads given in TURTLE format.
@@ -22,11 +28,16 @@ namespace rdf4cpp::rdf::parser {
      *     std::cout << e.error();
      * }
      * @endcode
+     *
+     * N-Triples and N-Quads files can be parsed in parallel by providing ParallelParsingOptions.
+     * With ParsingFlag::MemoryMapped the file is memory mapped and the parser reads directly from the mapping instead of going through std::ifstream.
+     * If the file cannot be mapped (e.g. because it is not a regular file) it is read through std::ifstream as usual.
      */
 class RDFFileParser {
     std::string file_path_;
     ParsingFlags flags_;
     storage::node::NodeStorage node_storage_;
+    std::optional<ParallelParsingOptions> parallel_options_;
 
 public:
     explicit RDFFileParser(const std::string &file_path, ParsingFlags flags = ParsingFlags::none(),
@@ -34,14 +45,32 @@ public:
     explicit RDFFileParser(std::string &&file_path, ParsingFlags flags = ParsingFlags::none(),
                            storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance());
 
+    /**
+     * Parses the file in parallel, see ParallelParsingOptions. The file must be in N-Triples or N-Quads format.
+     * @param file_path path of the file
+     * @param parallel_options number of threads, chunk size, syntax and whether the Quads are yielded in order
+     * @param flags flags for parsing
+     * @param node_storage NodeStorage that is shared by all parser threads, its backend must be thread-safe
+     */
+    RDFFileParser(const std::string &file_path, ParallelParsingOptions parallel_options, ParsingFlags flags = ParsingFlags::none(),
+                  storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance());
+    RDFFileParser(std::string &&file_path, ParallelParsingOptions parallel_options, ParsingFlags flags = ParsingFlags::none(),
+                  storage::node::NodeStorage node_storage = storage::node::NodeStorage::default_instance());
+
     class Iterator {
         friend class RDFFileParser;
         friend bool operator==(const RDFFileParser::Iterator &iter, std::default_sentinel_t) noexcept;
         std::unique_ptr<std::ifstream> stream_;
+        std::unique_ptr<MappedFile> mapping_;
         std::unique_ptr<IStreamQuadIterator> iter_;
+        std::unique_ptr<ParallelChunkParser> parallel_;
+        IStreamQuadIterator::value_type const *parallel_cur_ = nullptr;
 
         Iterator();
         Iterator(std::ifstream &&stream, ParsingFlags flags, const storage::node::NodeStorage &node_storage);
+        Iterator(std::ifstream &&stream, ParallelParsingOptions const &parallel_options, ParsingFlags flags, const storage::node::NodeStorage &node_storage);
+        Iterator(std::unique_ptr<MappedFile> &&mapping, ParsingFlags flags, const storage::node::NodeStorage &node_storage);
+        Iterator(std::unique_ptr<MappedFile> &&mapping, ParallelParsingOptions const &parallel_options, ParsingFlags flags, const storage::node::NodeStorage &node_storage);
 
     public:
         using value_type = IStreamQuadIterator::value_type;
@@ -51,6 +80,10 @@ public:
         using iterator_category = IStreamQuadIterator::iterator_category;
         using istream_type = IStreamQuadIterator::istream_type;
 
+        Iterator(Iterator &&other) noexcept;
+        Iterator &operator=(Iterator &&other) noexcept;
+        ~Iterator() noexcept;
+
         reference operator*() const noexcept;
         pointer operator->() const noexcept;
         Iterator &operator++();
@@ -0,0 +1,252 @@
+#include "BasicGraphPattern.hpp"
+
+#include <rdf4cpp/rdf/Dataset.hpp>
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
+
+#include <algorithm>
+#include <limits>
+#include <span>
+
+namespace rdf4cpp::rdf::query {
+
+namespace bgp_detail {
+
+static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+/**
+ * A pattern of the basic graph pattern with its variables resolved to slots.
+ */
+struct PlannedPattern {
+    QuadPattern pattern;
+    /**
+     * slot of the i-th variable of pattern, i.e. of the i-th entry of its Solutions
+     */
+    std::vector<size_t> slots;
+    /**
+     * position of the first entry of pattern's Solutions with the same slot as the i-th entry,
+     * a variable that occurs more than once must be bound to the same node at every occurrence
+     */
+    std::vector<size_t> first_occurrence;
+    size_t estimate;
+};
+
+static uint64_t join_hash(std::span<Node const> const row, std::span<size_t const> const join_slots) noexcept {
+    uint64_t hash = 0;
+    for (auto const slot : join_slots) {
+        hash ^= storage::util::robin_hood::hash_int(row[slot].backend_handle().raw()) + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+static bool join_equal(std::span<Node const> const lhs, std::span<Node const> const rhs, std::span<size_t const> const join_slots) noexcept {
+    return std::all_of(join_slots.begin(), join_slots.end(), [&](size_t const slot) {
+        return lhs[slot].backend_handle() == rhs[slot].backend_handle();
+    });
+}
+
+}  // namespace bgp_detail
+
+BasicGraphPattern::BasicGraphPattern(std::vector<QuadPattern> patterns) : patterns_{std::move(patterns)} {
+    for (auto const &quad_pattern : patterns_) {
+        add_variables(quad_pattern);
+    }
+}
+
+BasicGraphPattern::BasicGraphPattern(std::vector<TriplePattern> const &patterns, Node graph) {
+    patterns_.reserve(patterns.size());
+    for (auto const &triple_pattern : patterns) {
+        add(triple_pattern, graph);
+    }
+}
+
+void BasicGraphPattern::add_variables(QuadPattern const &quad_pattern) {
+    for (auto const &entry : quad_pattern) {
+        if (entry.is_variable() and std::find(variables_.begin(), variables_.end(), entry) == variables_.end()) {
+            variables_.push_back(entry.as_variable());
+        }
+    }
+}
+
+void BasicGraphPattern::add(QuadPattern const &quad_pattern) {
+    patterns_.push_back(quad_pattern);
+    add_variables(quad_pattern);
+}
+
+void BasicGraphPattern::add(TriplePattern const &triple_pattern, Node graph) {
+    add(QuadPattern{graph, triple_pattern.subject(), triple_pattern.predicate(), triple_pattern.object()});
+}
+
+std::vector<QuadPattern> const &BasicGraphPattern::patterns() const noexcept {
+    return patterns_;
+}
+
+std::vector<Variable> const &BasicGraphPattern::variables() const noexcept {
+    return variables_;
+}
+
+std::vector<Solution> BasicGraphPattern::evaluate(Dataset const &dataset) const {
+    using namespace bgp_detail;
+
+    size_t const width = variables_.size();
+
+    // plan: resolve variables to slots and estimate every pattern
+    std::vector<PlannedPattern> planned;
+    planned.reserve(patterns_.size());
+    for (auto const &quad_pattern : patterns_) {
+        PlannedPattern plan{quad_pattern, {}, {}, dataset.estimate_cardinality(quad_pattern)};
+        if (plan.estimate == 0) {
+            return {};
+        }
+
+        for (auto const &entry : quad_pattern) {
+            if (entry.is_variable()) {
+                auto const slot = static_cast<size_t>(std::distance(variables_.begin(), std::find(variables_.begin(), variables_.end(), entry)));
+                auto const first = std::find(plan.slots.begin(), plan.slots.end(), slot);
+                plan.first_occurrence.push_back(static_cast<size_t>(std::distance(plan.slots.begin(), first)));
+                plan.slots.push_back(slot);
+            }
+        }
+        planned.push_back(std::move(plan));
+    }
+
+    // order: the pattern with the smallest estimate first, then always the smallest one that shares a variable with the joined ones
+    std::vector<bool> bound(width, false);
+    std::vector<PlannedPattern const *> order;
+    order.reserve(planned.size());
+    {
+        std::vector<bool> done(planned.size(), false);
+        std::vector<bool> bound_while_planning(width, false);
+        for (size_t step = 0; step < planned.size(); ++step) {
+            size_t best = npos;
+            bool best_connected = false;
+            for (size_t ix = 0; ix < planned.size(); ++ix) {
+                if (done[ix]) {
+                    continue;
+                }
+                bool const connected = std::any_of(planned[ix].slots.begin(), planned[ix].slots.end(),
+                                                   [&](size_t const slot) { return bound_while_planning[slot]; });
+                if (best == npos or (connected and not best_connected) or
+                    (connected == best_connected and planned[ix].estimate < planned[best].estimate)) {
+                    best = ix;
+                    best_connected = connected;
+                }
+            }
+
+            done[best] = true;
+            for (auto const slot : planned[best].slots) {
+                bound_while_planning[slot] = true;
+            }
+            order.push_back(&planned[best]);
+        }
+    }
+
+    // execute: intermediate results are rows of width nodes, stored contiguously. Initially there is a single empty row.
+    std::vector<Node> rows(width);
+    size_t row_count = 1;
+
+    std::vector<Node> candidate(width);
+    std::vector<size_t> join_slots;
+    std::vector<size_t> new_slots;
+    storage::util::tsl::sparse_map<uint64_t, size_t> heads;
+    std::vector<size_t> next;
+
+    for (auto const *plan : order) {
+        join_slots.clear();
+        new_slots.clear();
+        for (size_t pos = 0; pos < plan->slots.size(); ++pos) {
+            if (plan->first_occurrence[pos] != pos) {
+                continue;
+            }
+            (bound[plan->slots[pos]] ? join_slots : new_slots).push_back(plan->slots[pos]);
+        }
+
+        auto const row = [&rows, width](size_t const ix) {
+            return std::span<Node const>{rows.data() + ix * width, width};
+        };
+
+        // build: chain the rows with equal join hashes
+        heads.clear();
+        next.assign(row_count, npos);
+        if (not join_slots.empty()) {
+            for (size_t ix = 0; ix < row_count; ++ix) {
+                auto [it, inserted] = heads.try_emplace(join_hash(row(ix), join_slots), ix);
+                if (not inserted) {
+                    next[ix] = it->second;
+                    it.value() = ix;
+                }
+            }
+        }
+
+        std::vector<Node> joined;
+        size_t joined_count = 0;
+        auto const emit = [&](size_t const ix) {
+            auto const matching = row(ix);
+            joined.insert(joined.end(), matching.begin(), matching.end());
+            for (auto const slot : new_slots) {
+                joined[joined_count * width + slot] = candidate[slot];
+            }
+            ++joined_count;
+        };
+
+        // probe: with the solutions of the pattern
+        auto const solutions = dataset.match(plan->pattern);
+        for (auto const &solution : solutions) {
+            bool consistent = true;
+            for (size_t pos = 0; pos < plan->slots.size(); ++pos) {
+                if (plan->first_occurrence[pos] != pos and solution[pos].backend_handle() != solution[plan->first_occurrence[pos]].backend_handle()) {
+                    consistent = false;
+                    break;
+                }
+                candidate[plan->slots[pos]] = solution[pos];
+            }
+            if (not consistent) {
+                continue;
+            }
+
+            if (join_slots.empty()) {
+                for (size_t ix = 0; ix < row_count; ++ix) {
+                    emit(ix);
+                }
+                continue;
+            }
+
+            auto const head = heads.find(join_hash(candidate, join_slots));
+            if (head == heads.end()) {
+                continue;
+            }
+            for (size_t ix = head->second; ix != npos; ix = next[ix]) {
+                if (join_equal(row(ix), candidate, join_slots)) {
+                    emit(ix);
+                }
+            }
+        }
+
+        rows = std::move(joined);
+        row_count = joined_count;
+        if (row_count == 0) {
+            return {};
+        }
+        for (auto const slot : new_slots) {
+            bound[slot] = true;
+        }
+    }
+
+    std::vector<Variable> variables;
+    variables.reserve(width);
+    for (auto const &variable : variables_) {
+        variables.push_back(variable.to_node_storage(dataset.backend().node_storage()));
+    }
+
+    std::vector<Solution> ret;
+    ret.reserve(row_count);
+    for (size_t ix = 0; ix < row_count; ++ix) {
+        auto &solution = ret.emplace_back(variables);
+        for (size_t slot = 0; slot < width; ++slot) {
+            solution[slot] = rows[ix * width + slot];
+        }
+    }
+    return ret;
+}
+
+}  // namespace rdf4cpp::rdf::query
@@ -0,0 +1,68 @@
+#ifndef RDF4CPP_BASICGRAPHPATTERN_HPP
+#define RDF4CPP_BASICGRAPHPATTERN_HPP
+
+#include <rdf4cpp/rdf/IRI.hpp>
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/query/Solution.hpp>
+#include <rdf4cpp/rdf/query/TriplePattern.hpp>
+#include <rdf4cpp/rdf/query/Variable.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace rdf4cpp::rdf {
+class Dataset;
+}  // namespace rdf4cpp::rdf
+
+namespace rdf4cpp::rdf::query {
+
+/**
+ * <div>BasicGraphPattern</div> is modeled around SPARQL basic graph patterns: a set of <div>QuadPattern</div>s whose solutions
+ * must agree on all variables they share.
+ *
+ * evaluate() plans the join before touching any solutions. Every variable is resolved to a slot index, so intermediate
+ * results are flat rows of nodes instead of Solutions. The patterns are ordered greedily by
+ * IDatasetBackend::estimate_cardinality, preferring patterns that share a variable with the ones joined before,
+ * and are combined with hash joins on their shared variables.
+ *
+ * @see <https://www.w3.org/TR/sparql11-query/#BasicGraphPatterns>
+ */
+class BasicGraphPattern {
+    std::vector<QuadPattern> patterns_;
+    std::vector<Variable> variables_;
+
+    void add_variables(QuadPattern const &quad_pattern);
+
+public:
+    BasicGraphPattern() = default;
+    explicit BasicGraphPattern(std::vector<QuadPattern> patterns);
+
+    /**
+     * @param patterns patterns to be matched within graph
+     * @param graph graph name or a Variable, by default the default graph
+     */
+    explicit BasicGraphPattern(std::vector<TriplePattern> const &patterns, Node graph = IRI::default_graph());
+
+    void add(QuadPattern const &quad_pattern);
+    void add(TriplePattern const &triple_pattern, Node graph = IRI::default_graph());
+
+    [[nodiscard]] std::vector<QuadPattern> const &patterns() const noexcept;
+
+    /**
+     * @return all variables of the patterns in order of their first occurrence, i.e. the variables of every Solution of evaluate()
+     */
+    [[nodiscard]] std::vector<Variable> const &variables() const noexcept;
+
+    /**
+     * Evaluates the basic graph pattern against dataset.
+     * Unlike Dataset::match, a variable that occurs more than once in a pattern must be bound to the same node at every occurrence.
+     *
+     * @param dataset dataset to be queried
+     * @return all solutions, each binding variables() in this order. An empty basic graph pattern has a single empty solution.
+     */
+    [[nodiscard]] std::vector<Solution> evaluate(Dataset const &dataset) const;
+};
+
+}  // namespace rdf4cpp::rdf::query
+
+#endif  //RDF4CPP_BASICGRAPHPATTERN_HPP
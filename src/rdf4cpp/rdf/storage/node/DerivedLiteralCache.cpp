@@ -0,0 +1,92 @@
+#include "DerivedLiteralCache.hpp"
+
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <thread>
+
+namespace rdf4cpp::rdf::storage::node {
+
+DerivedLiteralCache::DerivedLiteralCache(size_t const capacity)
+    : slots_{std::make_unique<Slot[]>(std::bit_ceil(std::max(capacity, size_t{1})))},
+      mask_{std::bit_ceil(std::max(capacity, size_t{1})) - 1} {
+}
+
+size_t DerivedLiteralCache::capacity() const noexcept {
+    return mask_ + 1;
+}
+
+size_t DerivedLiteralCache::slot_index(Key const &key) const noexcept {
+    auto h = util::robin_hood::hash_int(key.input.raw());
+    h ^= util::robin_hood::hash_int(key.arg + static_cast<uint64_t>(key.op) * UINT64_C(0x9e3779b97f4a7c15));
+    h *= UINT64_C(0xc4ceb9fe1a85ec53);
+    return (h ^ (h >> 33U)) & mask_;
+}
+
+std::optional<identifier::NodeBackendHandle> DerivedLiteralCache::lookup(Key const &key) const noexcept {
+    auto const &slot = slots_[slot_index(key)];
+
+    auto const seq = slot.seq.load(std::memory_order_acquire);
+    if (seq & 1) {
+        // slot is currently being written
+        return std::nullopt;
+    }
+
+    auto const input = slot.input.load(std::memory_order_relaxed);
+    auto const op = slot.op.load(std::memory_order_relaxed);
+    auto const arg = slot.arg.load(std::memory_order_relaxed);
+    auto const result = slot.result.load(std::memory_order_relaxed);
+
+    // make sure the loads above are not reordered after the validating load below
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (slot.seq.load(std::memory_order_relaxed) != seq) {
+        // slot was overwritten while reading
+        return std::nullopt;
+    }
+
+    if (input != key.input.raw() || op != static_cast<uint64_t>(key.op) || arg != key.arg) {
+        return std::nullopt;
+    }
+
+    return identifier::NodeBackendHandle::from_raw(result);
+}
+
+void DerivedLiteralCache::insert(Key const &key, identifier::NodeBackendHandle const result) noexcept {
+    assert(!key.input.null());
+    auto &slot = slots_[slot_index(key)];
+
+    auto seq = slot.seq.load(std::memory_order_relaxed);
+    if ((seq & 1) || !slot.seq.compare_exchange_strong(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+        // another thread is writing to this slot, just drop this entry
+        return;
+    }
+
+    // make sure the stores below are not reordered before the seq increment above
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.input.store(key.input.raw(), std::memory_order_relaxed);
+    slot.op.store(static_cast<uint64_t>(key.op), std::memory_order_relaxed);
+    slot.arg.store(key.arg, std::memory_order_relaxed);
+    slot.result.store(result.raw(), std::memory_order_relaxed);
+    slot.seq.store(seq + 2, std::memory_order_release);
+}
+
+void DerivedLiteralCache::clear() noexcept {
+    for (size_t ix = 0; ix <= mask_; ++ix) {
+        auto &slot = slots_[ix];
+
+        auto seq = slot.seq.load(std::memory_order_relaxed);
+        while ((seq & 1) || !slot.seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            // an insert is in progress, it is going to finish shortly
+            std::this_thread::yield();
+            seq = slot.seq.load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.input.store(0, std::memory_order_relaxed);
+        slot.seq.store(seq + 2, std::memory_order_release);
+    }
+}
+
+}  // namespace rdf4cpp::rdf::storage::node
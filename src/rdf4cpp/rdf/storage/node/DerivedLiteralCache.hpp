@@ -0,0 +1,101 @@
+#ifndef RDF4CPP_DERIVEDLITERALCACHE_HPP
+#define RDF4CPP_DERIVEDLITERALCACHE_HPP
+
+#include <rdf4cpp/rdf/storage/node/identifier/NodeBackendHandle.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace rdf4cpp::rdf::storage::node {
+
+/**
+ * A bounded memo cache for literals that are derived from other literals, e.g. by Literal::uppercase or Literal::cast.
+ * It maps (input, operation, argument) to the handle of the result, so that repeated derivations
+ * skip both computing the result and looking it up in the NodeStorage.
+ *
+ * The cache is direct-mapped: every key has exactly one slot and inserting a key evicts whatever was in its slot before.
+ * Each slot is protected by a sequence lock, so lookup and insert are lock-free and can be called concurrently from any number of threads.
+ * An insert that races with another insert on the same slot is simply dropped.
+ */
+class DerivedLiteralCache {
+public:
+    /**
+     * The derivations that can be cached
+     */
+    enum struct Operation : uint64_t {
+        UpperCase,
+        LowerCase,
+        LexicalForm,
+        StrLen,
+        MD5,
+        SHA1,
+        SHA256,
+        SHA384,
+        SHA512,
+        Cast,  ///< argument is the raw handle of the target datatype IRI
+    };
+
+    struct Key {
+        identifier::NodeBackendHandle input;
+        Operation op;
+        uint64_t arg = 0;
+    };
+
+private:
+    struct Slot {
+        /**
+         * odd while the slot is being written, incremented by 2 for every completed write
+         */
+        std::atomic<uint64_t> seq{0};
+        /**
+         * raw input handle, 0 if the slot is empty
+         */
+        std::atomic<uint64_t> input{0};
+        std::atomic<uint64_t> op{0};
+        std::atomic<uint64_t> arg{0};
+        std::atomic<uint64_t> result{0};
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+
+    [[nodiscard]] size_t slot_index(Key const &key) const noexcept;
+
+public:
+    /**
+     * Constructs an empty cache
+     * @param capacity number of slots, rounded up to the next power of two
+     */
+    explicit DerivedLiteralCache(size_t capacity);
+
+    /**
+     * @return number of slots in the cache
+     */
+    [[nodiscard]] size_t capacity() const noexcept;
+
+    /**
+     * Lookup the result for key
+     * @return the result if it is currently cached, std::nullopt otherwise
+     */
+    [[nodiscard]] std::optional<identifier::NodeBackendHandle> lookup(Key const &key) const noexcept;
+
+    /**
+     * Stores result as the result for key, evicting the previous entry in its slot.
+     * If another thread is concurrently writing to the same slot, nothing is stored.
+     * @pre !key.input.null()
+     */
+    void insert(Key const &key, identifier::NodeBackendHandle result) noexcept;
+
+    /**
+     * Removes all entries from the cache.
+     * Lookups and inserts that run concurrently with clear may or may not observe entries that were cached before.
+     */
+    void clear() noexcept;
+};
+
+}  // namespace rdf4cpp::rdf::storage::node
+
+#endif  //RDF4CPP_DERIVEDLITERALCACHE_HPP
@@ -1,6 +1,7 @@
 #ifndef RDF4CPP_INODESTORAGEBACKEND_HPP
 #define RDF4CPP_INODESTORAGEBACKEND_HPP
 
+#include <rdf4cpp/rdf/storage/node/DerivedLiteralCache.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/NodeID.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/NodeStorageID.hpp>
 #include <rdf4cpp/rdf/storage/node/view/BNodeBackendView.hpp>
@@ -9,9 +10,12 @@
 #include <rdf4cpp/rdf/storage/node/view/VariableBackendView.hpp>
 
 #include <atomic>
+#include <cassert>
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <mutex>
+#include <span>
 
 namespace rdf4cpp::rdf::storage::node {
 
@@ -21,6 +25,14 @@ class NodeStorage;
  * Interface that must be implemented by any NodeStorageBackendImplementation. A reference implementation is available with reference_node_storage::ReferenceNodeStorageBackend..
  */
 class INodeStorageBackend {
+    friend class NodeStorage;
+
+    /**
+     * Cache for derived literals, managed by NodeStorage::enable_derived_literal_cache.
+     * nullptr if disabled.
+     */
+    std::unique_ptr<DerivedLiteralCache> derived_literal_cache_;
+
 public:
     INodeStorageBackend() noexcept = default;
     virtual ~INodeStorageBackend() noexcept = default;
@@ -63,6 +75,49 @@ public:
       */
     [[nodiscard]] virtual identifier::NodeID find_or_make_id(view::VariableBackendView const &view) noexcept = 0;
 
+    /**
+     * Backend for NodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>).
+     * The default implementation calls find_or_make_id for each view. Implementations may override it to amortize synchronization over the whole batch.
+     * @param views Describe requested nodes. Can be expected to be valid.
+     * @param out_ids Output for the identifier::NodeIDs. Must have the same size as views, out_ids[i] identifies views[i].
+     */
+    virtual void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+        assert(views.size() == out_ids.size());
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            out_ids[ix] = find_or_make_id(views[ix]);
+        }
+    }
+    /**
+     * Backend for NodeStorage::find_or_make_ids(std::span<view::IRIBackendView const>, std::span<identifier::NodeID>).
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    virtual void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+        assert(views.size() == out_ids.size());
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            out_ids[ix] = find_or_make_id(views[ix]);
+        }
+    }
+    /**
+     * Backend for NodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const>, std::span<identifier::NodeID>).
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    virtual void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+        assert(views.size() == out_ids.size());
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            out_ids[ix] = find_or_make_id(views[ix]);
+        }
+    }
+    /**
+     * Backend for NodeStorage::find_or_make_ids(std::span<view::VariableBackendView const>, std::span<identifier::NodeID>).
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    virtual void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+        assert(views.size() == out_ids.size());
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            out_ids[ix] = find_or_make_id(views[ix]);
+        }
+    }
+
     /**
       * Backend for NodeStorage::find_id(view::BNodeBackendView const &) const
       * @param view Describes requested node. Can be expected to be valid.
@@ -109,6 +109,19 @@ NodeStorage NodeStorage::register_backend(INodeStorageBackend *&&backend_instanc
     throw std::runtime_error{"Maximum number of backend instances exceeded"};
 }
 
+INodeStorageBackend &NodeStorage::borrow_backend(identifier::NodeStorageID id) {
+    /**
+     * The caller guarantees that a NodeStorage keeps the backend alive, so no reference needs to be taken.
+     * The acquire-load synchronizes with the release-store in register_backend, so the backend is fully constructed.
+     */
+    auto *backend = get_slot(id).backend.load(std::memory_order_acquire);
+    if (backend == nullptr) [[unlikely]] {
+        throw std::runtime_error{"There is no backend at the given NodeStorageID"};
+    }
+
+    return *backend;
+}
+
 std::optional<NodeStorage> NodeStorage::lookup_instance(identifier::NodeStorageID id) {
     auto &slot = get_slot(id);
 
@@ -238,13 +251,21 @@ bool NodeStorage::has_specialized_storage_for(identifier::LiteralType datatype)
     return this->cached_backend_ptr->has_specialized_storage_for(datatype);
 }
 bool NodeStorage::has_specialized_storage_for(identifier::NodeStorageID id, identifier::LiteralType datatype) noexcept {
-    auto ns = lookup_instance(id);
-    return ns.value().has_specialized_storage_for(datatype);
+    return borrow_backend(id).has_specialized_storage_for(datatype);
 }
 
 identifier::NodeStorageID NodeStorage::id() const noexcept {
     return this->backend_index;
 }
+void NodeStorage::enable_derived_literal_cache(size_t const capacity) {
+    this->cached_backend_ptr->derived_literal_cache_ = std::make_unique<DerivedLiteralCache>(capacity);
+}
+void NodeStorage::disable_derived_literal_cache() noexcept {
+    this->cached_backend_ptr->derived_literal_cache_.reset();
+}
+DerivedLiteralCache *NodeStorage::derived_literal_cache() const noexcept {
+    return this->cached_backend_ptr->derived_literal_cache_.get();
+}
 identifier::NodeID NodeStorage::find_or_make_id(const view::BNodeBackendView &view) noexcept {
     return this->cached_backend_ptr->find_or_make_id(view);
 }
@@ -257,6 +278,18 @@ identifier::NodeID NodeStorage::find_or_make_id(const view::LiteralBackendView &
 identifier::NodeID NodeStorage::find_or_make_id(const view::VariableBackendView &view) noexcept {
     return this->cached_backend_ptr->find_or_make_id(view);
 }
+void NodeStorage::find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    this->cached_backend_ptr->find_or_make_ids(views, out_ids);
+}
+void NodeStorage::find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    this->cached_backend_ptr->find_or_make_ids(views, out_ids);
+}
+void NodeStorage::find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    this->cached_backend_ptr->find_or_make_ids(views, out_ids);
+}
+void NodeStorage::find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    this->cached_backend_ptr->find_or_make_ids(views, out_ids);
+}
 identifier::NodeID NodeStorage::find_id(const view::BNodeBackendView &view) const noexcept {
     return this->cached_backend_ptr->find_id(view);
 }
@@ -282,25 +315,28 @@ view::VariableBackendView NodeStorage::find_variable_backend_view(identifier::No
     return this->cached_backend_ptr->find_variable_backend_view(id);
 }
 view::IRIBackendView NodeStorage::find_iri_backend_view(identifier::NodeBackendHandle handle) {
-    auto ns = lookup_instance(handle.node_storage_id());
-    return ns.value().find_iri_backend_view(handle.node_id());
+    return borrow_backend(handle.node_storage_id()).find_iri_backend_view(handle.node_id());
 }
 view::LiteralBackendView NodeStorage::find_literal_backend_view(identifier::NodeBackendHandle handle) {
-    auto ns = lookup_instance(handle.node_storage_id());
-    return ns.value().find_literal_backend_view(handle.node_id());
+    return borrow_backend(handle.node_storage_id()).find_literal_backend_view(handle.node_id());
 }
 view::BNodeBackendView NodeStorage::find_bnode_backend_view(identifier::NodeBackendHandle handle) {
-    auto ns = lookup_instance(handle.node_storage_id());
-    return ns.value().find_bnode_backend_view(handle.node_id());
+    return borrow_backend(handle.node_storage_id()).find_bnode_backend_view(handle.node_id());
 }
 view::VariableBackendView NodeStorage::find_variable_backend_view(identifier::NodeBackendHandle handle) {
-    auto ns = lookup_instance(handle.node_storage_id());
-    return ns.value().find_variable_backend_view(handle.node_id());
+    return borrow_backend(handle.node_storage_id()).find_variable_backend_view(handle.node_id());
 }
 bool NodeStorage::erase_iri(identifier::NodeID id) {
+    if (auto *cache = this->derived_literal_cache(); cache != nullptr) {
+        // the id might be reused for a different node
+        cache->clear();
+    }
     return this->cached_backend_ptr->erase_iri(id);
 }
 bool NodeStorage::erase_literal(identifier::NodeID id) {
+    if (auto *cache = this->derived_literal_cache(); cache != nullptr) {
+        cache->clear();
+    }
     return this->cached_backend_ptr->erase_literal(id);
 }
 bool NodeStorage::erase_bnode(identifier::NodeID id) {
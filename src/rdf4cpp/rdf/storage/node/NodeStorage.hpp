@@ -1,6 +1,7 @@
 #ifndef RDF4CPP_NODESTORAGE_HPP
 #define RDF4CPP_NODESTORAGE_HPP
 
+#include <rdf4cpp/rdf/storage/node/DerivedLiteralCache.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/NodeBackendHandle.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/NodeID.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/ReferenceNodeStorageBackend.hpp>
@@ -15,6 +16,7 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 
 namespace rdf4cpp::rdf::storage::node {
 
@@ -28,11 +30,15 @@ static constexpr identifier::NodeStorageID INVALID_BACKEND_INDEX{static_cast<uin
  * The control block for managing a single backend instance.
  * The reasoning for the atomicity of the fields can be found
  * in the first comment inside NodeStorage.
+ *
+ * refcount is kept on its own cache line, because it is written every time a NodeStorage is copied or destroyed,
+ * while backend and generation are only written when a backend is registered or destroyed.
+ * Read-only lookups of the backend (see NodeStorage::borrow_backend) therefore do not contend with reference counting.
  */
 struct ControlBlock {
-    std::atomic<INodeStorageBackend *> backend{nullptr};
-    std::atomic<size_t> refcount{0};
+    alignas(64) std::atomic<INodeStorageBackend *> backend{nullptr};
     std::atomic<size_t> generation{0};
+    alignas(64) std::atomic<size_t> refcount{0};
 };
 }  //namespace node_storage_detail
 
@@ -139,6 +145,17 @@ class NodeStorage {
      */
     void decrease_refcount() noexcept;
 
+    /**
+     * Retrieves the backend at the slot with the given id without touching its reference count.
+     * Used by the static lookup functions, so that dereferencing a node does not write to any shared state.
+     *
+     * @param id id of the slot
+     * @return the backend at the slot
+     * @throws std::runtime_error if there is no backend at id
+     * @safety The returned backend is only valid as long as some NodeStorage keeps it alive.
+     */
+    [[nodiscard]] static INodeStorageBackend &borrow_backend(identifier::NodeStorageID id);
+
 public:
     /**
      * Get the default NodeStorage instance. This is the instance that is used wherever no NodeStorage is explicitly specified.
@@ -230,6 +247,27 @@ public:
      */
     [[nodiscard]] WeakNodeStorage downgrade() const noexcept;
 
+    /**
+     * Attaches a DerivedLiteralCache with the given capacity to the backend of this NodeStorage, replacing any previous one.
+     * Derivations like Literal::uppercase or Literal::cast into this NodeStorage will then look up their result in the cache
+     * before computing it.
+     *
+     * @param capacity number of cache slots, rounded up to the next power of two
+     * @safety This function is not thread-safe. It must not be called while other threads are using this NodeStorage.
+     */
+    void enable_derived_literal_cache(size_t capacity);
+
+    /**
+     * Removes the DerivedLiteralCache of the backend of this NodeStorage, if any.
+     * @safety This function is not thread-safe. It must not be called while other threads are using this NodeStorage.
+     */
+    void disable_derived_literal_cache() noexcept;
+
+    /**
+     * @return the DerivedLiteralCache of the backend of this NodeStorage or nullptr if it is not enabled
+     */
+    [[nodiscard]] DerivedLiteralCache *derived_literal_cache() const noexcept;
+
     /**
      * Lookup the identifier::NodeID for the given view::BNodeBackendView. If it doesn't exist in the backend yet, it is added.
      * @param view BlankNode description (MUST be valid)
@@ -258,6 +296,32 @@ public:
      */
     [[nodiscard]] identifier::NodeID find_or_make_id(view::VariableBackendView const &view) noexcept;
 
+    /**
+     * Lookup the identifier::NodeIDs for a batch of view::BNodeBackendViews. Those that don't exist in the backend yet are added.
+     * Cheaper than calling find_or_make_id for each view if the backend supports batches, e.g. reference_node_storage::ReferenceNodeStorageBackend.
+     * @param views BlankNode descriptions (MUST be valid)
+     * @param out_ids output for the identifier::NodeIDs, MUST have the same size as views. out_ids[i] identifies views[i].
+     */
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept;
+
+    /**
+     * Lookup the identifier::NodeIDs for a batch of view::IRIBackendViews. Those that don't exist in the backend yet are added.
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept;
+
+    /**
+     * Lookup the identifier::NodeIDs for a batch of view::LiteralBackendViews. Those that don't exist in the backend yet are added.
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept;
+
+    /**
+     * Lookup the identifier::NodeIDs for a batch of view::VariableBackendViews. Those that don't exist in the backend yet are added.
+     * @see find_or_make_ids(std::span<view::BNodeBackendView const>, std::span<identifier::NodeID>)
+     */
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept;
+
     /**
      * Lookup the identifier::NodeID for the given view::BNodeBackendView. If it doesn't exist, the method will return a null() identifier::NodeID.
      * @param view BlankNode description (MUST be valid)
@@ -322,8 +386,8 @@ public:
      * @param handle NodeBackendHandle of the requested resource
      * @return view::IRIBackendView describing the requested resource.
      * @throws std::exception if there is no backend at handle.node_storage_id()
-     * @safety If there is currently no NodeStorage keeping the backend at handle.node_backend_id() alive
-     *      it is undefined from which node storage the node will actually be fetched, if any.
+     * @safety There must be a NodeStorage keeping the backend at handle.node_storage_id() alive during this call
+     *      and for as long as the returned view is used. The reference count of the backend is not modified.
      */
     [[nodiscard]] static view::IRIBackendView find_iri_backend_view(identifier::NodeBackendHandle handle);
 
@@ -333,8 +397,8 @@ public:
      * @param handle NodeBackendHandle of the requested resource
      * @return view::LiteralBackendView describing the requested resource.
      * @throws std::exception if there is no backend at handle.node_storage_id()
-     * @safety If there is currently no NodeStorage keeping the backend at handle.node_backend_id() alive
-     *      it is undefined from which node storage the node will actually be fetched, if any.
+     * @safety There must be a NodeStorage keeping the backend at handle.node_storage_id() alive during this call
+     *      and for as long as the returned view is used. The reference count of the backend is not modified.
      */
     [[nodiscard]] static view::LiteralBackendView find_literal_backend_view(identifier::NodeBackendHandle handle);
 
@@ -346,8 +410,8 @@ public:
      * @param handle NodeBackendHandle of the requested resource
      * @return view::IRIBackendView describing the requested resource.
      * @throws std::exception if there is no backend at handle.node_storage_id()
-     * @safety If there is currently no NodeStorage keeping the backend at handle.node_backend_id() alive
-     *      it is undefined from which node storage the node will actually be fetched, if any.
+     * @safety There must be a NodeStorage keeping the backend at handle.node_storage_id() alive during this call
+     *      and for as long as the returned view is used. The reference count of the backend is not modified.
      */
     [[nodiscard]] static view::BNodeBackendView find_bnode_backend_view(identifier::NodeBackendHandle handle);
 
@@ -359,13 +423,14 @@ public:
      * @param handle NodeBackendHandle of the requested resource
      * @return view::IRIBackendView describing the requested resource.
      * @throws std::exception if there is no backend at handle.node_storage_id()
-     * @safety If there is currently no NodeStorage keeping the backend at handle.node_backend_id() alive
-     *      it is undefined from which node storage the node will actually be fetched, if any.
+     * @safety There must be a NodeStorage keeping the backend at handle.node_storage_id() alive during this call
+     *      and for as long as the returned view is used. The reference count of the backend is not modified.
      */
     [[nodiscard]] static view::VariableBackendView find_variable_backend_view(identifier::NodeBackendHandle handle);
 
     /**
      * Erases the iri backend for the given identifier::NodeID.
+     * Clears the DerivedLiteralCache, if enabled.
      *
      * @param id NodeID of the resource to be erased
      * @return if a resource was erased
@@ -376,6 +441,7 @@ public:
 
     /**
      * Erase the literal backend for the given identifier::NodeID.
+     * Clears the DerivedLiteralCache, if enabled.
      *
      * @param id NodeID of the resource to be erased
      * @return if a resource was erased
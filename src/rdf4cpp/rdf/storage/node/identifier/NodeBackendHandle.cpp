@@ -99,6 +99,12 @@ NodeStorageID NodeBackendHandle::node_storage_id() const noexcept {
 NodeBackendHandle::NodeBackendHandle(NodeID node_id, RDFNodeType node_type, NodeStorageID node_storage_id, bool inlined, uint8_t tagging_bits) noexcept
     : raw_(unsafe_copy_cast<uint64_t>(NodeBackendHandleImpl{node_id, node_type, node_storage_id, inlined, tagging_bits})) {}
 
+NodeBackendHandle NodeBackendHandle::from_raw(uint64_t const raw) noexcept {
+    NodeBackendHandle handle;
+    handle.raw_ = raw;
+    return handle;
+}
+
 uint64_t NodeBackendHandle::raw() const noexcept {
     return raw_;
 }
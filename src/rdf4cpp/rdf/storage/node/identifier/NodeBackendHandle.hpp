@@ -34,6 +34,13 @@ public:
      */
     explicit NodeBackendHandle(NodeID node_id, RDFNodeType node_type, NodeStorageID node_storage_id, bool inlined = false, uint8_t tagging_bits = {}) noexcept;
 
+    /**
+     * Reconstructs a NodeBackendHandle from its underlying 64 bit data
+     * @param raw value previously obtained from raw() const
+     * @return the NodeBackendHandle with the given underlying data
+     */
+    [[nodiscard]] static NodeBackendHandle from_raw(uint64_t raw) noexcept;
+
     /**
      * Get the RDFNodeType
      * @returnRDFNodeType
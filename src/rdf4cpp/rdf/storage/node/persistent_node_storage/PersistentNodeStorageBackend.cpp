@@ -0,0 +1,602 @@
+#include "PersistentNodeStorageBackend.hpp"
+
+#include <rdf4cpp/rdf/datatypes/registry/DatatypeRegistry.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/LookupOrInsert.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rdf4cpp::rdf::storage::node::persistent_node_storage {
+
+namespace persistent_detail {
+
+using format::Entry;
+using format::SectionKind;
+using reference_node_storage::lookup_or_insert_impl;
+
+template<typename View>
+static constexpr SectionKind section_of() noexcept {
+    if constexpr (std::is_same_v<View, view::IRIBackendView>) {
+        return SectionKind::IRI;
+    } else if constexpr (std::is_same_v<View, view::BNodeBackendView>) {
+        return SectionKind::BNode;
+    } else if constexpr (std::is_same_v<View, view::VariableBackendView>) {
+        return SectionKind::Variable;
+    } else {
+        static_assert(std::is_same_v<View, view::LexicalFormLiteralBackendView>);
+        return SectionKind::Literal;
+    }
+}
+
+/**
+ * Reconstructs the view of a node stored in a mapped section.
+ */
+template<typename View>
+static View entry_view(Entry const &entry, char const *strings) noexcept {
+    char const *str = strings + entry.offset;
+
+    if constexpr (section_of<View>() == SectionKind::Variable) {
+        return View{.name = std::string_view{str, entry.size1}, .is_anonymous = entry.size2 != 0};
+    } else if constexpr (section_of<View>() == SectionKind::Literal) {
+        return View{.datatype_id = identifier::NodeID{entry.datatype_id},
+                    .lexical_form = std::string_view{str, entry.size1},
+                    .language_tag = std::string_view{str + entry.size1, entry.size2}};
+    } else {
+        return View{.identifier = std::string_view{str, entry.size1}};
+    }
+}
+
+/**
+ * Opening a file does not look at the entries, so their strings are checked whenever an entry is used.
+ * @return whether the strings of entry are inside the strings of section
+ */
+template<typename View>
+static bool entry_in_bounds(PersistentNodeStorageBackend::MappedSection const &section, Entry const &entry) noexcept {
+    uint64_t size = entry.size1;
+    if constexpr (section_of<View>() == SectionKind::Literal) {
+        size += entry.size2;  // cannot overflow, both are 32 bit
+    }
+    return entry.offset <= section.strings_size && size <= section.strings_size - entry.offset;
+}
+
+/**
+ * Same as entry_view but checks the bounds of the strings of entry first.
+ * @throws std::runtime_error if the strings of entry are not inside the strings of section
+ */
+template<typename View>
+static View checked_entry_view(PersistentNodeStorageBackend::MappedSection const &section, Entry const &entry) {
+    if (!entry_in_bounds<View>(section, entry)) [[unlikely]] {
+        throw std::runtime_error{"Invalid dictionary file: strings of node " + std::to_string(entry.id) + " out of bounds"};
+    }
+    return entry_view<View>(entry, section.strings);
+}
+
+/**
+ * Looks up the identifier of the node described by view in the hash table of a mapped section.
+ * Slots that do not reference an entry end the probe sequence and a full table is probed at most once,
+ * so a corrupt file cannot make the lookup read outside of the mapping or loop forever.
+ * @return the identifier or null() if view is not in section
+ */
+template<typename View>
+static identifier::NodeID mapped_find_id(PersistentNodeStorageBackend::MappedSection const &section, View const &view) noexcept {
+    if (section.entry_count == 0) {
+        return identifier::NodeID{};
+    }
+
+    auto const hash = static_cast<uint64_t>(view.hash());
+    size_t slot = hash & section.table_mask;
+    for (size_t probes = 0; probes <= section.table_mask; ++probes, slot = (slot + 1) & section.table_mask) {
+        auto const entry_ix = section.table[slot];
+        if (entry_ix == 0 || entry_ix > section.entry_count) {
+            return identifier::NodeID{};
+        }
+
+        auto const &entry = section.entries[entry_ix - 1];
+        if (entry.hash == hash && entry_in_bounds<View>(section, entry) && entry_view<View>(entry, section.strings) == view) {
+            return identifier::NodeID{entry.id};
+        }
+    }
+
+    return identifier::NodeID{};
+}
+
+/**
+ * Looks up the node with identifier id in a mapped section.
+ * @return the entry or nullptr if id is not in section
+ */
+static Entry const *mapped_find_entry(PersistentNodeStorageBackend::MappedSection const &section, identifier::NodeID const id) noexcept {
+    auto const *first = section.entries;
+    auto const *last = section.entries + section.entry_count;
+
+    auto const *it = std::lower_bound(first, last, id.value(), [](Entry const &entry, uint64_t const value) noexcept {
+        return entry.id < value;
+    });
+
+    if (it == last || it->id != id.value()) {
+        return nullptr;
+    }
+    return it;
+}
+
+template<typename Storage>
+static typename Storage::BackendView find_backend_view_impl(PersistentNodeStorageBackend::MappedSection const &section, Storage &storage, identifier::NodeID const id) {
+    using View = typename Storage::BackendView;
+
+    if (auto const *entry = mapped_find_entry(section, id); entry != nullptr) {
+        return checked_entry_view<View>(section, *entry);
+    }
+
+    std::shared_lock lock{storage.mutex};
+    return static_cast<View>(*storage.id2data.at(id));
+}
+
+template<typename Storage>
+static bool erase_impl(Storage &storage, identifier::NodeID const id) noexcept {
+    std::unique_lock lock{storage.mutex};
+    auto it = storage.id2data.find(id);
+    if (it == storage.id2data.end()) {
+        return false;
+    }
+
+    auto data_it = storage.data2id.find(static_cast<typename Storage::BackendView>(*it->second));
+    assert(data_it != storage.data2id.end());
+
+    storage.data2id.erase(data_it);
+    storage.id2data.erase(it);
+
+    return true;
+}
+
+/**
+ * @return size as stored in Entry::size1 or Entry::size2
+ * @throws std::length_error if size does not fit into the dictionary format
+ */
+static uint32_t entry_size(size_t const size) {
+    if (size > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error{"String of " + std::to_string(size) + " bytes is too large for a dictionary file"};
+    }
+    return static_cast<uint32_t>(size);
+}
+
+/**
+ * A section of a dictionary file that is being written.
+ */
+struct SectionBuilder {
+    std::vector<Entry> entries;
+    std::string strings;
+
+    template<typename View>
+    void add(identifier::NodeID const id, View const &view) {
+        Entry entry{.id = id.value(),
+                    .hash = static_cast<uint64_t>(view.hash()),
+                    .offset = strings.size(),
+                    .size1 = 0,
+                    .size2 = 0,
+                    .datatype_id = 0};
+
+        if constexpr (section_of<View>() == SectionKind::Variable) {
+            entry.size1 = entry_size(view.name.size());
+            entry.size2 = view.is_anonymous;
+            strings.append(view.name);
+        } else if constexpr (section_of<View>() == SectionKind::Literal) {
+            entry.size1 = entry_size(view.lexical_form.size());
+            entry.size2 = entry_size(view.language_tag.size());
+            entry.datatype_id = view.datatype_id.value();
+            strings.append(view.lexical_form);
+            strings.append(view.language_tag);
+        } else {
+            entry.size1 = entry_size(view.identifier.size());
+            strings.append(view.identifier);
+        }
+
+        entries.push_back(entry);
+    }
+
+    template<typename Storage>
+    void add_all(PersistentNodeStorageBackend::MappedSection const &mapped, Storage const &storage) {
+        using View = typename Storage::BackendView;
+
+        for (size_t ix = 0; ix < mapped.entry_count; ++ix) {
+            add(identifier::NodeID{mapped.entries[ix].id}, checked_entry_view<View>(mapped, mapped.entries[ix]));
+        }
+
+        std::shared_lock lock{storage.mutex};
+        for (auto const &[id, backend] : storage.id2data) {
+            add(id, static_cast<View>(*backend));
+        }
+    }
+
+    /**
+     * Sorts the entries by id and builds the hash table.
+     * @return the hash table
+     */
+    std::vector<uint64_t> finish() {
+        std::sort(entries.begin(), entries.end(), [](Entry const &lhs, Entry const &rhs) noexcept {
+            return lhs.id < rhs.id;
+        });
+
+        if (entries.empty()) {
+            return {};
+        }
+
+        // load factor of at most 0.5
+        std::vector<uint64_t> table(std::bit_ceil(entries.size() * 2), 0);
+        auto const mask = table.size() - 1;
+        for (size_t ix = 0; ix < entries.size(); ++ix) {
+            auto slot = entries[ix].hash & mask;
+            while (table[slot] != 0) {
+                slot = (slot + 1) & mask;
+            }
+            table[slot] = ix + 1;
+        }
+
+        return table;
+    }
+};
+
+static constexpr uint64_t align_up(uint64_t const offset) noexcept {
+    return (offset + 7) & ~uint64_t{7};
+}
+
+}  // namespace persistent_detail
+
+using namespace persistent_detail;
+
+PersistentNodeStorageBackend::PersistentNodeStorageBackend() noexcept {
+    add_reserved_iris();
+}
+
+PersistentNodeStorageBackend::PersistentNodeStorageBackend(std::filesystem::path const &path) {
+    map_file(path);
+    add_reserved_iris();
+}
+
+PersistentNodeStorageBackend::~PersistentNodeStorageBackend() noexcept {
+    if (mapping_ != nullptr) {
+        ::munmap(mapping_, mapping_size_);
+    }
+}
+
+void PersistentNodeStorageBackend::add_reserved_iris() noexcept {
+    // some iri's like xsd:string are there by default
+    for (auto const &[iri, literal_type] : datatypes::registry::reserved_datatype_ids) {
+        auto const id = identifier::NodeID{literal_type.to_underlying()};
+        view::IRIBackendView const view{.identifier = iri};
+
+        if (mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::IRI)], view).null()) {
+            [[maybe_unused]] auto const inserted_id = lookup_or_insert_impl<true>(view, iri_storage_, [id]() noexcept {
+                return id;
+            });
+            assert(inserted_id == id);
+        }
+    }
+}
+
+void PersistentNodeStorageBackend::map_file(std::filesystem::path const &path) {
+    int const fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw std::system_error{errno, std::generic_category(), "Could not open dictionary file " + path.string()};
+    }
+
+    struct stat stat_buf {};
+    if (::fstat(fd, &stat_buf) != 0) {
+        auto const err = errno;
+        ::close(fd);
+        throw std::system_error{err, std::generic_category(), "Could not stat dictionary file " + path.string()};
+    }
+
+    auto const size = static_cast<size_t>(stat_buf.st_size);
+    if (size < sizeof(format::FileHeader)) {
+        ::close(fd);
+        throw std::runtime_error{"Invalid dictionary file " + path.string() + ": file too small"};
+    }
+
+    void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    auto const err = errno;
+    ::close(fd);  // the mapping stays valid
+
+    if (mapping == MAP_FAILED) {
+        throw std::system_error{err, std::generic_category(), "Could not map dictionary file " + path.string()};
+    }
+
+    // lookups by hash and by id are random accesses, do not waste IO on readahead
+    ::madvise(mapping, size, MADV_RANDOM);
+
+    auto const fail = [&](char const *reason) {
+        ::munmap(mapping, size);
+        throw std::runtime_error{"Invalid dictionary file " + path.string() + ": " + reason};
+    };
+
+    auto const in_bounds = [size](uint64_t const offset, uint64_t const count, size_t const elem_size) noexcept {
+        return offset % 8 == 0 && offset <= size && count <= (size - offset) / elem_size;
+    };
+
+    auto const *base = static_cast<char const *>(mapping);
+    auto const &header = *reinterpret_cast<format::FileHeader const *>(base);
+
+    if (header.magic != format::magic) {
+        fail("wrong magic number");
+    }
+    if (header.version != format::version) {
+        fail("unsupported version");
+    }
+
+    for (size_t ix = 0; ix < format::section_count; ++ix) {
+        auto const &section = header.sections[ix];
+
+        if (!in_bounds(section.entries_offset, section.entry_count, sizeof(format::Entry))
+            || !in_bounds(section.table_offset, section.table_size, sizeof(uint64_t))
+            || !in_bounds(section.strings_offset, section.strings_size, 1)) {
+            fail("section out of bounds");
+        }
+
+        if (section.entry_count != 0 && (!std::has_single_bit(section.table_size) || section.table_size <= section.entry_count)) {
+            fail("invalid hash table size");
+        }
+
+        // only the header is validated to keep opening O(1), the slots and entries are checked by the lookups
+        mapped_sections_[ix] = MappedSection{
+                .entries = reinterpret_cast<format::Entry const *>(base + section.entries_offset),
+                .entry_count = section.entry_count,
+                .table = reinterpret_cast<uint64_t const *>(base + section.table_offset),
+                .table_mask = section.table_size == 0 ? 0 : section.table_size - 1,
+                .strings = base + section.strings_offset,
+                .strings_size = section.strings_size};
+    }
+
+    next_iri_id_ = header.next_ids[static_cast<size_t>(SectionKind::IRI)];
+    next_bnode_id_ = header.next_ids[static_cast<size_t>(SectionKind::BNode)];
+    next_variable_id_ = header.next_ids[static_cast<size_t>(SectionKind::Variable)];
+    next_literal_id_ = header.next_ids[static_cast<size_t>(SectionKind::Literal)];
+
+    mapping_ = mapping;
+    mapping_size_ = size;
+}
+
+void PersistentNodeStorageBackend::save(std::filesystem::path const &path) const {
+    std::array<SectionBuilder, format::section_count> builders;
+    builders[static_cast<size_t>(SectionKind::IRI)].add_all(mapped_sections_[static_cast<size_t>(SectionKind::IRI)], iri_storage_);
+    builders[static_cast<size_t>(SectionKind::BNode)].add_all(mapped_sections_[static_cast<size_t>(SectionKind::BNode)], bnode_storage_);
+    builders[static_cast<size_t>(SectionKind::Variable)].add_all(mapped_sections_[static_cast<size_t>(SectionKind::Variable)], variable_storage_);
+    builders[static_cast<size_t>(SectionKind::Literal)].add_all(mapped_sections_[static_cast<size_t>(SectionKind::Literal)], literal_storage_);
+
+    format::FileHeader header{};
+    header.magic = format::magic;
+    header.version = format::version;
+    header.next_ids[static_cast<size_t>(SectionKind::IRI)] = next_iri_id_.load();
+    header.next_ids[static_cast<size_t>(SectionKind::BNode)] = next_bnode_id_.load();
+    header.next_ids[static_cast<size_t>(SectionKind::Variable)] = next_variable_id_.load();
+    header.next_ids[static_cast<size_t>(SectionKind::Literal)] = next_literal_id_.load();
+
+    std::array<std::vector<uint64_t>, format::section_count> tables;
+    uint64_t offset = align_up(sizeof(format::FileHeader));
+    for (size_t ix = 0; ix < format::section_count; ++ix) {
+        tables[ix] = builders[ix].finish();
+
+        auto &section = header.sections[ix];
+        section.entry_count = builders[ix].entries.size();
+        section.entries_offset = offset;
+        offset += section.entry_count * sizeof(format::Entry);
+
+        section.table_size = tables[ix].size();
+        section.table_offset = offset;
+        offset += section.table_size * sizeof(uint64_t);
+
+        section.strings_size = builders[ix].strings.size();
+        section.strings_offset = offset;
+        offset = align_up(offset + section.strings_size);
+    }
+
+    auto tmp_path = path;
+    tmp_path += ".tmp";
+
+    {
+        std::ofstream out{tmp_path, std::ios::binary | std::ios::trunc};
+        if (!out) {
+            throw std::system_error{errno, std::generic_category(), "Could not open " + tmp_path.string() + " for writing"};
+        }
+
+        static constexpr std::array<char, 8> padding{};
+        auto const pad = [&out]() {
+            auto const pos = static_cast<uint64_t>(out.tellp());
+            out.write(padding.data(), static_cast<std::streamsize>(align_up(pos) - pos));
+        };
+
+        out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+        pad();
+
+        for (size_t ix = 0; ix < format::section_count; ++ix) {
+            out.write(reinterpret_cast<char const *>(builders[ix].entries.data()), static_cast<std::streamsize>(builders[ix].entries.size() * sizeof(format::Entry)));
+            out.write(reinterpret_cast<char const *>(tables[ix].data()), static_cast<std::streamsize>(tables[ix].size() * sizeof(uint64_t)));
+            out.write(builders[ix].strings.data(), static_cast<std::streamsize>(builders[ix].strings.size()));
+            pad();
+        }
+
+        out.flush();
+        if (!out) {
+            throw std::system_error{errno, std::generic_category(), "Could not write " + tmp_path.string()};
+        }
+    }
+
+    std::filesystem::rename(tmp_path, path);
+}
+
+size_t PersistentNodeStorageBackend::mapped_size() const noexcept {
+    size_t ret = 0;
+    for (auto const &section : mapped_sections_) {
+        ret += section.entry_count;
+    }
+    return ret;
+}
+
+size_t PersistentNodeStorageBackend::size() const noexcept {
+    return mapped_size() +
+           iri_storage_.id2data.size() +
+           bnode_storage_.id2data.size() +
+           variable_storage_.id2data.size() +
+           literal_storage_.id2data.size();
+}
+
+bool PersistentNodeStorageBackend::has_specialized_storage_for([[maybe_unused]] identifier::LiteralType const datatype) const noexcept {
+    return false;
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_or_make_id(view::BNodeBackendView const &view) noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::BNode)], view); !id.null()) {
+        return id;
+    }
+
+    return lookup_or_insert_impl<true>(view, bnode_storage_, [this]() noexcept {
+        auto const id = next_bnode_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_or_make_id(view::IRIBackendView const &view) noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::IRI)], view); !id.null()) {
+        return id;
+    }
+
+    return lookup_or_insert_impl<true>(view, iri_storage_, [this]() noexcept {
+        auto const id = next_iri_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_or_make_id(view::LiteralBackendView const &view) noexcept {
+    auto const find_or_make_lexical = [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
+        if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::Literal)], lexical); !id.null()) {
+            return id;
+        }
+
+        auto const datatype = identifier::iri_node_id_to_literal_type(lexical.datatype_id);
+        return lookup_or_insert_impl<true>(lexical, literal_storage_, [this, datatype]() noexcept {
+            auto const id = next_literal_id_.fetch_add(1, std::memory_order_relaxed);
+            if (id >= (1ul << LiteralID::width)) [[unlikely]] {
+                std::abort();
+            }
+
+            return identifier::NodeID{identifier::LiteralID{id}, datatype};
+        });
+    };
+
+    return view.visit(
+            find_or_make_lexical,
+            [&](view::ValueLiteralBackendView const &any) noexcept {
+                // there is no specialized storage, so NodeStorage should never send values. Store them by their lexical form anyway.
+                auto const to_string = datatypes::registry::DatatypeRegistry::get_to_canonical_string(datatypes::registry::DatatypeIDView{any.datatype});
+                assert(to_string != nullptr);
+                std::string const str = to_string(any.value);
+
+                return find_or_make_lexical(view::LexicalFormLiteralBackendView{
+                        .datatype_id = identifier::literal_type_to_iri_node_id(any.datatype),
+                        .lexical_form = str,
+                        .language_tag = ""});
+            });
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_or_make_id(view::VariableBackendView const &view) noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::Variable)], view); !id.null()) {
+        return id;
+    }
+
+    return lookup_or_insert_impl<true>(view, variable_storage_, [this]() noexcept {
+        auto const id = next_variable_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_id(view::BNodeBackendView const &view) const noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::BNode)], view); !id.null()) {
+        return id;
+    }
+    return lookup_or_insert_impl<false>(view, bnode_storage_);
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_id(view::IRIBackendView const &view) const noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::IRI)], view); !id.null()) {
+        return id;
+    }
+    return lookup_or_insert_impl<false>(view, iri_storage_);
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_id(view::LiteralBackendView const &view) const noexcept {
+    return view.visit(
+            [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
+                if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::Literal)], lexical); !id.null()) {
+                    return id;
+                }
+                return lookup_or_insert_impl<false>(lexical, literal_storage_);
+            },
+            []([[maybe_unused]] view::ValueLiteralBackendView const &any) noexcept {
+                // there is no specialized storage, so there can be no literal stored by value
+                return identifier::NodeID{};
+            });
+}
+
+identifier::NodeID PersistentNodeStorageBackend::find_id(view::VariableBackendView const &view) const noexcept {
+    if (auto const id = mapped_find_id(mapped_sections_[static_cast<size_t>(SectionKind::Variable)], view); !id.null()) {
+        return id;
+    }
+    return lookup_or_insert_impl<false>(view, variable_storage_);
+}
+
+view::IRIBackendView PersistentNodeStorageBackend::find_iri_backend_view(identifier::NodeID const id) const {
+    return find_backend_view_impl(mapped_sections_[static_cast<size_t>(SectionKind::IRI)], iri_storage_, id);
+}
+
+view::LiteralBackendView PersistentNodeStorageBackend::find_literal_backend_view(identifier::NodeID const id) const {
+    return find_backend_view_impl(mapped_sections_[static_cast<size_t>(SectionKind::Literal)], literal_storage_, id);
+}
+
+view::BNodeBackendView PersistentNodeStorageBackend::find_bnode_backend_view(identifier::NodeID const id) const {
+    return find_backend_view_impl(mapped_sections_[static_cast<size_t>(SectionKind::BNode)], bnode_storage_, id);
+}
+
+view::VariableBackendView PersistentNodeStorageBackend::find_variable_backend_view(identifier::NodeID const id) const {
+    return find_backend_view_impl(mapped_sections_[static_cast<size_t>(SectionKind::Variable)], variable_storage_, id);
+}
+
+bool PersistentNodeStorageBackend::erase_iri(identifier::NodeID const id) noexcept {
+    return erase_impl(iri_storage_, id);
+}
+
+bool PersistentNodeStorageBackend::erase_literal(identifier::NodeID const id) noexcept {
+    return erase_impl(literal_storage_, id);
+}
+
+bool PersistentNodeStorageBackend::erase_bnode(identifier::NodeID const id) noexcept {
+    return erase_impl(bnode_storage_, id);
+}
+
+bool PersistentNodeStorageBackend::erase_variable(identifier::NodeID const id) noexcept {
+    return erase_impl(variable_storage_, id);
+}
+
+}  // namespace rdf4cpp::rdf::storage::node::persistent_node_storage
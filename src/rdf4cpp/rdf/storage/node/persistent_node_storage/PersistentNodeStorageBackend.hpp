@@ -0,0 +1,188 @@
+#ifndef RDF4CPP_PERSISTENTNODESTORAGEBACKEND_HPP
+#define RDF4CPP_PERSISTENTNODESTORAGEBACKEND_HPP
+
+#include <rdf4cpp/rdf/storage/node/INodeStorageBackend.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/BNodeBackend.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/FallbackLiteralBackend.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/IRIBackend.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/NodeTypeStorage.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/VariableBackend.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace rdf4cpp::rdf::storage::node::persistent_node_storage {
+
+/**
+ * Layout of the dictionary files written by PersistentNodeStorageBackend::save.
+ * All integers are stored in native byte order, all offsets are relative to the start of the file and 8-byte aligned.
+ *
+ * The file starts with a FileHeader, followed by the data of the sections referenced by it.
+ */
+namespace format {
+
+static constexpr std::array<char, 8> magic{'R', 'D', 'F', '4', 'C', 'P', 'P', 'D'};
+/**
+ * Version 2: hashes of the views are computed with wyhash instead of robin_hood::hash_bytes
+ */
+static constexpr uint64_t version = 2;
+
+/**
+ * The node kinds, one section per kind.
+ */
+enum struct SectionKind : size_t {
+    IRI = 0,
+    BNode,
+    Variable,
+    Literal,
+};
+
+static constexpr size_t section_count = 4;
+
+/**
+ * A single node.
+ * The strings of the node are stored back to back at offset in the strings of the section:
+ * IRI: identifier (size1), BNode: identifier (size1), Variable: name (size1), Literal: lexical form (size1) followed by language tag (size2).
+ */
+struct Entry {
+    uint64_t id;           ///< identifier::NodeID::value()
+    uint64_t hash;         ///< hash() of the view of the node
+    uint64_t offset;       ///< offset of the strings in the strings of the section
+    uint32_t size1;        ///< size of the first string
+    uint32_t size2;        ///< Literal: size of the language tag, Variable: is_anonymous
+    uint64_t datatype_id;  ///< Literal: identifier::NodeID::value() of the datatype
+};
+
+struct Section {
+    uint64_t entry_count;     ///< number of nodes
+    uint64_t entries_offset;  ///< Entry[entry_count], sorted by id
+    uint64_t table_offset;    ///< uint64_t[table_size], open addressing (linear probing) by Entry::hash. Values are index + 1 into the entries, 0 marks an empty slot
+    uint64_t table_size;      ///< power of two, larger than entry_count
+    uint64_t strings_offset;  ///< strings of all entries
+    uint64_t strings_size;
+};
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint64_t version;
+    std::array<Section, section_count> sections;
+    std::array<uint64_t, section_count> next_ids;  ///< next id to hand out per section, for literals the next LiteralID
+};
+
+}  // namespace format
+
+/**
+ * INodeStorageBackend whose nodes can be saved to a dictionary file with save().
+ * Constructing a PersistentNodeStorageBackend from such a file maps it into memory instead of reading it.
+ * Opening a file is O(1), only its header is validated. The entries and the hash tables are checked by the lookups that use them:
+ * find_id does not find corrupt entries and find_*_backend_view throws std::runtime_error for them.
+ * The strings are loaded lazily by the operating system.
+ *
+ * All identifier::NodeIDs of nodes in the file stay the same, new nodes get identifiers that were not used before.
+ * Nodes that were created after the file was mapped are kept in memory until the next save().
+ *
+ * There is no specialized storage for any datatype, all literals are stored by their lexical form.
+ * Nodes that are stored in the mapped file cannot be erased.
+ *
+ * Thread-safe.
+ */
+class PersistentNodeStorageBackend : public INodeStorageBackend {
+public:
+    using NodeID = identifier::NodeID;
+    using LiteralID = identifier::LiteralID;
+
+    /**
+     * The sections of a mapped dictionary file.
+     */
+    struct MappedSection {
+        format::Entry const *entries = nullptr;
+        size_t entry_count = 0;
+        uint64_t const *table = nullptr;
+        size_t table_mask = 0;
+        char const *strings = nullptr;
+        size_t strings_size = 0;
+    };
+
+private:
+    void *mapping_ = nullptr;
+    size_t mapping_size_ = 0;
+    std::array<MappedSection, format::section_count> mapped_sections_;
+
+    reference_node_storage::NodeTypeStorage<reference_node_storage::IRIBackend> iri_storage_;
+    reference_node_storage::NodeTypeStorage<reference_node_storage::BNodeBackend> bnode_storage_;
+    reference_node_storage::NodeTypeStorage<reference_node_storage::VariableBackend> variable_storage_;
+    reference_node_storage::NodeTypeStorage<reference_node_storage::FallbackLiteralBackend> literal_storage_;
+
+    std::atomic<uint64_t> next_iri_id_{NodeID::min_iri_id.value()};
+    std::atomic<uint64_t> next_bnode_id_{NodeID::min_bnode_id.value()};
+    std::atomic<uint64_t> next_variable_id_{NodeID::min_variable_id.value()};
+    std::atomic<uint64_t> next_literal_id_{NodeID::min_literal_id.value};
+
+    void map_file(std::filesystem::path const &path);
+    void add_reserved_iris() noexcept;
+
+public:
+    /**
+     * Constructs an empty PersistentNodeStorageBackend that is not backed by a file.
+     */
+    PersistentNodeStorageBackend() noexcept;
+
+    /**
+     * Maps the dictionary file at path into memory. The file must not be modified while it is mapped.
+     * @param path file previously written by save()
+     * @throws std::system_error if the file cannot be opened or mapped
+     * @throws std::runtime_error if the header of the file is not valid
+     */
+    explicit PersistentNodeStorageBackend(std::filesystem::path const &path);
+
+    PersistentNodeStorageBackend(PersistentNodeStorageBackend const &) = delete;
+    PersistentNodeStorageBackend &operator=(PersistentNodeStorageBackend const &) = delete;
+
+    ~PersistentNodeStorageBackend() noexcept override;
+
+    /**
+     * Writes all nodes of this backend, including the ones in the mapped file, to a dictionary file at path.
+     * The file is written to a temporary file first, which then replaces path. So path may be the currently mapped file.
+     * @param path destination of the dictionary file
+     * @throws std::system_error if writing the file fails
+     * @throws std::length_error if a string of a node is larger than 4 GiB, which the format cannot represent
+     * @throws std::runtime_error if a node of the mapped file is corrupt
+     */
+    void save(std::filesystem::path const &path) const;
+
+    /**
+     * @return number of nodes that are stored in the mapped file
+     */
+    [[nodiscard]] size_t mapped_size() const noexcept;
+
+    [[nodiscard]] size_t size() const noexcept override;
+
+    [[nodiscard]] bool has_specialized_storage_for(identifier::LiteralType datatype) const noexcept override;
+
+    [[nodiscard]] identifier::NodeID find_or_make_id(view::BNodeBackendView const &view) noexcept override;
+    [[nodiscard]] identifier::NodeID find_or_make_id(view::IRIBackendView const &view) noexcept override;
+    [[nodiscard]] identifier::NodeID find_or_make_id(view::LiteralBackendView const &view) noexcept override;
+    [[nodiscard]] identifier::NodeID find_or_make_id(view::VariableBackendView const &view) noexcept override;
+
+    [[nodiscard]] identifier::NodeID find_id(view::BNodeBackendView const &view) const noexcept override;
+    [[nodiscard]] identifier::NodeID find_id(view::IRIBackendView const &view) const noexcept override;
+    [[nodiscard]] identifier::NodeID find_id(view::LiteralBackendView const &view) const noexcept override;
+    [[nodiscard]] identifier::NodeID find_id(view::VariableBackendView const &view) const noexcept override;
+
+    [[nodiscard]] view::IRIBackendView find_iri_backend_view(identifier::NodeID id) const override;
+    [[nodiscard]] view::LiteralBackendView find_literal_backend_view(identifier::NodeID id) const override;
+    [[nodiscard]] view::BNodeBackendView find_bnode_backend_view(identifier::NodeID id) const override;
+    [[nodiscard]] view::VariableBackendView find_variable_backend_view(identifier::NodeID id) const override;
+
+    bool erase_iri(identifier::NodeID id) noexcept override;
+    bool erase_literal(identifier::NodeID id) noexcept override;
+    bool erase_bnode(identifier::NodeID id) noexcept override;
+    bool erase_variable(identifier::NodeID id) noexcept override;
+};
+
+}  // namespace rdf4cpp::rdf::storage::node::persistent_node_storage
+
+#endif  //RDF4CPP_PERSISTENTNODESTORAGEBACKEND_HPP
@@ -0,0 +1,143 @@
+#ifndef RDF4CPP_ARENANODETYPESTORAGE_HPP
+#define RDF4CPP_ARENANODETYPESTORAGE_HPP
+
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/NodeTypeStorage.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/StringArena.hpp>
+#include <rdf4cpp/rdf/storage/node/view/BNodeBackendView.hpp>
+#include <rdf4cpp/rdf/storage/node/view/IRIBackendView.hpp>
+#include <rdf4cpp/rdf/storage/node/view/LiteralBackendView.hpp>
+#include <rdf4cpp/rdf/storage/node/view/VariableBackendView.hpp>
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_set.h>
+
+#include <concepts>
+#include <shared_mutex>
+#include <type_traits>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+/**
+ * Views that consist only of strings and trivially copyable data, so that they can be stored in a StringArena.
+ */
+template<typename View>
+concept StringArenaStorableView = std::same_as<View, view::IRIBackendView>
+                                  || std::same_as<View, view::BNodeBackendView>
+                                  || std::same_as<View, view::VariableBackendView>
+                                  || std::same_as<View, view::LexicalFormLiteralBackendView>;
+
+/**
+ * Satisfied by storages that keep their data in a StringArena, i.e. ArenaNodeTypeStorage for StringArenaStorableView.
+ */
+template<typename Storage>
+concept UsesStringArena = requires { requires std::remove_const_t<Storage>::uses_string_arena; };
+
+/**
+ * Storage for one of the Node Backend types that keeps the string data of all nodes contiguously in a StringArena.
+ *
+ * Backend types whose views are not StringArenaStorableView (i.e. SpecializedLiteralBackend) are stored like in NodeTypeStorage.
+ * @tparam BackendType_t one of BNodeBackend, IRIBackend, FallbackLiteralBackend, SpecializedLiteralBackend and VariableBackend.
+ * @tparam HashPolicy_t how the hashes of the Backends are mapped to the hashes of data2id, see HashPolicy
+ */
+template<class BackendType_t, class HashPolicy_t = SeededHashPolicy>
+struct ArenaNodeTypeStorage : NodeTypeStorage<BackendType_t, HashPolicy_t> {
+};
+
+/**
+ * Instead of a heap allocated Backend per node, id2data holds a view into the arena and the hash of the node,
+ * and data2id holds only the identifier::NodeID. Hash and equality of data2id resolve the NodeID through id2data.
+ * So storing a node does not require an allocation of its own and costs little more than the length of its strings.
+ *
+ * Erasing a node removes it from the mappings, but the memory of its strings is only freed when the storage is destroyed.
+ */
+template<class BackendType_t, class HashPolicy_t> requires StringArenaStorableView<typename BackendType_t::View>
+struct ArenaNodeTypeStorage<BackendType_t, HashPolicy_t> {
+    using Backend = BackendType_t;
+    using BackendView = typename Backend::View;
+    using Policy = HashPolicy_t;
+
+    static_assert(HashPolicy<Policy>);
+
+    static constexpr bool uses_string_arena = true;
+
+    struct Entry {
+        BackendView view;
+        size_t hash; // the hash in data2id, see data_hash
+    };
+
+    struct NodeIDHash {
+        [[nodiscard]] size_t operator()(identifier::NodeID const &x) const noexcept {
+            return x.value();
+        }
+    };
+
+    struct DataHash {
+        ArenaNodeTypeStorage const *storage;
+
+        [[nodiscard]] size_t operator()(identifier::NodeID const &id) const noexcept {
+            // the hash is stored so that rehashing does not need to touch the strings
+            return storage->id2data.find(id)->second.hash;
+        }
+        [[nodiscard]] size_t operator()(BackendView const &view) const noexcept {
+            return storage->data_hash(view.hash());
+        }
+    };
+
+    struct DataEqual {
+        using is_transparent = void;
+
+        ArenaNodeTypeStorage const *storage;
+
+        [[nodiscard]] bool operator()(identifier::NodeID const &lhs, identifier::NodeID const &rhs) const noexcept {
+            return lhs == rhs;
+        }
+        [[nodiscard]] bool operator()(BackendView const &lhs, identifier::NodeID const &rhs) const noexcept {
+            return lhs == storage->id2data.find(rhs)->second.view;
+        }
+        [[nodiscard]] bool operator()(identifier::NodeID const &lhs, BackendView const &rhs) const noexcept {
+            return storage->id2data.find(lhs)->second.view == rhs;
+        }
+    };
+
+    std::shared_mutex mutable mutex;
+    [[no_unique_address]] Policy policy;
+    StringArena arena;
+    util::tsl::sparse_map<identifier::NodeID, Entry, NodeIDHash> id2data;
+    // every id in data2id must be in id2data, DataHash and DataEqual depend on it
+    util::tsl::sparse_set<identifier::NodeID, DataHash, DataEqual> data2id{0, DataHash{this}, DataEqual{this}};
+
+    ArenaNodeTypeStorage() = default;
+    ArenaNodeTypeStorage(ArenaNodeTypeStorage const &) = delete;
+    ArenaNodeTypeStorage &operator=(ArenaNodeTypeStorage const &) = delete;
+
+    /**
+     * Copies the strings referenced by data into the arena.
+     * @return a view equal to data that refers to the copies in the arena
+     */
+    [[nodiscard]] BackendView copy_to_arena(BackendView const &data) {
+        if constexpr (std::is_same_v<BackendView, view::LexicalFormLiteralBackendView>) {
+            return BackendView{.datatype_id = data.datatype_id,
+                               .lexical_form = arena.copy(data.lexical_form),
+                               .language_tag = arena.copy(data.language_tag)};
+        } else if constexpr (std::is_same_v<BackendView, view::VariableBackendView>) {
+            return BackendView{.name = arena.copy(data.name), .is_anonymous = data.is_anonymous};
+        } else {
+            return BackendView{.identifier = arena.copy(data.identifier)};
+        }
+    }
+
+    /**
+     * @param view_hash the hash of a view, computed with View::hash()
+     * @return the hash that data2id uses for that view, can be passed to its lookup functions and must be stored in Entry::hash
+     */
+    [[nodiscard]] size_t data_hash(size_t const view_hash) const noexcept {
+        return policy(view_hash);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return id2data.size();
+    }
+};
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
+
+#endif  //RDF4CPP_ARENANODETYPESTORAGE_HPP
@@ -0,0 +1,67 @@
+#ifndef RDF4CPP_HASHPOLICY_HPP
+#define RDF4CPP_HASHPOLICY_HPP
+
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+/**
+ * A hash policy maps the hash of a view (i.e. View::hash() or Backend::Hash, which the Backends cache) to the hash
+ * that a storage uses for its hash table. Every storage owns its own instance of the policy,
+ * the shards of a ShardedNodeTypeStorage share the one of the storage.
+ *
+ * Hash policies must be nothrow default constructible and provide
+ *      size_t operator()(size_t view_hash) const noexcept;
+ */
+template<typename Policy>
+concept HashPolicy = std::is_nothrow_default_constructible_v<Policy> && requires (Policy const &policy, size_t view_hash) {
+    { policy(view_hash) } noexcept -> std::same_as<size_t>;
+};
+
+/**
+ * Uses the hashes of the views as they are.
+ * Every storage places the same nodes in the same buckets, e.g. for reproducible performance measurements.
+ */
+struct UnseededHashPolicy {
+    [[nodiscard]] size_t operator()(size_t const view_hash) const noexcept {
+        return view_hash;
+    }
+};
+
+/**
+ * Mixes a seed that is different for every instance into the hashes of the views.
+ * This only varies the bucket (and shard) of a node between storages and runs, e.g. so that storages that are filled
+ * in the order of another storage's iteration do not degrade because of clustered buckets.
+ * It does not protect against inputs crafted to collide: the hashes of the views are unseeded (so that the Backends can cache them),
+ * and views with equal hashes still end up in the same bucket.
+ */
+struct SeededHashPolicy {
+    uint64_t seed = make_seed();
+
+    [[nodiscard]] size_t operator()(size_t const view_hash) const noexcept {
+        return util::wyhash::hash_int(static_cast<uint64_t>(view_hash), seed);
+    }
+
+    /**
+     * @return a new seed on every call, derived from a process-wide counter that starts at an unpredictable value
+     */
+    [[nodiscard]] static uint64_t make_seed() noexcept {
+        static std::atomic<uint64_t> state{util::wyhash::hash_int(static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()),
+                                                                  reinterpret_cast<uintptr_t>(&make_seed))};
+        return util::wyhash::hash_int(state.fetch_add(util::wyhash::detail::secret[0], std::memory_order_relaxed));
+    }
+};
+
+static_assert(HashPolicy<UnseededHashPolicy>);
+static_assert(HashPolicy<SeededHashPolicy>);
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
+
+#endif  //RDF4CPP_HASHPOLICY_HPP
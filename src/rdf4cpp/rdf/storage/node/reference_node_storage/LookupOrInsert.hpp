@@ -0,0 +1,112 @@
+#ifndef RDF4CPP_LOOKUPORINSERT_HPP
+#define RDF4CPP_LOOKUPORINSERT_HPP
+
+#include <rdf4cpp/rdf/storage/node/identifier/NodeID.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/ArenaNodeTypeStorage.hpp>
+
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+/**
+ * Synchronized lookup (and creation) of IDs by a provided view of a Node Backend.
+ * Works for NodeTypeStorage and ShardedNodeTypeStorage, only the shards responsible for view and the created ID are locked.
+ * @tparam Backend_t the Backend type. One of BNodeBackend, IRIBackend, FallbackLiteralBackend or VariableBackend
+ * @tparam create_if_not_present enables code for creating non-existing Node Backends
+ * @tparam NextIDFromView_func type of a function to generate the next ID which is assigned in case a new Node Backend is created
+ * @param view contains the data of the requested Node Backend
+ * @param storage the storage where the Node Backend is looked up
+ * @param next_id_func function to generate the next ID which is assigned in case a new Node Backend is created
+ * @return the NodeID for the looked up Node Backend. Result is null() if there was no matching Node Backend.
+ */
+template<bool create_if_not_present, typename Storage, typename NextIDFunc = void *>
+    requires (!UsesStringArena<Storage> && (!create_if_not_present || std::is_nothrow_invocable_r_v<identifier::NodeID, NextIDFunc>))
+identifier::NodeID lookup_or_insert_impl(typename Storage::BackendView const &view,
+                                         Storage &storage,
+                                         NextIDFunc next_id_func = nullptr) noexcept {
+
+    // the policy is applied once, the hash selects the shard and is passed to the lookups
+    auto const hash = storage.data_hash(typename Storage::Shard::BackendTypeHash{}(view));
+    auto &data_shard = storage.data_shard_for_hash(hash);
+
+    {
+        std::shared_lock lock{data_shard.mutex};
+        if (auto const it = data_shard.data2id.find(view, hash); it != data_shard.data2id.end()) {
+            return it->second;
+        }
+    }
+
+    if constexpr (!create_if_not_present) {
+        return identifier::NodeID{};
+    } else {
+        std::unique_lock lock{data_shard.mutex};
+
+        // check again, might have changed between unlocking of shared_lock and locking of unique_lock
+        if (auto const it = data_shard.data2id.find(view, hash); it != data_shard.data2id.end()) {
+            return it->second;
+        }
+
+        identifier::NodeID const next_id = next_id_func();
+        auto backend = std::make_unique<typename Storage::Backend>(view);
+        data_shard.data2id.emplace(backend.get(), next_id);
+
+        // the id2data mapping might be owned by a different shard, see ShardedNodeTypeStorage for the lock order
+        auto &id_shard = storage.id_shard(next_id);
+        std::unique_lock id_lock{id_shard.mutex, std::defer_lock};
+        if (&id_shard != &data_shard) {
+            id_lock.lock();
+        }
+
+        [[maybe_unused]] auto const [_, inserted] = id_shard.id2data.emplace(next_id, std::move(backend));
+        assert(inserted);
+
+        return next_id;
+    }
+}
+
+/**
+ * Synchronized lookup (and creation) of IDs by a provided view of a Node Backend in an ArenaNodeTypeStorage.
+ * The strings of newly created Node Backends are copied into the arena of storage.
+ * @see lookup_or_insert_impl above
+ */
+template<bool create_if_not_present, typename Storage, typename NextIDFunc = void *>
+    requires (UsesStringArena<Storage> && (!create_if_not_present || std::is_nothrow_invocable_r_v<identifier::NodeID, NextIDFunc>))
+identifier::NodeID lookup_or_insert_impl(typename Storage::BackendView const &view,
+                                         Storage &storage,
+                                         NextIDFunc next_id_func = nullptr) noexcept {
+
+    {
+        std::shared_lock lock{storage.mutex};
+        if (auto const it = storage.data2id.find(view); it != storage.data2id.end()) {
+            return *it;
+        }
+    }
+
+    if constexpr (!create_if_not_present) {
+        return identifier::NodeID{};
+    } else {
+        std::unique_lock lock{storage.mutex};
+
+        // check again, might have changed between unlocking of shared_lock and locking of unique_lock
+        if (auto const it = storage.data2id.find(view); it != storage.data2id.end()) {
+            return *it;
+        }
+
+        identifier::NodeID const next_id = next_id_func();
+
+        // id2data first, hashing and comparing ids in data2id requires the entry
+        [[maybe_unused]] auto const [_, inserted] = storage.id2data.emplace(next_id, typename Storage::Entry{storage.copy_to_arena(view), storage.data_hash(view.hash())});
+        assert(inserted);
+        storage.data2id.insert(next_id);
+
+        return next_id;
+    }
+}
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
+
+#endif  //RDF4CPP_LOOKUPORINSERT_HPP
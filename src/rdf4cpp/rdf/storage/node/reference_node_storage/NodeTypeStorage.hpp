@@ -4,6 +4,7 @@
 #include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
 
 #include <rdf4cpp/rdf/storage/node/identifier/NodeID.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/HashPolicy.hpp>
 
 #include <memory>
 #include <shared_mutex>
@@ -16,11 +17,15 @@ namespace rdf4cpp::rdf::storage::node::reference_node_storage {
 /**
  * Storage for one of the Node Backend types. Includes a shared mutex to synchronize access and bidirectional mappings between the Backend type and identifier::NodeID.
  * @tparam BackendType_t one of BNodeBackend, IRIBackend, FallbackLiteralBackend, SpecializedLiteralBackend and VariableBackend.
+ * @tparam HashPolicy_t how the hashes of the Backends are mapped to the hashes of data2id, see HashPolicy
  */
-template<class BackendType_t>
+template<class BackendType_t, class HashPolicy_t = SeededHashPolicy>
 struct NodeTypeStorage {
+    static_assert(HashPolicy<HashPolicy_t>);
+
     using Backend = BackendType_t;
     using BackendView = typename Backend::View;
+    using Policy = HashPolicy_t;
 private:
     struct DefaultBackendTypeEqual {
         using is_transparent = void;
@@ -70,6 +75,20 @@ public:
     using BackendTypeEqual = typename SelectBackendTypeEqual<BackendType_t>::type;
     using BackendTypeHash = typename SelectBackendTypeHash<BackendType_t>::type;
 
+    /**
+     * Hash of data2id, applies the policy to the hashes computed by BackendTypeHash.
+     */
+    struct DataHash {
+        [[no_unique_address]] Policy policy;
+
+        [[nodiscard]] size_t operator()(Backend const *x) const noexcept {
+            return policy(BackendTypeHash{}(x));
+        }
+        [[nodiscard]] size_t operator()(BackendView const &x) const noexcept {
+            return policy(BackendTypeHash{}(x));
+        }
+    };
+
     struct NodeIDHash {
         [[nodiscard]] size_t operator()(identifier::NodeID const &x) const noexcept {
             return x.value();
@@ -78,7 +97,33 @@ public:
 
     std::shared_mutex mutable mutex;
     util::tsl::sparse_map<identifier::NodeID, std::unique_ptr<Backend>, NodeIDHash> id2data;
-    util::tsl::sparse_map<Backend *, identifier::NodeID, BackendTypeHash, BackendTypeEqual> data2id;
+    util::tsl::sparse_map<Backend *, identifier::NodeID, DataHash, BackendTypeEqual> data2id;
+
+    /**
+     * A NodeTypeStorage consists of a single shard, itself.
+     * This provides the same interface as ShardedNodeTypeStorage so that both can be used interchangeably.
+     */
+    using Shard = NodeTypeStorage;
+
+    [[nodiscard]] Shard &data_shard([[maybe_unused]] BackendView const &view) noexcept { return *this; }
+    [[nodiscard]] Shard const &data_shard([[maybe_unused]] BackendView const &view) const noexcept { return *this; }
+    [[nodiscard]] Shard &data_shard([[maybe_unused]] Backend const *backend) noexcept { return *this; }
+    [[nodiscard]] Shard &data_shard_for_hash([[maybe_unused]] size_t hash) noexcept { return *this; }
+    [[nodiscard]] Shard const &data_shard_for_hash([[maybe_unused]] size_t hash) const noexcept { return *this; }
+    [[nodiscard]] Shard &id_shard([[maybe_unused]] identifier::NodeID id) noexcept { return *this; }
+    [[nodiscard]] Shard const &id_shard([[maybe_unused]] identifier::NodeID id) const noexcept { return *this; }
+
+    /**
+     * @param view_hash the hash of a view, computed with BackendTypeHash
+     * @return the hash that data2id uses for that view, can be passed to data_shard_for_hash and to the lookup functions of data2id
+     */
+    [[nodiscard]] size_t data_hash(size_t const view_hash) const noexcept {
+        return data2id.hash_function().policy(view_hash);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        return id2data.size();
+    }
 };
 }  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
 
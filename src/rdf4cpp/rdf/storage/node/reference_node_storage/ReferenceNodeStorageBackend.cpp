@@ -1,7 +1,11 @@
 #include "ReferenceNodeStorageBackend.hpp"
 
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/LookupOrInsert.hpp>
+
+#include <algorithm>
 #include <array>
 #include <utility>
+#include <vector>
 
 namespace rdf4cpp::rdf::storage::node::reference_node_storage {
 
@@ -43,8 +47,9 @@ static consteval std::array<bool, 1 << identifier::LiteralType::width> make_stor
 
 }  //specialization_detail
 
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
 template<typename S, typename F>
-decltype(auto) ReferenceNodeStorageBackend::visit_specialized(S &&container, identifier::LiteralType const datatype, F f) {
+decltype(auto) BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::visit_specialized(S &&container, identifier::LiteralType const datatype, F f) {
     using namespace rdf4cpp::rdf::datatypes;
 
     // manually translate runtime knowledge to compiletime
@@ -78,80 +83,191 @@ decltype(auto) ReferenceNodeStorageBackend::visit_specialized(S &&container, ide
     }
 }
 
-ReferenceNodeStorageBackend::ReferenceNodeStorageBackend() noexcept {
-    // set correct initial value for atomics
-    for (auto &id : next_specialized_literal_ids_) {
-        id = NodeID::min_literal_id.value;
+/**
+ * Synchronized batch lookup and creation of IDs by provided views of Node Backends.
+ * All hashes are computed before any lock is taken and the views are grouped by data shard,
+ * so every shard is locked at most once shared and at most once exclusively per batch.
+ * The lookups pass the precomputed hash, so no view is hashed twice.
+ * @param views contain the data of the requested Node Backends
+ * @param out_ids output, out_ids[i] is set to the NodeID of views[i]
+ * @param storage the storage where the Node Backends are looked up
+ * @param next_id_func function to generate the next ID from the view which is assigned in case a new Node Backend is created
+ * @see lookup_or_insert_impl
+ */
+template<typename Storage, typename NextIDFunc>
+    requires (!UsesStringArena<Storage> && std::is_nothrow_invocable_r_v<identifier::NodeID, NextIDFunc, typename Storage::BackendView const &>)
+static void lookup_or_insert_batch_impl(std::span<typename Storage::BackendView const> views,
+                                        std::span<identifier::NodeID> out_ids,
+                                        Storage &storage,
+                                        NextIDFunc next_id_func) noexcept {
+    using Shard = typename Storage::Shard;
+
+    assert(views.size() == out_ids.size());
+
+    struct Request {
+        Shard *shard;
+        size_t hash;
+        size_t ix;
+    };
+
+    std::vector<Request> requests;
+    requests.reserve(views.size());
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        auto const hash = storage.data_hash(typename Shard::BackendTypeHash{}(views[ix]));
+        requests.push_back(Request{&storage.data_shard_for_hash(hash), hash, ix});
     }
 
-    // some iri's like xsd:string are there by default
-    for (const auto &[iri, literal_type] : datatypes::registry::reserved_datatype_ids) {
-        auto const id = literal_type.to_underlying();
-
-        auto const [it, inserted] = iri_storage_.id2data.emplace(id, std::make_unique<IRIBackend>(iri));
-        assert(inserted);
-        iri_storage_.data2id.emplace(it->second.get(), id);
+    if constexpr (!std::is_same_v<Shard, Storage>) {
+        std::sort(requests.begin(), requests.end(), [](Request const &lhs, Request const &rhs) noexcept {
+            return lhs.shard < rhs.shard;
+        });
     }
-}
 
-size_t ReferenceNodeStorageBackend::size() const noexcept {
-    return iri_storage_.id2data.size() +
-           bnode_storage_.id2data.size() +
-           variable_storage_.id2data.size() +
-           fallback_literal_storage_.id2data.size() +
-           specialization_detail::tuple_fold(specialized_literal_storage_, 0, [](auto acc, auto const &storage) noexcept {
-               return acc + storage.id2data.size();
-           });
-}
+    for (auto group_begin = requests.begin(); group_begin != requests.end();) {
+        auto &data_shard = *group_begin->shard;
+        auto const group_end = std::find_if(group_begin, requests.end(), [&data_shard](Request const &req) noexcept {
+            return req.shard != &data_shard;
+        });
 
-bool ReferenceNodeStorageBackend::has_specialized_storage_for(identifier::LiteralType const datatype) const noexcept {
-    static constexpr auto specialization_lut = specialization_detail::make_storage_specialization_lut<decltype(specialized_literal_storage_)>();
-    return specialization_lut[datatype.to_underlying()];
+        // misses are moved to the front of the group
+        auto misses_end = group_begin;
+        {
+            std::shared_lock lock{data_shard.mutex};
+            for (auto it = group_begin; it != group_end; ++it) {
+                if (auto const found = data_shard.data2id.find(views[it->ix], it->hash); found != data_shard.data2id.end()) {
+                    out_ids[it->ix] = found->second;
+                } else {
+                    *misses_end++ = *it;
+                }
+            }
+        }
+
+        if (misses_end != group_begin) {
+            std::unique_lock lock{data_shard.mutex};
+
+            for (auto it = group_begin; it != misses_end; ++it) {
+                auto const &view = views[it->ix];
+
+                // check again, might have been inserted concurrently or by an equal view earlier in this batch
+                if (auto const found = data_shard.data2id.find(view, it->hash); found != data_shard.data2id.end()) {
+                    out_ids[it->ix] = found->second;
+                    continue;
+                }
+
+                identifier::NodeID const next_id = next_id_func(view);
+                auto backend = std::make_unique<typename Storage::Backend>(view);
+                data_shard.data2id.emplace(backend.get(), next_id);
+
+                // see ShardedNodeTypeStorage for the lock order
+                auto &id_shard = storage.id_shard(next_id);
+                std::unique_lock id_lock{id_shard.mutex, std::defer_lock};
+                if (&id_shard != &data_shard) {
+                    id_lock.lock();
+                }
+
+                [[maybe_unused]] auto const [_, inserted] = id_shard.id2data.emplace(next_id, std::move(backend));
+                assert(inserted);
+
+                out_ids[it->ix] = next_id;
+            }
+        }
+
+        group_begin = group_end;
+    }
 }
 
 /**
- * Synchronized lookup (and creation) of IDs by a provided view of a Node Backend.
- * @tparam Backend_t the Backend type. One of BNodeBackend, IRIBackend, FallbackLiteralBackend or VariableBackend
- * @tparam create_if_not_present enables code for creating non-existing Node Backends
- * @tparam NextIDFromView_func type of a function to generate the next ID which is assigned in case a new Node Backend is created
- * @param view contains the data of the requested Node Backend
- * @param storage the storage where the Node Backend is looked up
- * @param next_id_func function to generate the next ID which is assigned in case a new Node Backend is created
- * @return the NodeID for the looked up Node Backend. Result is null() if there was no matching Node Backend.
+ * Synchronized batch lookup and creation of IDs in an ArenaNodeTypeStorage.
+ * @see lookup_or_insert_batch_impl above
  */
-template<bool create_if_not_present, typename Storage, typename NextIDFunc = void *>
-    requires (!create_if_not_present || std::is_nothrow_invocable_r_v<identifier::NodeID, NextIDFunc>)
-static identifier::NodeID lookup_or_insert_impl(typename Storage::BackendView const &view,
-                                                Storage &storage,
-                                                NextIDFunc next_id_func = nullptr) noexcept {
+template<typename Storage, typename NextIDFunc>
+    requires (UsesStringArena<Storage> && std::is_nothrow_invocable_r_v<identifier::NodeID, NextIDFunc, typename Storage::BackendView const &>)
+static void lookup_or_insert_batch_impl(std::span<typename Storage::BackendView const> views,
+                                        std::span<identifier::NodeID> out_ids,
+                                        Storage &storage,
+                                        NextIDFunc next_id_func) noexcept {
+    assert(views.size() == out_ids.size());
+
+    std::vector<size_t> hashes;
+    hashes.reserve(views.size());
+    for (auto const &view : views) {
+        hashes.push_back(storage.data_hash(view.hash()));
+    }
 
+    std::vector<size_t> misses;
     {
         std::shared_lock lock{storage.mutex};
-        if (auto const it = storage.data2id.find(view); it != storage.data2id.end()) {
-            return it->second;
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            if (auto const found = storage.data2id.find(views[ix], hashes[ix]); found != storage.data2id.end()) {
+                out_ids[ix] = *found;
+            } else {
+                misses.push_back(ix);
+            }
         }
     }
 
-    if constexpr (!create_if_not_present) {
-        return identifier::NodeID{};
-    } else {
-        std::unique_lock lock{storage.mutex};
+    if (misses.empty()) {
+        return;
+    }
+
+    std::unique_lock lock{storage.mutex};
+    for (auto const ix : misses) {
+        auto const &view = views[ix];
 
-        // check again, might have changed between unlocking of shared_lock and locking of unique_lock
-        if (auto const it = storage.data2id.find(view); it != storage.data2id.end()) {
-            return it->second;
+        // check again, might have been inserted concurrently or by an equal view earlier in this batch
+        if (auto const found = storage.data2id.find(view, hashes[ix]); found != storage.data2id.end()) {
+            out_ids[ix] = *found;
+            continue;
         }
 
-        identifier::NodeID const next_id = next_id_func();
-        auto const [it, inserted] = storage.id2data.emplace(next_id, std::make_unique<typename Storage::Backend>(view));
+        identifier::NodeID const next_id = next_id_func(view);
+
+        // id2data first, hashing and comparing ids in data2id requires the entry
+        [[maybe_unused]] auto const [_, inserted] = storage.id2data.emplace(next_id, typename Storage::Entry{storage.copy_to_arena(view), hashes[ix]});
         assert(inserted);
-        storage.data2id.emplace(it->second.get(), next_id);
+        storage.data2id.insert(next_id);
+
+        out_ids[ix] = next_id;
+    }
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::BasicReferenceNodeStorageBackend() noexcept {
+    // set correct initial value for atomics
+    for (auto &id : next_specialized_literal_ids_) {
+        id = NodeID::min_literal_id.value;
+    }
+
+    // some iri's like xsd:string are there by default
+    for (const auto &[iri, literal_type] : datatypes::registry::reserved_datatype_ids) {
+        auto const id = literal_type.to_underlying();
 
-        return next_id;
+        [[maybe_unused]] auto const inserted_id = lookup_or_insert_impl<true>(view::IRIBackendView{.identifier = iri}, iri_storage_, [id]() noexcept {
+            return identifier::NodeID{id};
+        });
+        assert(inserted_id == identifier::NodeID{id});
     }
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::LiteralBackendView const &view) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+size_t BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::size() const noexcept {
+    return iri_storage_.size() +
+           bnode_storage_.size() +
+           variable_storage_.size() +
+           fallback_literal_storage_.size() +
+           specialization_detail::tuple_fold(specialized_literal_storage_, 0, [](auto acc, auto const &storage) noexcept {
+               return acc + storage.size();
+           });
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+bool BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::has_specialized_storage_for(identifier::LiteralType const datatype) const noexcept {
+    static constexpr auto specialization_lut = specialization_detail::make_storage_specialization_lut<decltype(specialized_literal_storage_)>();
+    return specialization_lut[datatype.to_underlying()];
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_id(view::LiteralBackendView const &view) noexcept {
     return view.visit(
             [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
                 auto const datatype = identifier::iri_node_id_to_literal_type(lexical.datatype_id);
@@ -188,7 +304,8 @@ identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::LiteralBac
             });
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::IRIBackendView const &view) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_id(view::IRIBackendView const &view) noexcept {
     return lookup_or_insert_impl<true>(view, iri_storage_, [this]() noexcept {
         auto const id = next_iri_id_.fetch_add(1, std::memory_order_relaxed);
         if (id >= (1ul << NodeID::width)) [[unlikely]] {
@@ -199,7 +316,8 @@ identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::IRIBackend
     });
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::BNodeBackendView const &view) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_id(view::BNodeBackendView const &view) noexcept {
     return lookup_or_insert_impl<true>(view, bnode_storage_, [this]() noexcept {
         auto const id = next_bnode_id_.fetch_add(1, std::memory_order_relaxed);
         if (id >= (1ul << NodeID::width)) [[unlikely]] {
@@ -210,7 +328,8 @@ identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::BNodeBacke
     });
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::VariableBackendView const &view) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_id(view::VariableBackendView const &view) noexcept {
     return lookup_or_insert_impl<true>(view, variable_storage_, [this]() noexcept {
         auto const id = next_variable_id_.fetch_add(1, std::memory_order_relaxed);
         if (id >= (1ul << NodeID::width)) [[unlikely]] {
@@ -221,15 +340,97 @@ identifier::NodeID ReferenceNodeStorageBackend::find_or_make_id(view::VariableBa
     });
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_id(view::BNodeBackendView const &view) const noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+void BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    lookup_or_insert_batch_impl(views, out_ids, bnode_storage_, [this](auto const &) noexcept {
+        auto const id = next_bnode_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+void BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    lookup_or_insert_batch_impl(views, out_ids, iri_storage_, [this](auto const &) noexcept {
+        auto const id = next_iri_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+void BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    assert(views.size() == out_ids.size());
+
+    // literals stored by lexical form all go to the same storage and are batched,
+    // literals stored by value are spread over the specialized storages and are handled one by one
+    std::vector<view::LexicalFormLiteralBackendView> lexical_views;
+    std::vector<size_t> lexical_ixs;
+
+    for (size_t ix = 0; ix < views.size(); ++ix) {
+        views[ix].visit(
+                [&](view::LexicalFormLiteralBackendView const &lexical) {
+                    lexical_views.push_back(lexical);
+                    lexical_ixs.push_back(ix);
+                },
+                [&](view::ValueLiteralBackendView const &) noexcept {
+                    out_ids[ix] = find_or_make_id(views[ix]);
+                });
+    }
+
+    if (lexical_views.empty()) {
+        return;
+    }
+
+    std::vector<identifier::NodeID> lexical_ids(lexical_views.size());
+    lookup_or_insert_batch_impl(std::span<view::LexicalFormLiteralBackendView const>{lexical_views}, std::span{lexical_ids}, fallback_literal_storage_,
+                                [this](view::LexicalFormLiteralBackendView const &lexical) noexcept {
+                                    auto const datatype = identifier::iri_node_id_to_literal_type(lexical.datatype_id);
+                                    assert(!this->has_specialized_storage_for(datatype));
+
+                                    auto const id = next_fallback_literal_id_.fetch_add(1, std::memory_order_relaxed);
+                                    if (id >= (1ul << LiteralID::width)) [[unlikely]] {
+                                        std::abort();
+                                    }
+
+                                    return identifier::NodeID{identifier::LiteralID{id}, datatype};
+                                });
+
+    for (size_t ix = 0; ix < lexical_ixs.size(); ++ix) {
+        out_ids[lexical_ixs[ix]] = lexical_ids[ix];
+    }
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+void BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept {
+    lookup_or_insert_batch_impl(views, out_ids, variable_storage_, [this](auto const &) noexcept {
+        auto const id = next_variable_id_.fetch_add(1, std::memory_order_relaxed);
+        if (id >= (1ul << NodeID::width)) [[unlikely]] {
+            std::abort();
+        }
+
+        return identifier::NodeID{id};
+    });
+}
+
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_id(view::BNodeBackendView const &view) const noexcept {
     return lookup_or_insert_impl<false>(view, bnode_storage_);
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_id(view::IRIBackendView const &view) const noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_id(view::IRIBackendView const &view) const noexcept {
     return lookup_or_insert_impl<false>(view, iri_storage_);
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_id(view::LiteralBackendView const &view) const noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_id(view::LiteralBackendView const &view) const noexcept {
     return view.visit(
             [this](view::LexicalFormLiteralBackendView const &lexical) {
                 assert(!this->has_specialized_storage_for(identifier::iri_node_id_to_literal_type(lexical.datatype_id)));
@@ -243,21 +444,31 @@ identifier::NodeID ReferenceNodeStorageBackend::find_id(view::LiteralBackendView
             });
 }
 
-identifier::NodeID ReferenceNodeStorageBackend::find_id(view::VariableBackendView const &view) const noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+identifier::NodeID BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_id(view::VariableBackendView const &view) const noexcept {
     return lookup_or_insert_impl<false>(view, variable_storage_);
 }
 
-template<typename NodeTypeStorage>
+template<typename NodeTypeStorage> requires (!UsesStringArena<NodeTypeStorage>)
+static typename NodeTypeStorage::BackendView find_backend_view(NodeTypeStorage &storage, identifier::NodeID const id) {
+    auto &id_shard = storage.id_shard(id);
+    std::shared_lock<std::shared_mutex> shared_lock{id_shard.mutex};
+    return static_cast<typename NodeTypeStorage::BackendView>(*id_shard.id2data.at(id));
+}
+
+template<typename NodeTypeStorage> requires UsesStringArena<NodeTypeStorage>
 static typename NodeTypeStorage::BackendView find_backend_view(NodeTypeStorage &storage, identifier::NodeID const id) {
     std::shared_lock<std::shared_mutex> shared_lock{storage.mutex};
-    return static_cast<typename NodeTypeStorage::BackendView>(*storage.id2data.at(id));
+    return storage.id2data.at(id).view;
 }
 
-view::IRIBackendView ReferenceNodeStorageBackend::find_iri_backend_view(identifier::NodeID const id) const {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+view::IRIBackendView BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_iri_backend_view(identifier::NodeID const id) const {
     return find_backend_view(iri_storage_, id);
 }
 
-view::LiteralBackendView ReferenceNodeStorageBackend::find_literal_backend_view(identifier::NodeID const id) const {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+view::LiteralBackendView BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_literal_backend_view(identifier::NodeID const id) const {
     if (id.literal_type().is_fixed() && this->has_specialized_storage_for(id.literal_type())) {
         return visit_specialized(specialized_literal_storage_, id.literal_type(), [id](auto const &storage) {
             return find_backend_view(storage, id);
@@ -267,38 +478,78 @@ view::LiteralBackendView ReferenceNodeStorageBackend::find_literal_backend_view(
     return find_backend_view(fallback_literal_storage_, id);
 }
 
-view::BNodeBackendView ReferenceNodeStorageBackend::find_bnode_backend_view(identifier::NodeID const id) const {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+view::BNodeBackendView BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_bnode_backend_view(identifier::NodeID const id) const {
     return find_backend_view(bnode_storage_, id);
 }
 
-view::VariableBackendView ReferenceNodeStorageBackend::find_variable_backend_view(identifier::NodeID const id) const {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+view::VariableBackendView BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::find_variable_backend_view(identifier::NodeID const id) const {
     return find_backend_view(variable_storage_, id);
 }
 
-template<typename NodeTypeStorage>
+template<typename NodeTypeStorage> requires (!UsesStringArena<NodeTypeStorage>)
 static bool erase_impl(NodeTypeStorage &storage, identifier::NodeID const id) noexcept {
-    std::unique_lock lock{storage.mutex};
-    auto it = storage.id2data.find(id);
-    if (it == storage.id2data.end()) {
+    auto &id_shard = storage.id_shard(id);
+
+    typename NodeTypeStorage::Shard *data_shard;
+    {
+        std::shared_lock lock{id_shard.mutex};
+        auto it = id_shard.id2data.find(id);
+        if (it == id_shard.id2data.end()) {
+            return false;
+        }
+
+        data_shard = &storage.data_shard(it->second.get());
+    }
+
+    // see ShardedNodeTypeStorage for the lock order
+    std::unique_lock lock{data_shard->mutex};
+    std::unique_lock id_lock{id_shard.mutex, std::defer_lock};
+    if (&id_shard != data_shard) {
+        id_lock.lock();
+    }
+
+    // check again, might have been erased between unlocking of shared_lock and locking of unique_lock
+    auto it = id_shard.id2data.find(id);
+    if (it == id_shard.id2data.end()) {
         return false;
     }
 
     auto const *backend_ptr = it->second.get();
 
-    auto data_it = storage.data2id.find(static_cast<typename NodeTypeStorage::BackendView>(*backend_ptr));
-    assert(data_it != storage.data2id.end());
+    auto data_it = data_shard->data2id.find(static_cast<typename NodeTypeStorage::BackendView>(*backend_ptr));
+    assert(data_it != data_shard->data2id.end());
+
+    data_shard->data2id.erase(data_it);
+    id_shard.id2data.erase(it);
+
+    return true;
+}
 
+template<typename NodeTypeStorage> requires UsesStringArena<NodeTypeStorage>
+static bool erase_impl(NodeTypeStorage &storage, identifier::NodeID const id) noexcept {
+    std::unique_lock lock{storage.mutex};
+    auto it = storage.id2data.find(id);
+    if (it == storage.id2data.end()) {
+        return false;
+    }
+
+    // data2id first, hashing ids in data2id requires the entry in id2data
+    [[maybe_unused]] auto const erased = storage.data2id.erase(id);
+    assert(erased == 1);
     storage.id2data.erase(it);
-    storage.data2id.erase(data_it);
 
     return true;
 }
 
-bool ReferenceNodeStorageBackend::erase_iri(identifier::NodeID const id) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+bool BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::erase_iri(identifier::NodeID const id) noexcept {
     return erase_impl(iri_storage_, id);
 }
 
-bool ReferenceNodeStorageBackend::erase_literal(identifier::NodeID const id) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+bool BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::erase_literal(identifier::NodeID const id) noexcept {
     if (id.literal_type().is_fixed() && this->has_specialized_storage_for(id.literal_type())) {
         return visit_specialized(specialized_literal_storage_, id.literal_type(), [id](auto &storage) noexcept {
             return erase_impl(storage, id);
@@ -308,12 +559,22 @@ bool ReferenceNodeStorageBackend::erase_literal(identifier::NodeID const id) noe
     return erase_impl(fallback_literal_storage_, id);
 }
 
-bool ReferenceNodeStorageBackend::erase_bnode(identifier::NodeID const id) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+bool BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::erase_bnode(identifier::NodeID const id) noexcept {
     return erase_impl(bnode_storage_, id);
 }
 
-bool ReferenceNodeStorageBackend::erase_variable(identifier::NodeID const id) noexcept {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t>
+bool BasicReferenceNodeStorageBackend<NodeTypeStorage_t, HashPolicy_t>::erase_variable(identifier::NodeID const id) noexcept {
     return erase_impl(variable_storage_, id);
 }
 
+template class BasicReferenceNodeStorageBackend<NodeTypeStorage, SeededHashPolicy>;
+template class BasicReferenceNodeStorageBackend<ShardedNodeTypeStorage, SeededHashPolicy>;
+template class BasicReferenceNodeStorageBackend<ArenaNodeTypeStorage, SeededHashPolicy>;
+
+template class BasicReferenceNodeStorageBackend<NodeTypeStorage, UnseededHashPolicy>;
+template class BasicReferenceNodeStorageBackend<ShardedNodeTypeStorage, UnseededHashPolicy>;
+template class BasicReferenceNodeStorageBackend<ArenaNodeTypeStorage, UnseededHashPolicy>;
+
 }  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
\ No newline at end of file
@@ -2,10 +2,14 @@
 #define RDF4CPP_REFERENCENODESTORAGEBACKEND_HPP
 
 #include <atomic>
+#include <span>
 #include <tuple>
 
 #include <rdf4cpp/rdf/storage/node/INodeStorageBackend.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/ArenaNodeTypeStorage.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/HashPolicy.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/NodeTypeStorage.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/ShardedNodeTypeStorage.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/BNodeBackend.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/FallbackLiteralBackend.hpp>
 #include <rdf4cpp/rdf/storage/node/reference_node_storage/IRIBackend.hpp>
@@ -17,32 +21,40 @@ namespace rdf4cpp::rdf::storage::node::reference_node_storage {
 
 /**
  * Thread-safe reference implementation of a INodeStorageBackend.
+ *
+ * @tparam NodeTypeStorage_t storage used for each of the Node Backend types. Either NodeTypeStorage (one mutex per Node Backend type),
+ *      ShardedNodeTypeStorage (lock-striped, for many threads inserting concurrently)
+ *      or ArenaNodeTypeStorage (strings stored contiguously, for low memory overhead per node).
+ *      Use the aliases ReferenceNodeStorageBackend, ShardedReferenceNodeStorageBackend and ArenaReferenceNodeStorageBackend.
+ * @tparam HashPolicy_t hash policy of all storages. SeededHashPolicy (different seed for every storage) or UnseededHashPolicy,
+ *      both are instantiated for every NodeTypeStorage_t.
  */
-class ReferenceNodeStorageBackend : public INodeStorageBackend {
+template<template<typename, typename> typename NodeTypeStorage_t, typename HashPolicy_t = SeededHashPolicy>
+class BasicReferenceNodeStorageBackend : public INodeStorageBackend {
 public:
     using NodeID = identifier::NodeID;
     using LiteralID = identifier::LiteralID;
 
 private:
-    NodeTypeStorage<BNodeBackend> bnode_storage_;
-    NodeTypeStorage<IRIBackend> iri_storage_;
-    NodeTypeStorage<VariableBackend> variable_storage_;
+    NodeTypeStorage_t<BNodeBackend, HashPolicy_t> bnode_storage_;
+    NodeTypeStorage_t<IRIBackend, HashPolicy_t> iri_storage_;
+    NodeTypeStorage_t<VariableBackend, HashPolicy_t> variable_storage_;
 
-    NodeTypeStorage<FallbackLiteralBackend> fallback_literal_storage_;
+    NodeTypeStorage_t<FallbackLiteralBackend, HashPolicy_t> fallback_literal_storage_;
 
-    std::tuple<NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Integer>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonNegativeInteger>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::PositiveInteger>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NonPositiveInteger>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::NegativeInteger>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Long>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::UnsignedLong>>,
+    std::tuple<NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::Integer>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::NonNegativeInteger>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::PositiveInteger>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::NonPositiveInteger>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::NegativeInteger>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::Long>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::UnsignedLong>, HashPolicy_t>,
 
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Decimal>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Double>>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::Decimal>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::Double>, HashPolicy_t>,
 
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::Base64Binary>>,
-               NodeTypeStorage<SpecializedLiteralBackend<datatypes::xsd::HexBinary>>> specialized_literal_storage_;
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::Base64Binary>, HashPolicy_t>,
+               NodeTypeStorage_t<SpecializedLiteralBackend<datatypes::xsd::HexBinary>, HashPolicy_t>> specialized_literal_storage_;
 
     std::atomic<uint64_t> next_fallback_literal_id_{NodeID::min_literal_id.value};
     std::array<std::atomic<uint64_t>, std::tuple_size_v<decltype(specialized_literal_storage_)>> next_specialized_literal_ids_;
@@ -63,7 +75,7 @@ private:
     static decltype(auto) visit_specialized(S &&container, identifier::LiteralType datatype, F f);
 
 public:
-    ReferenceNodeStorageBackend() noexcept;
+    BasicReferenceNodeStorageBackend() noexcept;
 
     [[nodiscard]] size_t size() const noexcept override;
 
@@ -74,6 +86,15 @@ public:
     [[nodiscard]] identifier::NodeID find_or_make_id(view::LiteralBackendView const &view) noexcept override;
     [[nodiscard]] identifier::NodeID find_or_make_id(view::VariableBackendView const &view) noexcept override;
 
+    /**
+     * Batch versions of find_or_make_id. Hashes all views up front and locks every storage (or shard) only once per batch for the lookup
+     * and once more if any of the views has to be inserted.
+     */
+    void find_or_make_ids(std::span<view::BNodeBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept override;
+    void find_or_make_ids(std::span<view::IRIBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept override;
+    void find_or_make_ids(std::span<view::LiteralBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept override;
+    void find_or_make_ids(std::span<view::VariableBackendView const> views, std::span<identifier::NodeID> out_ids) noexcept override;
+
     [[nodiscard]] identifier::NodeID find_id(view::BNodeBackendView const &view) const noexcept override;
     [[nodiscard]] identifier::NodeID find_id(view::IRIBackendView const &view) const noexcept override;
     [[nodiscard]] identifier::NodeID find_id(view::LiteralBackendView const &view) const noexcept override;
@@ -90,5 +111,32 @@ public:
     bool erase_variable(identifier::NodeID id) noexcept override;
 };
 
+extern template class BasicReferenceNodeStorageBackend<NodeTypeStorage, SeededHashPolicy>;
+extern template class BasicReferenceNodeStorageBackend<ShardedNodeTypeStorage, SeededHashPolicy>;
+extern template class BasicReferenceNodeStorageBackend<ArenaNodeTypeStorage, SeededHashPolicy>;
+
+extern template class BasicReferenceNodeStorageBackend<NodeTypeStorage, UnseededHashPolicy>;
+extern template class BasicReferenceNodeStorageBackend<ShardedNodeTypeStorage, UnseededHashPolicy>;
+extern template class BasicReferenceNodeStorageBackend<ArenaNodeTypeStorage, UnseededHashPolicy>;
+
+/**
+ * Reference implementation of a INodeStorageBackend, with one mutex per Node Backend type.
+ */
+using ReferenceNodeStorageBackend = BasicReferenceNodeStorageBackend<NodeTypeStorage>;
+
+/**
+ * Reference implementation of a INodeStorageBackend that partitions the storage of every Node Backend type into lock-striped shards.
+ * Use this if many threads create nodes in the same NodeStorage concurrently, e.g. when loading data in parallel.
+ * IDs are handed out densely, exactly as with ReferenceNodeStorageBackend.
+ */
+using ShardedReferenceNodeStorageBackend = BasicReferenceNodeStorageBackend<ShardedNodeTypeStorage>;
+
+/**
+ * Reference implementation of a INodeStorageBackend that stores the strings of IRIs, blank nodes, variables and
+ * non-specialized literals in large append-only chunks instead of one heap allocated Node Backend per node.
+ * Use this for large, mostly append-only datasets, memory of erased nodes is only reclaimed when the backend is destroyed.
+ */
+using ArenaReferenceNodeStorageBackend = BasicReferenceNodeStorageBackend<ArenaNodeTypeStorage>;
+
 }  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
 #endif  //RDF4CPP_REFERENCENODESTORAGEBACKEND_HPP
@@ -0,0 +1,130 @@
+#ifndef RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
+#define RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
+
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/NodeTypeStorage.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+/**
+ * Lock-striped storage for one of the Node Backend types.
+ * Consists of shard_count data shards and shard_count id shards, each a NodeTypeStorage with its own shared mutex.
+ *
+ * The data2id mapping of a Backend lives in the data shard selected by its hash (data_shard),
+ * the id2data mapping lives in the id shard selected by its identifier::NodeID (id_shard).
+ * Because of that, lookups of different nodes rarely contend for the same mutex and interning scales with the number of threads.
+ *
+ * Lock order: if both are required, the data shard mutex is always acquired before the id shard mutex.
+ * Data shards and id shards are disjoint, so this order is free of cycles.
+ *
+ * @tparam BackendType_t one of BNodeBackend, IRIBackend, FallbackLiteralBackend, SpecializedLiteralBackend and VariableBackend.
+ * @tparam HashPolicy_t how the hashes of the Backends are mapped to the hashes that select the shard and the bucket inside of it, see HashPolicy
+ */
+template<class BackendType_t, class HashPolicy_t = SeededHashPolicy>
+struct ShardedNodeTypeStorage {
+    using Backend = BackendType_t;
+    using BackendView = typename Backend::View;
+    using Policy = HashPolicy_t;
+    using Shard = NodeTypeStorage<Backend, Policy>;
+
+    static constexpr size_t shard_count_log2 = 6;
+    static constexpr size_t shard_count = 1 << shard_count_log2;
+
+private:
+    /**
+     * Shards are aligned to cache lines to avoid false sharing of the mutexes.
+     */
+    struct alignas(64) AlignedShard : Shard {};
+
+    std::array<AlignedShard, shard_count> data_shards_;
+    std::array<AlignedShard, shard_count> id_shards_;
+    [[no_unique_address]] Policy policy_;
+
+    /**
+     * @param data_hash the hash of a view with the policy applied, see data_hash
+     */
+    [[nodiscard]] static size_t shard_index(size_t const data_hash) noexcept {
+        // fibonacci hashing, uses the high bits so that shard selection is independent of the bucket selection inside the shard
+        return (static_cast<uint64_t>(data_hash) * 11400714819323198485ull) >> (64 - shard_count_log2);
+    }
+
+public:
+    /**
+     * All data shards use the policy of this storage, so the policy is applied once per lookup
+     * and the same hash selects both the shard and the bucket inside of it.
+     */
+    ShardedNodeTypeStorage() {
+        for (auto &shard : data_shards_) {
+            shard.data2id = decltype(shard.data2id){0, typename Shard::DataHash{policy_}};
+        }
+    }
+
+    /**
+     * @param view_hash the hash of a view, computed with Shard::BackendTypeHash
+     * @return the hash that the data shards use for that view, can be passed to data_shard_for_hash and to the lookup functions of data2id
+     */
+    [[nodiscard]] size_t data_hash(size_t const view_hash) const noexcept {
+        return policy_(view_hash);
+    }
+
+    /**
+     * @param view view of a Backend
+     * @return the shard that holds the data2id mapping for the given view
+     */
+    [[nodiscard]] Shard &data_shard(BackendView const &view) noexcept {
+        return data_shard_for_hash(data_hash(typename Shard::BackendTypeHash{}(view)));
+    }
+
+    [[nodiscard]] Shard const &data_shard(BackendView const &view) const noexcept {
+        return const_cast<ShardedNodeTypeStorage *>(this)->data_shard(view);
+    }
+
+    /**
+     * @param backend a Backend stored in this storage
+     * @return the shard that holds the data2id mapping for backend
+     */
+    [[nodiscard]] Shard &data_shard(Backend const *backend) noexcept {
+        return data_shard_for_hash(data_hash(typename Shard::BackendTypeHash{}(backend)));
+    }
+
+    /**
+     * @param hash the hash of a view of a Backend with the policy applied, see data_hash
+     * @return the shard that holds the data2id mapping for views with the given hash
+     */
+    [[nodiscard]] Shard &data_shard_for_hash(size_t const hash) noexcept {
+        return data_shards_[shard_index(hash)];
+    }
+
+    [[nodiscard]] Shard const &data_shard_for_hash(size_t const hash) const noexcept {
+        return data_shards_[shard_index(hash)];
+    }
+
+    /**
+     * @param id identifier of a Backend
+     * @return the shard that holds the id2data mapping for the given id
+     */
+    [[nodiscard]] Shard &id_shard(identifier::NodeID const id) noexcept {
+        // ids are handed out densely, so the low bits distribute them evenly
+        return id_shards_[id.value() & (shard_count - 1)];
+    }
+
+    [[nodiscard]] Shard const &id_shard(identifier::NodeID const id) const noexcept {
+        return const_cast<ShardedNodeTypeStorage *>(this)->id_shard(id);
+    }
+
+    [[nodiscard]] size_t size() const noexcept {
+        size_t ret = 0;
+        for (auto const &shard : id_shards_) {
+            std::shared_lock lock{shard.mutex};
+            ret += shard.id2data.size();
+        }
+        return ret;
+    }
+};
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
+
+#endif  //RDF4CPP_SHARDEDNODETYPESTORAGE_HPP
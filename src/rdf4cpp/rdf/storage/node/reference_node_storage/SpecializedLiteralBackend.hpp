@@ -29,7 +29,7 @@ public:
                                                                                 value{std::move(value)} {
     }
 
-    explicit SpecializedLiteralBackend(View const &view) noexcept : value{std::any_cast<typename T::cpp_type>(view.value)} {
+    explicit SpecializedLiteralBackend(View const &view) noexcept : value{view.value.get<typename T::cpp_type>()} {
         assert(view.datatype == SpecializedLiteralBackend::datatype);
         this->hash_ = calculate_hash(value);
     }
@@ -41,7 +41,7 @@ public:
     explicit operator View() const noexcept {
         return view::ValueLiteralBackendView{
                 .datatype = SpecializedLiteralBackend::datatype,
-                .value = std::any{this->value}};
+                .value = datatypes::registry::AnyValue{this->value}};
     }
 
 public:
@@ -53,12 +53,12 @@ public:
         }
         bool operator()(View const &lhs, SpecializedLiteralBackend const *rhs) const noexcept {
             assert(lhs.datatype == SpecializedLiteralBackend::datatype);
-            return std::any_cast<typename T::cpp_type>(lhs.value) == rhs->value;
+            return lhs.value.get<typename T::cpp_type>() == rhs->value;
         }
 
         bool operator()(SpecializedLiteralBackend const *lhs, View const &rhs) const noexcept {
             assert(SpecializedLiteralBackend::datatype == rhs.datatype);
-            return lhs->value == std::any_cast<typename T::cpp_type>(rhs.value);
+            return lhs->value == rhs.value.get<typename T::cpp_type>();
         }
     };
 
@@ -68,7 +68,7 @@ public:
         }
         [[nodiscard]] size_t operator()(View const &x) const noexcept {
             assert(x.datatype == SpecializedLiteralBackend::datatype);
-            return calculate_hash(std::any_cast<typename T::cpp_type>(x.value));
+            return calculate_hash(x.value.get<typename T::cpp_type>());
         }
     };
 };
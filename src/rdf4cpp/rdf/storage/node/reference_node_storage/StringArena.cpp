@@ -0,0 +1,48 @@
+#include "StringArena.hpp"
+
+#include <cstring>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+StringArena::StringArena(size_t const chunk_size) noexcept : chunk_size_{chunk_size} {
+}
+
+std::string_view StringArena::copy(std::string_view const str) {
+    if (str.empty()) {
+        return {};
+    }
+
+    if (str.size() > remaining_) {
+        if (str.size() > chunk_size_) {
+            // oversized strings get a dedicated chunk, the current chunk stays in use
+            auto &chunk = chunks_.emplace_back(std::make_unique_for_overwrite<char[]>(str.size()));
+            std::memcpy(chunk.get(), str.data(), str.size());
+            size_ += str.size();
+            capacity_ += str.size();
+            return {chunk.get(), str.size()};
+        }
+
+        cursor_ = chunks_.emplace_back(std::make_unique_for_overwrite<char[]>(chunk_size_)).get();
+        remaining_ = chunk_size_;
+        capacity_ += chunk_size_;
+    }
+
+    std::memcpy(cursor_, str.data(), str.size());
+    std::string_view const ret{cursor_, str.size()};
+
+    cursor_ += str.size();
+    remaining_ -= str.size();
+    size_ += str.size();
+
+    return ret;
+}
+
+size_t StringArena::size() const noexcept {
+    return size_;
+}
+
+size_t StringArena::capacity() const noexcept {
+    return capacity_;
+}
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
@@ -0,0 +1,59 @@
+#ifndef RDF4CPP_STRINGARENA_HPP
+#define RDF4CPP_STRINGARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace rdf4cpp::rdf::storage::node::reference_node_storage {
+
+/**
+ * Append-only storage for strings. Strings are copied into large chunks, so storing a string does not require an allocation
+ * unless the current chunk is full. Chunks are never moved or freed before the arena is destroyed,
+ * so the returned std::string_views stay valid for the whole lifetime of the arena.
+ *
+ * Not synchronized, access must be guarded externally.
+ */
+class StringArena {
+public:
+    static constexpr size_t default_chunk_size = 1 << 20;
+
+private:
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    char *cursor_ = nullptr;
+    size_t remaining_ = 0;
+    size_t chunk_size_;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+
+public:
+    explicit StringArena(size_t chunk_size = default_chunk_size) noexcept;
+
+    StringArena(StringArena const &) = delete;
+    StringArena &operator=(StringArena const &) = delete;
+    StringArena(StringArena &&) noexcept = default;
+    StringArena &operator=(StringArena &&) noexcept = default;
+
+    /**
+     * Copies str into the arena.
+     * Strings that are larger than the chunk size get a chunk of their own.
+     * @param str string to be copied
+     * @return view of the copy, valid until the arena is destroyed
+     */
+    std::string_view copy(std::string_view str);
+
+    /**
+     * @return total number of bytes of all strings copied into the arena
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @return total number of bytes allocated by the arena
+     */
+    [[nodiscard]] size_t capacity() const noexcept;
+};
+
+}  // namespace rdf4cpp::rdf::storage::node::reference_node_storage
+
+#endif  //RDF4CPP_STRINGARENA_HPP
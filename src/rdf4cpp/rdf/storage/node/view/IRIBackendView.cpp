@@ -1,6 +1,6 @@
 #include "IRIBackendView.hpp"
 
-#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
 
 namespace rdf4cpp::rdf::storage::node::view {
 std::string IRIBackendView::n_string() const noexcept {
@@ -13,5 +13,5 @@ size_t IRIBackendView::hash() const noexcept {
 
 size_t std::hash<rdf4cpp::rdf::storage::node::view::IRIBackendView>::operator()(const rdf4cpp::rdf::storage::node::view::IRIBackendView &x) const noexcept {
     using namespace rdf4cpp::rdf::storage::util;
-    return robin_hood::hash<std::string_view>()(x.identifier);
+    return wyhash::hash_bytes(x.identifier.data(), x.identifier.size());
 }
\ No newline at end of file
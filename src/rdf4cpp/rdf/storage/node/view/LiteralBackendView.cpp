@@ -1,23 +1,38 @@
 #include "LiteralBackendView.hpp"
 
-#include "rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp"
-
-#include <array>
+#include "rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp"
 
 namespace rdf4cpp::rdf::storage::node::view {
 
 size_t LexicalFormLiteralBackendView::hash() const noexcept {
-    return util::robin_hood::hash<std::array<size_t, 3>>{}(
-                std::array<size_t, 3>{
-                        this->datatype_id.value(),
-                        util::robin_hood::hash<std::string_view>{}(this->lexical_form),
-                        util::robin_hood::hash<std::string_view>{}(this->language_tag)});
+    // datatype and language tag are folded into the seed, so that the (usually much longer) lexical form is hashed only once
+    auto const seed = util::wyhash::hash_int(this->datatype_id.value(),
+                                             util::wyhash::hash_bytes(this->language_tag.data(), this->language_tag.size()));
+    return util::wyhash::hash_bytes(this->lexical_form.data(), this->lexical_form.size(), seed);
 }
 
-LiteralBackendView::LiteralBackendView(ValueLiteralBackendView const &any) : inner{any} {}
+LiteralBackendView::LiteralBackendView(ValueLiteralBackendView const &any) : inner{ValueLiteralBackendView{.datatype = any.datatype, .value = any.value.clone()}} {}
 LiteralBackendView::LiteralBackendView(ValueLiteralBackendView &&any) noexcept : inner{std::move(any)} {}
 LiteralBackendView::LiteralBackendView(LexicalFormLiteralBackendView const &lexical) noexcept : inner{lexical} {}
 
+LiteralBackendView::LiteralBackendView(LiteralBackendView const &other)
+    : inner{other.visit(
+              [](LexicalFormLiteralBackendView const &lexical) noexcept -> decltype(inner) {
+                  return lexical;
+              },
+              [](ValueLiteralBackendView const &any) -> decltype(inner) {
+                  return ValueLiteralBackendView{.datatype = any.datatype, .value = any.value.clone()};
+              })} {
+}
+
+LiteralBackendView &LiteralBackendView::operator=(LiteralBackendView const &other) {
+    if (this != &other) {
+        *this = LiteralBackendView{other};
+    }
+
+    return *this;
+}
+
 bool LiteralBackendView::is_lexical() const noexcept {
     return this->inner.index() == 0;
 }
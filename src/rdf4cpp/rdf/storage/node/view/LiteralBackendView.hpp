@@ -1,9 +1,9 @@
 #ifndef RDF4CPP_LITERALBACKENDHANDLE_HPP
 #define RDF4CPP_LITERALBACKENDHANDLE_HPP
 
+#include <rdf4cpp/rdf/datatypes/registry/AnyValue.hpp>
 #include <rdf4cpp/rdf/storage/node/identifier/NodeID.hpp>
 
-#include <any>
 #include <string>
 #include <string_view>
 
@@ -22,7 +22,7 @@ struct LexicalFormLiteralBackendView {
 
 struct ValueLiteralBackendView {
     identifier::LiteralType datatype;
-    std::any value;
+    datatypes::registry::AnyValue value;
 };
 
 /**
@@ -42,6 +42,14 @@ public:
     LiteralBackendView(ValueLiteralBackendView &&any) noexcept;
     LiteralBackendView(LexicalFormLiteralBackendView const &lexical) noexcept;
 
+    /**
+     * Copies other, if other is a ValueLiteralBackendView its value is cloned
+     */
+    LiteralBackendView(LiteralBackendView const &other);
+    LiteralBackendView(LiteralBackendView &&other) noexcept = default;
+    LiteralBackendView &operator=(LiteralBackendView const &other);
+    LiteralBackendView &operator=(LiteralBackendView &&other) noexcept = default;
+
     [[nodiscard]] bool is_lexical() const noexcept;
     [[nodiscard]] bool is_value() const noexcept;
 
@@ -1,8 +1,6 @@
 #include "VariableBackendView.hpp"
 
-#include "rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp"
-
-#include <array>
+#include "rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp"
 
 namespace rdf4cpp::rdf::storage::node::view {
 std::string VariableBackendView::n_string() const noexcept {
@@ -18,8 +16,5 @@ size_t VariableBackendView::hash() const noexcept {
 
 size_t std::hash<rdf4cpp::rdf::storage::node::view::VariableBackendView>::operator()(const rdf4cpp::rdf::storage::node::view::VariableBackendView &x) const noexcept {
     using namespace rdf4cpp::rdf::storage::util;
-    return robin_hood::hash<std::array<size_t, 2>>()(
-            std::array<size_t, 2>{
-                    x.is_anonymous,
-                    robin_hood::hash<std::string_view>()(x.name)});
+    return wyhash::hash_bytes(x.name.data(), x.name.size(), static_cast<uint64_t>(x.is_anonymous));
 }
\ No newline at end of file
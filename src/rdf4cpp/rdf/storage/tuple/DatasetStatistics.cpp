@@ -0,0 +1,112 @@
+#include "DatasetStatistics.hpp"
+
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+namespace statistics_detail {
+
+static uint64_t hash(node::identifier::NodeBackendHandle const handle) noexcept {
+    return util::robin_hood::hash_int(handle.raw());
+}
+
+/**
+ * @return sketch's estimate, but at most upper_bound (the exact number of values that were added)
+ */
+static size_t distinct(HyperLogLog const &sketch, size_t const upper_bound) noexcept {
+    return std::min(static_cast<size_t>(std::llround(sketch.estimate())), upper_bound);
+}
+
+}  // namespace statistics_detail
+
+void DatasetStatistics::add(HandleQuad const &quad) {
+    ++size_;
+    ++graph_sizes_[quad.graph()];
+    subjects_.add(statistics_detail::hash(quad.subject()));
+    objects_.add(statistics_detail::hash(quad.object()));
+
+    auto &predicate = predicates_[quad.predicate()];
+    ++predicate.size;
+    predicate.subjects.add(statistics_detail::hash(quad.subject()));
+    predicate.objects.add(statistics_detail::hash(quad.object()));
+}
+
+size_t DatasetStatistics::size() const noexcept {
+    return size_;
+}
+
+size_t DatasetStatistics::graph_size(NodeBackendHandle const graph) const noexcept {
+    auto const it = graph_sizes_.find(graph);
+    return it == graph_sizes_.end() ? 0 : it->second;
+}
+
+size_t DatasetStatistics::predicate_size(NodeBackendHandle const predicate) const noexcept {
+    auto const it = predicates_.find(predicate);
+    return it == predicates_.end() ? 0 : it->second.size;
+}
+
+size_t DatasetStatistics::distinct_subjects() const noexcept {
+    return statistics_detail::distinct(subjects_, size_);
+}
+
+size_t DatasetStatistics::distinct_subjects(NodeBackendHandle const predicate) const noexcept {
+    auto const it = predicates_.find(predicate);
+    return it == predicates_.end() ? 0 : statistics_detail::distinct(it->second.subjects, it->second.size);
+}
+
+size_t DatasetStatistics::distinct_objects() const noexcept {
+    return statistics_detail::distinct(objects_, size_);
+}
+
+size_t DatasetStatistics::distinct_objects(NodeBackendHandle const predicate) const noexcept {
+    auto const it = predicates_.find(predicate);
+    return it == predicates_.end() ? 0 : statistics_detail::distinct(it->second.objects, it->second.size);
+}
+
+size_t DatasetStatistics::estimate_cardinality(query::QuadPattern const &quad_pattern) const noexcept {
+    double estimate = static_cast<double>(size_);
+    size_t subjects = distinct_subjects();
+    size_t objects = distinct_objects();
+
+    if (not quad_pattern.predicate().is_variable()) {
+        auto const it = predicates_.find(quad_pattern.predicate().backend_handle());
+        if (it == predicates_.end()) {
+            return 0;
+        }
+
+        auto const &predicate = it->second;
+        estimate = static_cast<double>(predicate.size);
+        subjects = statistics_detail::distinct(predicate.subjects, predicate.size);
+        objects = statistics_detail::distinct(predicate.objects, predicate.size);
+    }
+
+    if (not quad_pattern.graph().is_variable()) {
+        auto const in_graph = graph_size(quad_pattern.graph().backend_handle());
+        if (in_graph == 0) {
+            return 0;
+        }
+        // in_graph <= size_, so size_ != 0
+        estimate = quad_pattern.predicate().is_variable()
+                           ? static_cast<double>(in_graph)
+                           : estimate * static_cast<double>(in_graph) / static_cast<double>(size_);
+    }
+
+    if (estimate == 0.0) {
+        return 0;
+    }
+
+    if (not quad_pattern.subject().is_variable()) {
+        estimate /= static_cast<double>(std::max(subjects, size_t{1}));
+    }
+    if (not quad_pattern.object().is_variable()) {
+        estimate /= static_cast<double>(std::max(objects, size_t{1}));
+    }
+
+    // without an exact count there may always be a solution
+    return std::max(static_cast<size_t>(std::llround(estimate)), size_t{1});
+}
+
+}  // namespace rdf4cpp::rdf::storage::tuple
@@ -0,0 +1,91 @@
+#ifndef RDF4CPP_DATASETSTATISTICS_HPP
+#define RDF4CPP_DATASETSTATISTICS_HPP
+
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/storage/node/identifier/NodeBackendHandle.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HandleQuad.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HyperLogLog.hpp>
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
+
+#include <cstddef>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Statistics about the quads of a dataset that are maintained incrementally while quads are added:
+ * the number of quads per graph and per predicate and HyperLogLog sketches of the distinct subjects and objects,
+ * both overall and per predicate.
+ *
+ * They allow estimating the number of solutions of a QuadPattern without scanning the dataset,
+ * see estimate_cardinality.
+ * Nodes are identified by their NodeBackendHandle, so all quads and patterns must be in the same NodeStorage.
+ */
+class DatasetStatistics {
+    using NodeBackendHandle = node::identifier::NodeBackendHandle;
+
+    struct PredicateStatistics {
+        size_t size = 0;
+        HyperLogLog subjects;
+        HyperLogLog objects;
+    };
+
+    size_t size_ = 0;
+    HyperLogLog subjects_;
+    HyperLogLog objects_;
+    util::tsl::sparse_map<NodeBackendHandle, size_t> graph_sizes_;
+    util::tsl::sparse_map<NodeBackendHandle, PredicateStatistics> predicates_;
+
+public:
+    /**
+     * Records a quad.
+     * @pre quad is not yet part of the dataset, i.e. duplicates must not be recorded
+     */
+    void add(HandleQuad const &quad);
+
+    /**
+     * @return number of quads
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @return number of quads in graph
+     */
+    [[nodiscard]] size_t graph_size(NodeBackendHandle graph) const noexcept;
+
+    /**
+     * @return number of quads with predicate
+     */
+    [[nodiscard]] size_t predicate_size(NodeBackendHandle predicate) const noexcept;
+
+    /**
+     * @return estimated number of distinct subjects
+     */
+    [[nodiscard]] size_t distinct_subjects() const noexcept;
+
+    /**
+     * @return estimated number of distinct subjects of quads with predicate
+     */
+    [[nodiscard]] size_t distinct_subjects(NodeBackendHandle predicate) const noexcept;
+
+    /**
+     * @return estimated number of distinct objects
+     */
+    [[nodiscard]] size_t distinct_objects() const noexcept;
+
+    /**
+     * @return estimated number of distinct objects of quads with predicate
+     */
+    [[nodiscard]] size_t distinct_objects(NodeBackendHandle predicate) const noexcept;
+
+    /**
+     * Estimates the number of solutions of quad_pattern.
+     * Starts from the number of quads with the pattern's predicate (or all quads), scales it by the fraction of quads in its graph
+     * and divides it by the number of distinct subjects and objects for every bound subject and object, assuming that positions are independent.
+     * The result is exact if at most the graph or the predicate is bound. It is 0 only if the pattern has no solutions.
+     */
+    [[nodiscard]] size_t estimate_cardinality(query::QuadPattern const &quad_pattern) const noexcept;
+};
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_DATASETSTATISTICS_HPP
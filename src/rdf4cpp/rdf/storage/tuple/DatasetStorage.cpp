@@ -23,6 +23,12 @@ DatasetStorage DatasetStorage::new_instance() {
 void DatasetStorage::add(const Quad &quad) {
     backend_->add(quad);
 }
+void DatasetStorage::add_bulk(std::span<Quad const> quads) {
+    backend_->add_bulk(quads);
+}
+size_t DatasetStorage::load_from(parser::IStreamQuadIterator &quad_iterator) {
+    return backend_->load_from(quad_iterator);
+}
 bool DatasetStorage::contains(const Quad &quad) const {
     return backend_->contains(quad);
 }
@@ -35,6 +41,9 @@ DatasetStorage::PatternSolutions DatasetStorage::match(const DatasetStorage::Qua
 size_t DatasetStorage::size(const IRI &graph_name) const {
     return backend_->size(graph_name);
 }
+size_t DatasetStorage::estimate_cardinality(const DatasetStorage::QuadPattern &quad_pattern) const {
+    return backend_->estimate_cardinality(quad_pattern);
+}
 DatasetStorage::const_iterator DatasetStorage::begin() const {
     return backend_->begin();
 }
@@ -30,11 +30,26 @@ public:
 
     void add(const Quad &quad);
 
+    /**
+     * @see IDatasetBackend::add_bulk
+     */
+    void add_bulk(std::span<Quad const> quads);
+
+    /**
+     * @see IDatasetBackend::load_from
+     */
+    size_t load_from(parser::IStreamQuadIterator &quad_iterator);
+
     [[nodiscard]] bool contains(const Quad &quad) const;
     [[nodiscard]] size_t size() const;
     [[nodiscard]] PatternSolutions match(const QuadPattern &quad_pattern) const;
     [[nodiscard]] size_t size(const IRI &graph_name) const;
 
+    /**
+     * @see IDatasetBackend::estimate_cardinality
+     */
+    [[nodiscard]] size_t estimate_cardinality(const QuadPattern &quad_pattern) const;
+
     using const_iterator = IDatasetBackend::const_iterator;
 
     [[nodiscard]] const_iterator begin() const;
@@ -13,7 +13,9 @@ void DefaultDatasetBackend::add(const Quad &quad) {
     if (not quad.valid())
         throw std::logic_error{"Quad is not valid"};
     // TODO: check that RDFNodes live in node_storage_
-    quads_.emplace(quad);
+    if (quads_.emplace(quad).second) {
+        statistics_.add(HandleQuad::from_quad(quad));
+    }
 }
 
 bool DefaultDatasetBackend::contains(const Quad &quad) const {
@@ -29,7 +31,15 @@ query::SolutionSequence DefaultDatasetBackend::match(const QuadPattern &quad_pat
 }
 
 size_t DefaultDatasetBackend::size(const IRI &graph_name) const {
-    return std::count_if(quads_.begin(), quads_.end(), [&](const Quad &quad) { return quad.graph().as_iri() == graph_name; });
+    return statistics_.graph_size(graph_name.backend_handle());
+}
+
+size_t DefaultDatasetBackend::estimate_cardinality(const QuadPattern &quad_pattern) const {
+    return statistics_.estimate_cardinality(quad_pattern);
+}
+
+DatasetStatistics const &DefaultDatasetBackend::statistics() const noexcept {
+    return statistics_;
 }
 
 IDatasetBackend::const_iterator DefaultDatasetBackend::begin() const {
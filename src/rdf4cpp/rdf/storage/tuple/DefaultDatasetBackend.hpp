@@ -4,6 +4,7 @@
 #include <rdf4cpp/rdf/Quad.hpp>
 #include <rdf4cpp/rdf/query/QuadPattern.hpp>
 #include <rdf4cpp/rdf/query/SolutionSequence.hpp>
+#include <rdf4cpp/rdf/storage/tuple/DatasetStatistics.hpp>
 #include <rdf4cpp/rdf/storage/tuple/DefaultSolutionSequenceBackend.hpp>
 #include <rdf4cpp/rdf/storage/tuple/IDatasetBackend.hpp>
 
@@ -16,6 +17,8 @@ private:
     using PatternSolutions = rdf4cpp::rdf::query::SolutionSequence;
     using QuadPattern = rdf4cpp::rdf::query::QuadPattern;
 
+    DatasetStatistics statistics_;
+
 public:
     // TODO: thread safety
     std::set<Quad> quads_{};
@@ -34,6 +37,12 @@ public:
 
     [[nodiscard]] size_t size(const IRI &graph_name) const override;
 
+    /**
+     * Estimates from statistics(), see DatasetStatistics::estimate_cardinality.
+     */
+    [[nodiscard]] size_t estimate_cardinality(const QuadPattern &quad_pattern) const override;
+
+    [[nodiscard]] DatasetStatistics const &statistics() const noexcept;
 
     const_iterator begin() const override;
     const_iterator end() const override;
@@ -0,0 +1,24 @@
+#include "HandleQuad.hpp"
+
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+HandleQuad HandleQuad::from_quad(query::QuadPattern const &quad) noexcept {
+    return HandleQuad{{quad.graph().backend_handle(), quad.subject().backend_handle(), quad.predicate().backend_handle(), quad.object().backend_handle()}};
+}
+
+Quad HandleQuad::to_quad() const noexcept {
+    Quad quad;
+    auto it = quad.begin();
+    for (auto const handle : entries) {
+        (it++)->backend_handle() = handle;
+    }
+    return quad;
+}
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+size_t std::hash<rdf4cpp::rdf::storage::tuple::HandleQuad>::operator()(rdf4cpp::rdf::storage::tuple::HandleQuad const &v) const noexcept {
+    return rdf4cpp::rdf::storage::util::robin_hood::hash_bytes(v.entries.data(), sizeof(v.entries));
+}
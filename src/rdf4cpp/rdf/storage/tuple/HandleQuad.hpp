@@ -0,0 +1,70 @@
+#ifndef RDF4CPP_HANDLEQUAD_HPP
+#define RDF4CPP_HANDLEQUAD_HPP
+
+#include <rdf4cpp/rdf/Quad.hpp>
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/storage/node/identifier/NodeBackendHandle.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <type_traits>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Compact representation of a Quad for storage backends: the NodeBackendHandles of graph, subject, predicate and object.
+ *
+ * HandleQuads are ordered lexicographically by the raw values of their handles.
+ * In contrast to Quad, comparing HandleQuads never looks at the node storage or the values of literals.
+ * For nodes of the same NodeStorage equality of handles is equivalent to Node::operator==,
+ * but the order is unrelated to the order of Nodes.
+ */
+struct HandleQuad {
+    using Entries_t = std::array<node::identifier::NodeBackendHandle, 4>;
+
+    /**
+     * Handles in Quad order (graph, subject, predicate, object)
+     */
+    Entries_t entries{};
+
+    /**
+     * @param quad a Quad or QuadPattern
+     * @return the handles of quad's nodes
+     */
+    [[nodiscard]] static HandleQuad from_quad(query::QuadPattern const &quad) noexcept;
+
+    /**
+     * @return the Quad consisting of the nodes identified by this' handles
+     * @safety The NodeStorages of the handles must be alive.
+     */
+    [[nodiscard]] Quad to_quad() const noexcept;
+
+    [[nodiscard]] node::identifier::NodeBackendHandle graph() const noexcept { return entries[0]; }
+    [[nodiscard]] node::identifier::NodeBackendHandle subject() const noexcept { return entries[1]; }
+    [[nodiscard]] node::identifier::NodeBackendHandle predicate() const noexcept { return entries[2]; }
+    [[nodiscard]] node::identifier::NodeBackendHandle object() const noexcept { return entries[3]; }
+
+    [[nodiscard]] node::identifier::NodeBackendHandle &operator[](size_t const pos) noexcept { return entries[pos]; }
+    [[nodiscard]] node::identifier::NodeBackendHandle const &operator[](size_t const pos) const noexcept { return entries[pos]; }
+
+    [[nodiscard]] Entries_t::iterator begin() noexcept { return entries.begin(); }
+    [[nodiscard]] Entries_t::const_iterator begin() const noexcept { return entries.begin(); }
+    [[nodiscard]] Entries_t::iterator end() noexcept { return entries.end(); }
+    [[nodiscard]] Entries_t::const_iterator end() const noexcept { return entries.end(); }
+
+    bool operator==(HandleQuad const &other) const noexcept = default;
+    std::strong_ordering operator<=>(HandleQuad const &other) const noexcept = default;
+};
+
+static_assert(sizeof(HandleQuad) == 4 * sizeof(uint64_t));
+static_assert(std::is_trivially_copyable_v<HandleQuad>);
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+template<>
+struct std::hash<rdf4cpp::rdf::storage::tuple::HandleQuad> {
+    size_t operator()(rdf4cpp::rdf::storage::tuple::HandleQuad const &v) const noexcept;
+};
+
+#endif  //RDF4CPP_HANDLEQUAD_HPP
@@ -0,0 +1,35 @@
+#include "HyperLogLog.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+void HyperLogLog::add(uint64_t const hash) noexcept {
+    auto const ix = static_cast<size_t>(hash >> (64 - precision));
+    // position of the first 1 bit in the remaining bits, capped for an all zero remainder
+    auto const rank = static_cast<uint8_t>(std::min(std::countl_zero(hash << precision), static_cast<int>(64 - precision)) + 1);
+    registers_[ix] = std::max(registers_[ix], rank);
+}
+
+double HyperLogLog::estimate() const noexcept {
+    constexpr auto m = static_cast<double>(register_count);
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+
+    double sum = 0.0;
+    size_t zeros = 0;
+    for (auto const reg : registers_) {
+        sum += std::ldexp(1.0, -static_cast<int>(reg));
+        zeros += reg == 0;
+    }
+
+    auto const raw = alpha * m * m / sum;
+    if (raw <= 2.5 * m && zeros != 0) {
+        // small range correction: linear counting is more accurate while many registers are empty
+        return m * std::log(m / static_cast<double>(zeros));
+    }
+    return raw;
+}
+
+}  // namespace rdf4cpp::rdf::storage::tuple
@@ -0,0 +1,37 @@
+#ifndef RDF4CPP_HYPERLOGLOG_HPP
+#define RDF4CPP_HYPERLOGLOG_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * HyperLogLog sketch (Flajolet et al.) that estimates the number of distinct values that were added to it.
+ * Uses 2^precision one byte registers, the standard error of the estimate is about 1.04 / sqrt(2^precision), i.e. ~3%.
+ */
+class HyperLogLog {
+public:
+    static constexpr size_t precision = 10;
+    static constexpr size_t register_count = size_t{1} << precision;
+
+private:
+    std::array<uint8_t, register_count> registers_{};
+
+public:
+    /**
+     * Adds a value to the sketch.
+     * @param hash a well mixed 64 bit hash of the value, e.g. robin_hood::hash_int
+     */
+    void add(uint64_t hash) noexcept;
+
+    /**
+     * @return the estimated number of distinct values that were added
+     */
+    [[nodiscard]] double estimate() const noexcept;
+};
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_HYPERLOGLOG_HPP
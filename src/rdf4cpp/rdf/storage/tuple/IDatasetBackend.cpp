@@ -1,12 +1,67 @@
 #include "IDatasetBackend.hpp"
 
+#include <rdf4cpp/rdf/parser/IStreamQuadIterator.hpp>
+
+#include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace rdf4cpp::rdf::storage::tuple {
 
 IDatasetBackend::IDatasetBackend(node::NodeStorage &node_storage) : node_storage_{node_storage} {}
 
 IDatasetBackend::~IDatasetBackend() = default;
+
+void IDatasetBackend::check_quad(const Quad &quad) const {
+    if (not quad.valid())
+        throw std::logic_error{"Quad is not valid"};
+
+    // backends store the handles of the nodes, which are only meaningful within node_storage_
+    for (auto const &node : quad) {
+        if (node.backend_handle().node_storage_id() != node_storage_.id())
+            throw std::logic_error{"Quad is not in the NodeStorage of the dataset"};
+    }
+}
+
+void IDatasetBackend::add_bulk(std::span<Quad const> quads) {
+    for (auto const &quad : quads) {
+        this->add(quad);
+    }
+}
+
+size_t IDatasetBackend::load_from(parser::IStreamQuadIterator &quad_iterator) {
+    static constexpr size_t batch_size = 1 << 14;
+
+    std::vector<Quad> quads;
+    size_t errors = 0;
+
+    parser::IStreamQuadIterator const end{};
+    while (quad_iterator != end) {
+        if (quad_iterator.next_batch(quads, batch_size) == 0) {
+            // positioned on a ParsingError
+            ++errors;
+            ++quad_iterator;
+        }
+    }
+
+    auto &storage = this->node_storage();
+    for (auto &quad : quads) {
+        quad = quad.to_node_storage(storage);
+    }
+
+    this->add_bulk(quads);
+    return errors;
+}
+size_t IDatasetBackend::estimate_cardinality(const QuadPattern &quad_pattern) const {
+    auto const solutions = this->match(quad_pattern);
+
+    size_t count = 0;
+    for (auto it = solutions.begin(); it != solutions.end(); ++it) {
+        ++count;
+    }
+    return count;
+}
+
 IDatasetBackend::const_iterator::const_iterator(const IDatasetBackend::const_iterator &r) : _impl(r._impl->clone()) {}
 const IDatasetBackend::const_iterator::value_type &IDatasetBackend::const_iterator::operator*() const {
     return _impl->deref();
@@ -8,6 +8,11 @@
 
 #include <algorithm>
 #include <set>
+#include <span>
+
+namespace rdf4cpp::rdf::parser {
+struct IStreamQuadIterator;
+}  // namespace rdf4cpp::rdf::parser
 
 namespace rdf4cpp::rdf::storage::tuple {
 
@@ -19,17 +24,55 @@ class IDatasetBackend {
 protected:
     mutable node::NodeStorage node_storage_;
 
+    /**
+     * Checks the preconditions of add and add_bulk for a single quad.
+     * @throws std::logic_error if quad is not valid or one of its nodes is not in node_storage_
+     */
+    void check_quad(const Quad &quad) const;
+
 public:
     explicit IDatasetBackend(node::NodeStorage &node_storage = node::NodeStorage::default_instance());
 
     virtual ~IDatasetBackend() = 0;
     virtual void add(const Quad &quad) = 0;
+
+    /**
+     * Adds all quads at once. Has the same effect as calling add for each of them,
+     * but implementations may override it to sort and deduplicate the quads first and then build their index structures in a single pass.
+     * The default implementation calls add for each quad.
+     *
+     * @param quads quads to be added, must be in node_storage()
+     * @throws std::logic_error if a Quad is not valid
+     */
+    virtual void add_bulk(std::span<Quad const> quads);
+
+    /**
+     * Reads all remaining quads from quad_iterator and adds them with a single call to add_bulk.
+     * Quads that are not in node_storage() are moved there.
+     * ParsingErrors are skipped, use IStreamQuadIterator::next_batch directly if they need to be inspected.
+     *
+     * @param quad_iterator source of quads, is at the end afterwards
+     * @return number of ParsingErrors that were skipped
+     * @throws std::logic_error if a Quad is not valid
+     */
+    size_t load_from(parser::IStreamQuadIterator &quad_iterator);
+
     [[nodiscard]] virtual node::NodeStorage &node_storage() const = 0;
     [[nodiscard]] virtual bool contains(const Quad &quad) const = 0;
     [[nodiscard]] virtual size_t size() const = 0;
     [[nodiscard]] virtual PatternSolutions match(const QuadPattern &quad_pattern) const = 0;
     [[nodiscard]] virtual size_t size(const IRI &graph_name) const = 0;
 
+    /**
+     * Estimates the number of solutions of quad_pattern without evaluating it, e.g. to order the patterns of a join.
+     * Implementations answer from maintained statistics or index ranges.
+     * The default implementation is exact but counts the solutions of match(quad_pattern).
+     *
+     * @param quad_pattern pattern to be estimated, must be in node_storage()
+     * @return estimated number of solutions, 0 only if there are none
+     */
+    [[nodiscard]] virtual size_t estimate_cardinality(const QuadPattern &quad_pattern) const;
+
     struct const_iterator {
         // from https://stackoverflow.com/questions/35866041/returning-different-iterators-with-virtual-derived-methods
         using value_type = Quad;
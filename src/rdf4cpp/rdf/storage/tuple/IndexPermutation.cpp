@@ -0,0 +1,83 @@
+#include "IndexPermutation.hpp"
+
+#include <bit>
+#include <limits>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+namespace index_detail {
+
+/**
+ * Number of leading positions of permutation that are bound according to bound_mask.
+ */
+static constexpr size_t bound_prefix_len(IndexPermutation const &permutation, uint8_t const bound_mask) noexcept {
+    size_t len = 0;
+    while (len < permutation.size() && (bound_mask & (1 << permutation[len])) != 0) {
+        ++len;
+    }
+    return len;
+}
+
+/**
+ * For every combination of bound positions (bit i set <=> position i is bound) the best permutation and the length of its bound prefix.
+ */
+static constexpr std::array<std::pair<size_t, size_t>, 16> make_index_selection_lut() noexcept {
+    std::array<std::pair<size_t, size_t>, 16> lut{};
+    for (uint8_t mask = 0; mask < lut.size(); ++mask) {
+        for (size_t ix = 0; ix < index_permutations.size(); ++ix) {
+            if (auto const len = bound_prefix_len(index_permutations[ix], mask); len > lut[mask].second) {
+                lut[mask] = {ix, len};
+            }
+        }
+    }
+    return lut;
+}
+
+static constexpr auto index_selection_lut = make_index_selection_lut();
+
+static_assert([]() {
+    // every bound position must be part of the selected prefix
+    for (uint8_t mask = 0; mask < index_selection_lut.size(); ++mask) {
+        if (static_cast<size_t>(std::popcount(mask)) != index_selection_lut[mask].second) {
+            return false;
+        }
+    }
+    return true;
+}());
+
+}  // namespace index_detail
+
+HandleQuad permute(IndexPermutation const &permutation, HandleQuad const &quad_order) noexcept {
+    return HandleQuad{{quad_order[permutation[0]], quad_order[permutation[1]], quad_order[permutation[2]], quad_order[permutation[3]]}};
+}
+
+HandleQuad unpermute(IndexPermutation const &permutation, HandleQuad const &index_order) noexcept {
+    HandleQuad quad_order;
+    for (size_t ix = 0; ix < permutation.size(); ++ix) {
+        quad_order[permutation[ix]] = index_order[ix];
+    }
+    return quad_order;
+}
+
+std::pair<size_t, size_t> select_permutation(query::QuadPattern const &quad_pattern) noexcept {
+    uint8_t bound_mask = 0;
+    for (size_t pos = 0; pos < 4; ++pos) {
+        if (not(quad_pattern.begin() + pos)->is_variable()) {
+            bound_mask |= 1 << pos;
+        }
+    }
+
+    return index_detail::index_selection_lut[bound_mask];
+}
+
+std::pair<HandleQuad, HandleQuad> prefix_bounds(HandleQuad const &key, size_t const prefix_len) noexcept {
+    HandleQuad lower = key;
+    HandleQuad upper = key;
+    for (size_t ix = prefix_len; ix < key.entries.size(); ++ix) {
+        lower[ix] = node::identifier::NodeBackendHandle::from_raw(0);
+        upper[ix] = node::identifier::NodeBackendHandle::from_raw(std::numeric_limits<uint64_t>::max());
+    }
+    return {lower, upper};
+}
+
+}  // namespace rdf4cpp::rdf::storage::tuple
@@ -0,0 +1,62 @@
+#ifndef RDF4CPP_INDEXPERMUTATION_HPP
+#define RDF4CPP_INDEXPERMUTATION_HPP
+
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HandleQuad.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Order in which the positions of a Quad (0: graph, 1: subject, 2: predicate, 3: object) are stored in an index.
+ * E.g. {0, 2, 3, 1} is GPOS.
+ */
+using IndexPermutation = std::array<uint8_t, 4>;
+
+/**
+ * The permutations that are maintained by the permutation indexed backends:
+ * GSPO, GPOS, GOSP, SPOG, POSG and OSPG.
+ * Together they cover every combination of bound positions as a prefix.
+ */
+inline constexpr std::array<IndexPermutation, 6> index_permutations{{
+        {0, 1, 2, 3},  // GSPO
+        {0, 2, 3, 1},  // GPOS
+        {0, 3, 1, 2},  // GOSP
+        {1, 2, 3, 0},  // SPOG
+        {2, 3, 1, 0},  // POSG
+        {3, 1, 2, 0},  // OSPG
+}};
+
+/**
+ * Reorders a tuple in Quad order (graph, subject, predicate, object) into the order of permutation.
+ */
+[[nodiscard]] HandleQuad permute(IndexPermutation const &permutation, HandleQuad const &quad_order) noexcept;
+
+/**
+ * Reorders a tuple in the order of permutation back into Quad order (graph, subject, predicate, object).
+ */
+[[nodiscard]] HandleQuad unpermute(IndexPermutation const &permutation, HandleQuad const &index_order) noexcept;
+
+/**
+ * Selects the permutation that answers the given QuadPattern with a single range scan.
+ * Positions that are not variables are considered bound.
+ * @param quad_pattern pattern to be matched
+ * @return the position of the permutation in index_permutations and the number of leading bound positions in it
+ */
+[[nodiscard]] std::pair<size_t, size_t> select_permutation(query::QuadPattern const &quad_pattern) noexcept;
+
+/**
+ * Smallest and largest tuple that start with the first prefix_len entries of key.
+ * All tuples t with lower <= t <= upper share that prefix.
+ * @param key tuple in index order
+ * @param prefix_len number of leading entries of key that must match
+ */
+[[nodiscard]] std::pair<HandleQuad, HandleQuad> prefix_bounds(HandleQuad const &key, size_t prefix_len) noexcept;
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_INDEXPERMUTATION_HPP
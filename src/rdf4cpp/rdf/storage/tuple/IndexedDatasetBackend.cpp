@@ -0,0 +1,206 @@
+#include "IndexedDatasetBackend.hpp"
+
+#include <rdf4cpp/rdf/storage/tuple/IndexedSolutionSequenceBackend.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+namespace index_detail {
+
+/**
+ * Minimum number of quads for which IndexedDatasetBackend::add_bulk builds the indexes in parallel.
+ * Below that the cost of starting the threads outweighs the gain.
+ */
+static constexpr size_t parallel_bulk_threshold = 1 << 14;
+
+}  // namespace index_detail
+
+HandleQuad PermutationIndex::permute(HandleQuad const &quad_order) const noexcept {
+    return tuple::permute(permutation, quad_order);
+}
+
+HandleQuad PermutationIndex::unpermute(HandleQuad const &index_order) const noexcept {
+    return tuple::unpermute(permutation, index_order);
+}
+
+std::pair<std::set<HandleQuad>::const_iterator, std::set<HandleQuad>::const_iterator> PermutationIndex::prefix_range(HandleQuad const &key, size_t const prefix_len) const noexcept {
+    if (prefix_len == 0) {
+        return {entries.begin(), entries.end()};
+    }
+
+    auto const [lower, upper] = prefix_bounds(key, prefix_len);
+    return {entries.lower_bound(lower), entries.upper_bound(upper)};
+}
+
+void PermutationIndex::insert_sorted(std::span<HandleQuad const> const sorted_entries) {
+    assert(std::is_sorted(sorted_entries.begin(), sorted_entries.end()));
+
+    // for sorted input the position of the next entry is usually right before the successor of the last one
+    auto hint = entries.begin();
+    for (auto const &entry : sorted_entries) {
+        hint = std::next(entries.emplace_hint(hint, entry));
+    }
+}
+
+IndexedDatasetBackend::quad_iterator::quad_iterator(std::set<HandleQuad>::const_iterator iter, PermutationIndex const *index) noexcept
+    : iter_{iter}, index_{index} {
+}
+const IndexedDatasetBackend::quad_iterator::value_type &IndexedDatasetBackend::quad_iterator::operator*() const noexcept {
+    quad_ = index_->unpermute(*iter_).to_quad();
+    return quad_;
+}
+IndexedDatasetBackend::quad_iterator &IndexedDatasetBackend::quad_iterator::operator++() noexcept {
+    ++iter_;
+    return *this;
+}
+IndexedDatasetBackend::quad_iterator IndexedDatasetBackend::quad_iterator::operator++(int) noexcept {
+    auto copy = *this;
+    ++iter_;
+    return copy;
+}
+bool IndexedDatasetBackend::quad_iterator::operator==(const IndexedDatasetBackend::quad_iterator &other) const noexcept {
+    return iter_ == other.iter_;
+}
+bool IndexedDatasetBackend::quad_iterator::operator!=(const IndexedDatasetBackend::quad_iterator &other) const noexcept {
+    return not(*this == other);
+}
+
+IndexedDatasetBackend::IndexedDatasetBackend(node::NodeStorage &node_storage) : IDatasetBackend{node_storage} {
+    for (size_t ix = 0; ix < index_count; ++ix) {
+        indexes_[ix].permutation = index_permutations[ix];
+    }
+}
+
+node::NodeStorage &IndexedDatasetBackend::node_storage() const {
+    return this->node_storage_;
+}
+
+PermutationIndex const &IndexedDatasetBackend::gspo() const noexcept {
+    return indexes_[0];
+}
+
+void IndexedDatasetBackend::add(const Quad &quad) {
+    check_quad(quad);
+
+    auto const handles = HandleQuad::from_quad(quad);
+    if (gspo().entries.contains(handles)) {
+        return;
+    }
+
+    for (auto &index : indexes_) {
+        index.entries.emplace(index.permute(handles));
+    }
+    statistics_.add(handles);
+}
+
+void IndexedDatasetBackend::add_bulk(std::span<Quad const> const quads) {
+    std::vector<HandleQuad> handles;
+    handles.reserve(quads.size());
+    for (auto const &quad : quads) {
+        check_quad(quad);
+        handles.push_back(HandleQuad::from_quad(quad));
+    }
+
+    // only new quads must be recorded in the statistics
+    std::sort(handles.begin(), handles.end());
+    handles.erase(std::unique(handles.begin(), handles.end()), handles.end());
+    std::erase_if(handles, [this](HandleQuad const &quad) { return gspo().entries.contains(quad); });
+
+    auto const build_index = [&handles](PermutationIndex &index) {
+        std::vector<HandleQuad> permuted;
+        permuted.reserve(handles.size());
+        for (auto const &quad : handles) {
+            permuted.push_back(index.permute(quad));
+        }
+
+        std::sort(permuted.begin(), permuted.end());
+        permuted.erase(std::unique(permuted.begin(), permuted.end()), permuted.end());
+        index.insert_sorted(permuted);
+    };
+
+    if (handles.size() < index_detail::parallel_bulk_threshold) {
+        for (auto &index : indexes_) {
+            build_index(index);
+        }
+    } else {
+        std::array<std::exception_ptr, index_count> errors{};
+        {
+            // std::jthread joins on destruction, so the already started workers are joined even if starting another one throws
+            std::vector<std::jthread> workers;
+            workers.reserve(index_count);
+            for (size_t ix = 0; ix < index_count; ++ix) {
+                workers.emplace_back([&, ix]() {
+                    try {
+                        build_index(indexes_[ix]);
+                    } catch (...) {
+                        errors[ix] = std::current_exception();
+                    }
+                });
+            }
+        }
+
+        for (auto const &error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    // the statistics describe the indexes, so they are only updated once all indexes contain the quads
+    for (auto const &quad : handles) {
+        statistics_.add(quad);
+    }
+}
+
+bool IndexedDatasetBackend::contains(const Quad &quad) const {
+    return gspo().entries.contains(HandleQuad::from_quad(quad));
+}
+
+size_t IndexedDatasetBackend::size() const {
+    return gspo().entries.size();
+}
+
+std::pair<PermutationIndex const *, size_t> IndexedDatasetBackend::select_index(const QuadPattern &quad_pattern) const noexcept {
+    auto const [index_ix, prefix_len] = select_permutation(quad_pattern);
+    return {&indexes_[index_ix], prefix_len};
+}
+
+query::SolutionSequence IndexedDatasetBackend::match(const QuadPattern &quad_pattern) const {
+    auto const [index, prefix_len] = select_index(quad_pattern);
+    auto const [first, last] = index->prefix_range(index->permute(HandleQuad::from_quad(quad_pattern)), prefix_len);
+
+    return query::SolutionSequence::new_instance<IndexedSolutionSequenceBackend>(quad_pattern, index, first, last);
+}
+
+size_t IndexedDatasetBackend::size(const IRI &graph_name) const {
+    return statistics_.graph_size(graph_name.backend_handle());
+}
+
+size_t IndexedDatasetBackend::estimate_cardinality(const QuadPattern &quad_pattern) const {
+    auto const [index, prefix_len] = select_index(quad_pattern);
+    if (prefix_len == 0) {
+        return size();
+    }
+    if (prefix_len == 4) {
+        return gspo().entries.contains(HandleQuad::from_quad(quad_pattern)) ? 1 : 0;
+    }
+    return statistics_.estimate_cardinality(quad_pattern);
+}
+
+DatasetStatistics const &IndexedDatasetBackend::statistics() const noexcept {
+    return statistics_;
+}
+
+IDatasetBackend::const_iterator IndexedDatasetBackend::begin() const {
+    return const_iterator(quad_iterator{gspo().entries.begin(), &gspo()});
+}
+IDatasetBackend::const_iterator IndexedDatasetBackend::end() const {
+    return const_iterator(quad_iterator{gspo().entries.end(), &gspo()});
+}
+}  // namespace rdf4cpp::rdf::storage::tuple
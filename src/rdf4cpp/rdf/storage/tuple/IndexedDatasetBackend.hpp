@@ -0,0 +1,141 @@
+#ifndef RDF4CPP_INDEXEDDATASETBACKEND_HPP
+#define RDF4CPP_INDEXEDDATASETBACKEND_HPP
+
+#include <rdf4cpp/rdf/Quad.hpp>
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/query/SolutionSequence.hpp>
+#include <rdf4cpp/rdf/storage/tuple/DatasetStatistics.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HandleQuad.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexPermutation.hpp>
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <span>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * A single sorted permutation index. Quads are stored as HandleQuads permuted according to permutation
+ * so that every prefix of the permutation can be answered with a range scan.
+ */
+struct PermutationIndex {
+    IndexPermutation permutation;
+    std::set<HandleQuad> entries;
+
+    /**
+     * Reorders a tuple in Quad order (graph, subject, predicate, object) into the order of this index.
+     */
+    [[nodiscard]] HandleQuad permute(HandleQuad const &quad_order) const noexcept;
+
+    /**
+     * Reorders a tuple in the order of this index back into Quad order (graph, subject, predicate, object).
+     */
+    [[nodiscard]] HandleQuad unpermute(HandleQuad const &index_order) const noexcept;
+
+    /**
+     * Range of all entries that start with the first prefix_len entries of key.
+     * @param key tuple in the order of this index
+     * @param prefix_len number of leading entries of key that must match
+     */
+    [[nodiscard]] std::pair<std::set<HandleQuad>::const_iterator, std::set<HandleQuad>::const_iterator> prefix_range(HandleQuad const &key, size_t prefix_len) const noexcept;
+
+    /**
+     * Inserts all entries in a single pass over entries.
+     * @param sorted_entries tuples in the order of this index, must be sorted
+     */
+    void insert_sorted(std::span<HandleQuad const> sorted_entries);
+};
+
+/**
+ * IDatasetBackend that stores quads as HandleQuads in the sorted permutation indexes
+ * GSPO, GPOS, GOSP, SPOG, POSG and OSPG.
+ * For any combination of bound positions in a QuadPattern there is an index that has exactly these positions as prefix,
+ * so match() is a range scan over the matching quads instead of a scan over the whole dataset.
+ *
+ * Quads and QuadPatterns must be in the NodeStorage of this backend (Dataset takes care of that).
+ * Nodes are compared by their NodeBackendHandle, which is equivalent to Node::operator== for nodes within the same NodeStorage.
+ *
+ * Not thread-safe: concurrent reads are fine, but add() and add_bulk() must not run concurrently with any other call.
+ * Use MVCCDatasetBackend if readers and a writer need to run concurrently.
+ */
+class IndexedDatasetBackend : public IDatasetBackend {
+    using PatternSolutions = rdf4cpp::rdf::query::SolutionSequence;
+    using QuadPattern = rdf4cpp::rdf::query::QuadPattern;
+
+public:
+    static constexpr size_t index_count = index_permutations.size();
+
+    /**
+     * Forward iterator over the quads of an index that materializes the current entry as Quad.
+     */
+    struct quad_iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = Quad;
+
+        std::set<HandleQuad>::const_iterator iter_;
+        PermutationIndex const *index_{};
+        mutable Quad quad_;
+
+        quad_iterator() = default;
+        quad_iterator(std::set<HandleQuad>::const_iterator iter, PermutationIndex const *index) noexcept;
+
+        const value_type &operator*() const noexcept;
+        quad_iterator &operator++() noexcept;
+        quad_iterator operator++(int) noexcept;
+
+        bool operator==(const quad_iterator &other) const noexcept;
+        bool operator!=(const quad_iterator &other) const noexcept;
+    };
+
+private:
+    std::array<PermutationIndex, index_count> indexes_;
+    DatasetStatistics statistics_;
+
+    [[nodiscard]] PermutationIndex const &gspo() const noexcept;
+
+public:
+    explicit IndexedDatasetBackend(node::NodeStorage &node_storage = node::NodeStorage::default_instance());
+
+    [[nodiscard]] node::NodeStorage &node_storage() const override;
+
+    void add(const Quad &quad) override;
+
+    /**
+     * Sorts and deduplicates the quads for each index and merges them into the index in a single pass.
+     * For large inputs the indexes are built in parallel, one thread per index.
+     * If a Quad is not valid or not in node_storage(), nothing is added.
+     */
+    void add_bulk(std::span<Quad const> quads) override;
+
+    [[nodiscard]] bool contains(const Quad &quad) const override;
+
+    [[nodiscard]] size_t size() const override;
+
+    [[nodiscard]] PatternSolutions match(const QuadPattern &quad_pattern) const override;
+
+    [[nodiscard]] size_t size(const IRI &graph_name) const override;
+
+    /**
+     * Exact if all or none of the positions of quad_pattern are bound, otherwise estimated from statistics(),
+     * see DatasetStatistics::estimate_cardinality.
+     */
+    [[nodiscard]] size_t estimate_cardinality(const QuadPattern &quad_pattern) const override;
+
+    [[nodiscard]] DatasetStatistics const &statistics() const noexcept;
+
+    const_iterator begin() const override;
+    const_iterator end() const override;
+
+    /**
+     * Selects the index that answers the given QuadPattern with a single range scan.
+     * Positions that are not variables are considered bound.
+     * @param quad_pattern pattern to be matched
+     * @return the index and the number of leading bound positions in its permutation
+     */
+    [[nodiscard]] std::pair<PermutationIndex const *, size_t> select_index(const QuadPattern &quad_pattern) const noexcept;
+};
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_INDEXEDDATASETBACKEND_HPP
@@ -0,0 +1,56 @@
+#include "IndexedSolutionSequenceBackend.hpp"
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+IndexedSolutionSequenceBackend::IndexedSolutionSequenceBackend(QuadPattern pattern, PermutationIndex const *index, EntryIter begin, EntryIter end)
+    : ISolutionSequenceBackend(pattern), index_{index}, begin_{begin}, end_{end} {
+}
+ISolutionSequenceBackend::const_iterator IndexedSolutionSequenceBackend::begin() const {
+    return ISolutionSequenceBackend::const_iterator{const_iterator{begin_, end_, index_, pattern_}};
+}
+ISolutionSequenceBackend::const_iterator IndexedSolutionSequenceBackend::end() const {
+    return ISolutionSequenceBackend::const_iterator{const_iterator{end_, end_, index_, pattern_}};
+}
+IndexedSolutionSequenceBackend::const_iterator::const_iterator(EntryIter iter, EntryIter end, PermutationIndex const *index, const QuadPattern &pattern)
+    : iter_{iter}, end_{end}, index_{index}, solution_{pattern} {
+    uint8_t pos = 0;
+    for (auto const &entry : pattern) {
+        if (entry.is_variable()) {
+            variable_positions_[variable_count_++] = pos;
+        }
+        ++pos;
+    }
+
+    if (not ended())
+        fill_solution();
+}
+bool IndexedSolutionSequenceBackend::const_iterator::ended() const {
+    return iter_ == end_;
+}
+void IndexedSolutionSequenceBackend::const_iterator::fill_solution() {
+    auto const quad = index_->unpermute(*iter_);
+    for (size_t solution_pos = 0; solution_pos < variable_count_; ++solution_pos) {
+        solution_[solution_pos].backend_handle() = quad[variable_positions_[solution_pos]];
+    }
+}
+const IndexedSolutionSequenceBackend::const_iterator::value_type &IndexedSolutionSequenceBackend::const_iterator::operator*() const {
+    return solution_;
+}
+IndexedSolutionSequenceBackend::const_iterator &IndexedSolutionSequenceBackend::const_iterator::operator++() {
+    iter_++;
+    if (not ended())
+        fill_solution();
+    return *this;
+}
+IndexedSolutionSequenceBackend::const_iterator IndexedSolutionSequenceBackend::const_iterator::operator++(int) & {
+    auto copy = const_iterator(*this);
+    ++(*this);
+    return copy;
+}
+bool IndexedSolutionSequenceBackend::const_iterator::operator==(const IndexedSolutionSequenceBackend::const_iterator &r) const {
+    return this->iter_ == r.iter_;
+}
+bool IndexedSolutionSequenceBackend::const_iterator::operator!=(const IndexedSolutionSequenceBackend::const_iterator &r) const {
+    return not(*this == r);
+}
+}  // namespace rdf4cpp::rdf::storage::tuple
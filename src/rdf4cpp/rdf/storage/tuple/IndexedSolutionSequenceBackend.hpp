@@ -0,0 +1,63 @@
+#ifndef RDF4CPP_INDEXEDSOLUTIONSEQUENCEBACKEND_HPP
+#define RDF4CPP_INDEXEDSOLUTIONSEQUENCEBACKEND_HPP
+
+#include <rdf4cpp/rdf/storage/tuple/ISolutionSequenceBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Solutions of a QuadPattern over a range of a PermutationIndex.
+ * The range must only contain matches of the pattern.
+ */
+class IndexedSolutionSequenceBackend : public ISolutionSequenceBackend {
+    using QuadPattern = query::QuadPattern;
+    using Solution = query::Solution;
+    using EntryIter = std::set<HandleQuad>::const_iterator;
+
+    PermutationIndex const *index_{};
+    EntryIter begin_;
+    EntryIter end_;
+
+public:
+    IndexedSolutionSequenceBackend() = default;
+    IndexedSolutionSequenceBackend(QuadPattern pattern, PermutationIndex const *index, EntryIter begin, EntryIter end);
+    ~IndexedSolutionSequenceBackend() override = default;
+
+    [[nodiscard]] ISolutionSequenceBackend::const_iterator begin() const override;
+    [[nodiscard]] ISolutionSequenceBackend::const_iterator end() const override;
+
+    struct const_iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = Solution;
+        EntryIter iter_;
+        EntryIter end_;
+        PermutationIndex const *index_{};
+        /**
+         * Quad positions (0: graph, 1: subject, 2: predicate, 3: object) of the variables in the pattern in solution order
+         */
+        std::array<uint8_t, 4> variable_positions_{};
+        size_t variable_count_ = 0;
+        mutable Solution solution_;
+
+        const_iterator() = default;
+        const_iterator(EntryIter iter, EntryIter end, PermutationIndex const *index, const QuadPattern &pattern);
+
+        [[nodiscard]] bool ended() const;
+        void fill_solution();
+
+        const value_type &operator*() const;
+
+        const_iterator &operator++();
+
+        const_iterator operator++(int) &;
+
+        bool operator==(const const_iterator &r) const;
+
+        bool operator!=(const const_iterator &r) const;
+    };
+};
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_INDEXEDSOLUTIONSEQUENCEBACKEND_HPP
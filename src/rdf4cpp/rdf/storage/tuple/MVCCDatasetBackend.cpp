@@ -0,0 +1,249 @@
+#include "MVCCDatasetBackend.hpp"
+
+#include <rdf4cpp/rdf/storage/tuple/MVCCSolutionSequenceBackend.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+namespace mvcc_detail {
+
+/**
+ * Maximum size of the delta before it is merged into a base of base_size quads.
+ * Copying the delta on every add and merging it once it is full both cost O(sqrt(n)) per add on average.
+ */
+static size_t merge_threshold(size_t const base_size) noexcept {
+    return std::max(MVCCDatasetBackend::min_delta_size, static_cast<size_t>(std::sqrt(static_cast<double>(base_size))));
+}
+
+/**
+ * @return a run that contains the tuples of a and b
+ * @pre a and b are disjoint
+ */
+static std::shared_ptr<SortedRun const> merge(SortedRun const &a, SortedRun const &b) {
+    auto merged = std::make_shared<SortedRun>();
+    for (size_t ix = 0; ix < merged->indexes.size(); ++ix) {
+        auto const &a_entries = a.indexes[ix];
+        auto const &b_entries = b.indexes[ix];
+
+        auto &entries = merged->indexes[ix];
+        entries.reserve(a_entries.size() + b_entries.size());
+        std::merge(a_entries.begin(), a_entries.end(), b_entries.begin(), b_entries.end(), std::back_inserter(entries));
+    }
+    return merged;
+}
+
+}  // namespace mvcc_detail
+
+size_t SortedRun::size() const noexcept {
+    return indexes[0].size();
+}
+
+bool SortedRun::contains(HandleQuad const &quad_order) const noexcept {
+    static_assert(index_permutations[0] == IndexPermutation{0, 1, 2, 3}, "the first index must be in Quad order");
+    return std::binary_search(indexes[0].begin(), indexes[0].end(), quad_order);
+}
+
+std::span<HandleQuad const> SortedRun::prefix_range(size_t const index_ix, HandleQuad const &key, size_t const prefix_len) const noexcept {
+    auto const &entries = indexes[index_ix];
+    if (prefix_len == 0) {
+        return entries;
+    }
+
+    auto const [lower, upper] = prefix_bounds(key, prefix_len);
+    auto const first = std::lower_bound(entries.begin(), entries.end(), lower);
+    auto const last = std::upper_bound(first, entries.end(), upper);
+    return {first, last};
+}
+
+bool MergeCursor::ended() const noexcept {
+    return first.empty() && second.empty();
+}
+
+HandleQuad const &MergeCursor::current() const noexcept {
+    if (second.empty() || (!first.empty() && first.front() < second.front())) {
+        return first.front();
+    }
+    return second.front();
+}
+
+void MergeCursor::advance() noexcept {
+    if (second.empty() || (!first.empty() && first.front() < second.front())) {
+        first = first.subspan(1);
+    } else {
+        second = second.subspan(1);
+    }
+}
+
+bool MergeCursor::operator==(MergeCursor const &other) const noexcept {
+    if (ended() || other.ended()) {
+        return ended() == other.ended();
+    }
+    return first.data() == other.first.data() && second.data() == other.second.data();
+}
+
+size_t MVCCDatasetBackend::Snapshot::size() const noexcept {
+    return base->size() + delta->size();
+}
+
+bool MVCCDatasetBackend::Snapshot::contains(HandleQuad const &quad_order) const noexcept {
+    return delta->contains(quad_order) || base->contains(quad_order);
+}
+
+MergeCursor MVCCDatasetBackend::Snapshot::prefix_range(size_t const index_ix, HandleQuad const &key, size_t const prefix_len) const noexcept {
+    return MergeCursor{base->prefix_range(index_ix, key, prefix_len), delta->prefix_range(index_ix, key, prefix_len)};
+}
+
+MVCCDatasetBackend::quad_iterator::quad_iterator(std::shared_ptr<Snapshot const> snapshot) noexcept
+    : snapshot_{std::move(snapshot)}, cursor_{snapshot_->base->indexes[0], snapshot_->delta->indexes[0]} {
+}
+const MVCCDatasetBackend::quad_iterator::value_type &MVCCDatasetBackend::quad_iterator::operator*() const noexcept {
+    // the first index is in Quad order
+    quad_ = cursor_.current().to_quad();
+    return quad_;
+}
+MVCCDatasetBackend::quad_iterator &MVCCDatasetBackend::quad_iterator::operator++() noexcept {
+    cursor_.advance();
+    return *this;
+}
+MVCCDatasetBackend::quad_iterator MVCCDatasetBackend::quad_iterator::operator++(int) noexcept {
+    auto copy = *this;
+    cursor_.advance();
+    return copy;
+}
+bool MVCCDatasetBackend::quad_iterator::operator==(const MVCCDatasetBackend::quad_iterator &other) const noexcept {
+    return cursor_ == other.cursor_;
+}
+bool MVCCDatasetBackend::quad_iterator::operator!=(const MVCCDatasetBackend::quad_iterator &other) const noexcept {
+    return not(*this == other);
+}
+
+MVCCDatasetBackend::MVCCDatasetBackend(node::NodeStorage &node_storage) : IDatasetBackend{node_storage} {
+    auto const empty = std::make_shared<SortedRun const>();
+    publish(std::make_shared<Snapshot const>(Snapshot{empty, empty}));
+}
+
+node::NodeStorage &MVCCDatasetBackend::node_storage() const {
+    return this->node_storage_;
+}
+
+std::shared_ptr<MVCCDatasetBackend::Snapshot const> MVCCDatasetBackend::snapshot() const noexcept {
+#ifdef __cpp_lib_atomic_shared_ptr
+    return current_.load(std::memory_order_acquire);
+#else
+    return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+#endif
+}
+
+void MVCCDatasetBackend::publish(std::shared_ptr<Snapshot const> snapshot) noexcept {
+#ifdef __cpp_lib_atomic_shared_ptr
+    current_.store(std::move(snapshot), std::memory_order_release);
+#else
+    std::atomic_store_explicit(&current_, std::move(snapshot), std::memory_order_release);
+#endif
+}
+
+void MVCCDatasetBackend::add(const Quad &quad) {
+    check_quad(quad);
+
+    auto const handles = HandleQuad::from_quad(quad);
+
+    std::lock_guard lock{writer_mutex_};
+    auto const current = snapshot();
+    if (current->contains(handles)) {
+        return;
+    }
+
+    auto delta = std::make_shared<SortedRun>(*current->delta);
+    for (size_t ix = 0; ix < index_count; ++ix) {
+        auto &entries = delta->indexes[ix];
+        auto const entry = permute(index_permutations[ix], handles);
+        entries.insert(std::lower_bound(entries.begin(), entries.end(), entry), entry);
+    }
+
+    if (delta->size() > mvcc_detail::merge_threshold(current->base->size())) {
+        publish(std::make_shared<Snapshot const>(Snapshot{mvcc_detail::merge(*current->base, *delta), std::make_shared<SortedRun const>()}));
+    } else {
+        publish(std::make_shared<Snapshot const>(Snapshot{current->base, std::move(delta)}));
+    }
+}
+
+void MVCCDatasetBackend::add_bulk(std::span<Quad const> const quads) {
+    std::vector<HandleQuad> handles;
+    handles.reserve(quads.size());
+    for (auto const &quad : quads) {
+        check_quad(quad);
+        handles.push_back(HandleQuad::from_quad(quad));
+    }
+
+    std::sort(handles.begin(), handles.end());
+    handles.erase(std::unique(handles.begin(), handles.end()), handles.end());
+
+    std::lock_guard lock{writer_mutex_};
+    auto const current = snapshot();
+
+    // only quads that are not in the current version, so that the runs stay disjoint
+    std::erase_if(handles, [&current](HandleQuad const &quad) { return current->contains(quad); });
+    if (handles.empty()) {
+        return;
+    }
+
+    SortedRun added;
+    for (size_t ix = 0; ix < index_count; ++ix) {
+        auto &entries = added.indexes[ix];
+        entries.reserve(handles.size());
+        for (auto const &quad : handles) {
+            entries.push_back(permute(index_permutations[ix], quad));
+        }
+        std::sort(entries.begin(), entries.end());
+    }
+
+    auto const added_and_delta = mvcc_detail::merge(added, *current->delta);
+    publish(std::make_shared<Snapshot const>(Snapshot{mvcc_detail::merge(*current->base, *added_and_delta), std::make_shared<SortedRun const>()}));
+}
+
+bool MVCCDatasetBackend::contains(const Quad &quad) const {
+    return snapshot()->contains(HandleQuad::from_quad(quad));
+}
+
+size_t MVCCDatasetBackend::size() const {
+    return snapshot()->size();
+}
+
+query::SolutionSequence MVCCDatasetBackend::match(const QuadPattern &quad_pattern) const {
+    auto current = snapshot();
+    auto const [index_ix, prefix_len] = select_permutation(quad_pattern);
+    auto const range = current->prefix_range(index_ix, permute(index_permutations[index_ix], HandleQuad::from_quad(quad_pattern)), prefix_len);
+
+    return query::SolutionSequence::new_instance<MVCCSolutionSequenceBackend>(quad_pattern, std::move(current), index_ix, range);
+}
+
+size_t MVCCDatasetBackend::size(const IRI &graph_name) const {
+    HandleQuad key{};
+    key[0] = graph_name.backend_handle();
+
+    auto const current = snapshot();
+    auto const range = current->prefix_range(0, key, 1);
+    return range.first.size() + range.second.size();
+}
+
+size_t MVCCDatasetBackend::estimate_cardinality(const QuadPattern &quad_pattern) const {
+    auto const current = snapshot();
+    auto const [index_ix, prefix_len] = select_permutation(quad_pattern);
+    auto const range = current->prefix_range(index_ix, permute(index_permutations[index_ix], HandleQuad::from_quad(quad_pattern)), prefix_len);
+    return range.first.size() + range.second.size();
+}
+
+IDatasetBackend::const_iterator MVCCDatasetBackend::begin() const {
+    return const_iterator(quad_iterator{snapshot()});
+}
+IDatasetBackend::const_iterator MVCCDatasetBackend::end() const {
+    // an ended iterator compares equal to any other ended iterator, so it works with begin() of any version
+    return const_iterator(quad_iterator{});
+}
+
+}  // namespace rdf4cpp::rdf::storage::tuple
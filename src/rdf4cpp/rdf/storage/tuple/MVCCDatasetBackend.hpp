@@ -0,0 +1,204 @@
+#ifndef RDF4CPP_MVCCDATASETBACKEND_HPP
+#define RDF4CPP_MVCCDATASETBACKEND_HPP
+
+#include <rdf4cpp/rdf/Quad.hpp>
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+#include <rdf4cpp/rdf/query/SolutionSequence.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HandleQuad.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexPermutation.hpp>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
+#include <version>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Sorted, deduplicated tuples for each permutation in index_permutations.
+ * A Run is never modified once it is part of a published MVCCDatasetBackend::Snapshot.
+ */
+struct SortedRun {
+    /**
+     * indexes[ix] holds the tuples permuted according to index_permutations[ix], in ascending order
+     */
+    std::array<std::vector<HandleQuad>, index_permutations.size()> indexes;
+
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @param quad_order tuple in Quad order (graph, subject, predicate, object)
+     */
+    [[nodiscard]] bool contains(HandleQuad const &quad_order) const noexcept;
+
+    /**
+     * Range of all tuples of an index that start with the first prefix_len entries of key.
+     * @param index_ix position of the index's permutation in index_permutations
+     * @param key tuple in the order of the index
+     * @param prefix_len number of leading entries of key that must match
+     */
+    [[nodiscard]] std::span<HandleQuad const> prefix_range(size_t index_ix, HandleQuad const &key, size_t prefix_len) const noexcept;
+};
+
+/**
+ * Forward cursor over the union of two disjoint sorted ranges in ascending order.
+ */
+struct MergeCursor {
+    /**
+     * remaining part of the first range
+     */
+    std::span<HandleQuad const> first;
+    /**
+     * remaining part of the second range
+     */
+    std::span<HandleQuad const> second;
+
+    [[nodiscard]] bool ended() const noexcept;
+
+    /**
+     * @pre !ended()
+     */
+    [[nodiscard]] HandleQuad const &current() const noexcept;
+
+    /**
+     * @pre !ended()
+     */
+    void advance() noexcept;
+
+    /**
+     * Cursors are equal if they point to the same tuple. All ended cursors are equal.
+     */
+    bool operator==(MergeCursor const &other) const noexcept;
+};
+
+/**
+ * IDatasetBackend that can be read by any number of threads while one thread writes to it.
+ *
+ * The indexes (the same permutations as in IndexedDatasetBackend) are immutable. Every write publishes a new
+ * Snapshot that consists of a large base SortedRun and a small delta SortedRun of recently added quads.
+ * add() copies only the delta; once the delta exceeds max(min_delta_size, sqrt(size of base)) it is merged into a new base.
+ * Snapshots are shared via std::shared_ptr, so a snapshot is reclaimed when the last reader that uses it is done.
+ *
+ * Readers never block: contains(), size(), match(), begin() and end() only load the current Snapshot.
+ * The SolutionSequence returned by match() and the iterators returned by begin() hold on to the snapshot they were created from
+ * and are not affected by later writes.
+ * Writers (add and add_bulk) are serialized by a mutex.
+ *
+ * Quads and QuadPatterns must be in the NodeStorage of this backend (Dataset takes care of that).
+ */
+class MVCCDatasetBackend : public IDatasetBackend {
+    using PatternSolutions = rdf4cpp::rdf::query::SolutionSequence;
+    using QuadPattern = rdf4cpp::rdf::query::QuadPattern;
+
+public:
+    static constexpr size_t index_count = index_permutations.size();
+
+    /**
+     * Lower bound for the number of quads in the delta before it is merged into the base.
+     */
+    static constexpr size_t min_delta_size = 256;
+
+    /**
+     * An immutable version of the dataset.
+     * base and delta are disjoint, so the quads of the version are their union.
+     */
+    struct Snapshot {
+        std::shared_ptr<SortedRun const> base;
+        std::shared_ptr<SortedRun const> delta;
+
+        [[nodiscard]] size_t size() const noexcept;
+
+        /**
+         * @param quad_order tuple in Quad order (graph, subject, predicate, object)
+         */
+        [[nodiscard]] bool contains(HandleQuad const &quad_order) const noexcept;
+
+        /**
+         * All tuples of an index that start with the first prefix_len entries of key, see SortedRun::prefix_range.
+         */
+        [[nodiscard]] MergeCursor prefix_range(size_t index_ix, HandleQuad const &key, size_t prefix_len) const noexcept;
+    };
+
+    /**
+     * Forward iterator over the quads of a snapshot that materializes the current entry as Quad.
+     * Keeps the snapshot alive.
+     */
+    struct quad_iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = Quad;
+
+        std::shared_ptr<Snapshot const> snapshot_;
+        MergeCursor cursor_;
+        mutable Quad quad_;
+
+        quad_iterator() = default;
+        explicit quad_iterator(std::shared_ptr<Snapshot const> snapshot) noexcept;
+
+        const value_type &operator*() const noexcept;
+        quad_iterator &operator++() noexcept;
+        quad_iterator operator++(int) noexcept;
+
+        bool operator==(const quad_iterator &other) const noexcept;
+        bool operator!=(const quad_iterator &other) const noexcept;
+    };
+
+private:
+    std::mutex writer_mutex_;
+
+#ifdef __cpp_lib_atomic_shared_ptr
+    std::atomic<std::shared_ptr<Snapshot const>> current_;
+#else
+    /**
+     * only accessed via std::atomic_load_explicit and std::atomic_store_explicit
+     */
+    std::shared_ptr<Snapshot const> current_;
+#endif
+
+    void publish(std::shared_ptr<Snapshot const> snapshot) noexcept;
+
+public:
+    explicit MVCCDatasetBackend(node::NodeStorage &node_storage = node::NodeStorage::default_instance());
+
+    [[nodiscard]] node::NodeStorage &node_storage() const override;
+
+    /**
+     * @return the current version of the dataset
+     */
+    [[nodiscard]] std::shared_ptr<Snapshot const> snapshot() const noexcept;
+
+    void add(const Quad &quad) override;
+
+    /**
+     * Merges all quads into a new base and publishes it as a single new version,
+     * so readers see either none or all of the quads.
+     * If a Quad is not valid or not in node_storage(), nothing is added.
+     */
+    void add_bulk(std::span<Quad const> quads) override;
+
+    [[nodiscard]] bool contains(const Quad &quad) const override;
+
+    [[nodiscard]] size_t size() const override;
+
+    /**
+     * @return the solutions of quad_pattern in the current version; later writes are not visible in them
+     */
+    [[nodiscard]] PatternSolutions match(const QuadPattern &quad_pattern) const override;
+
+    [[nodiscard]] size_t size(const IRI &graph_name) const override;
+
+    /**
+     * Exact: the size of the range of the index that match() would scan, found with binary searches.
+     */
+    [[nodiscard]] size_t estimate_cardinality(const QuadPattern &quad_pattern) const override;
+
+    const_iterator begin() const override;
+    const_iterator end() const override;
+};
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_MVCCDATASETBACKEND_HPP
@@ -0,0 +1,58 @@
+#include "MVCCSolutionSequenceBackend.hpp"
+
+#include <utility>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+MVCCSolutionSequenceBackend::MVCCSolutionSequenceBackend(QuadPattern pattern, std::shared_ptr<Snapshot const> snapshot, size_t const index_ix, MergeCursor range)
+    : ISolutionSequenceBackend(pattern), snapshot_{std::move(snapshot)}, permutation_{index_permutations[index_ix]}, range_{range} {
+}
+ISolutionSequenceBackend::const_iterator MVCCSolutionSequenceBackend::begin() const {
+    return ISolutionSequenceBackend::const_iterator{const_iterator{range_, permutation_, pattern_}};
+}
+ISolutionSequenceBackend::const_iterator MVCCSolutionSequenceBackend::end() const {
+    return ISolutionSequenceBackend::const_iterator{const_iterator{MergeCursor{}, permutation_, pattern_}};
+}
+MVCCSolutionSequenceBackend::const_iterator::const_iterator(MergeCursor cursor, IndexPermutation const &permutation, const QuadPattern &pattern)
+    : cursor_{cursor}, permutation_{permutation}, solution_{pattern} {
+    uint8_t pos = 0;
+    for (auto const &entry : pattern) {
+        if (entry.is_variable()) {
+            variable_positions_[variable_count_++] = pos;
+        }
+        ++pos;
+    }
+
+    if (not ended())
+        fill_solution();
+}
+bool MVCCSolutionSequenceBackend::const_iterator::ended() const {
+    return cursor_.ended();
+}
+void MVCCSolutionSequenceBackend::const_iterator::fill_solution() {
+    auto const quad = unpermute(permutation_, cursor_.current());
+    for (size_t solution_pos = 0; solution_pos < variable_count_; ++solution_pos) {
+        solution_[solution_pos].backend_handle() = quad[variable_positions_[solution_pos]];
+    }
+}
+const MVCCSolutionSequenceBackend::const_iterator::value_type &MVCCSolutionSequenceBackend::const_iterator::operator*() const {
+    return solution_;
+}
+MVCCSolutionSequenceBackend::const_iterator &MVCCSolutionSequenceBackend::const_iterator::operator++() {
+    cursor_.advance();
+    if (not ended())
+        fill_solution();
+    return *this;
+}
+MVCCSolutionSequenceBackend::const_iterator MVCCSolutionSequenceBackend::const_iterator::operator++(int) & {
+    auto copy = const_iterator(*this);
+    ++(*this);
+    return copy;
+}
+bool MVCCSolutionSequenceBackend::const_iterator::operator==(const MVCCSolutionSequenceBackend::const_iterator &r) const {
+    return this->cursor_ == r.cursor_;
+}
+bool MVCCSolutionSequenceBackend::const_iterator::operator!=(const MVCCSolutionSequenceBackend::const_iterator &r) const {
+    return not(*this == r);
+}
+}  // namespace rdf4cpp::rdf::storage::tuple
@@ -0,0 +1,65 @@
+#ifndef RDF4CPP_MVCCSOLUTIONSEQUENCEBACKEND_HPP
+#define RDF4CPP_MVCCSOLUTIONSEQUENCEBACKEND_HPP
+
+#include <rdf4cpp/rdf/storage/tuple/ISolutionSequenceBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+
+#include <memory>
+
+namespace rdf4cpp::rdf::storage::tuple {
+
+/**
+ * Solutions of a QuadPattern over a range of an index of an MVCCDatasetBackend::Snapshot.
+ * The range must only contain matches of the pattern.
+ * Keeps the snapshot alive, so the solutions are not affected by later writes to the dataset.
+ */
+class MVCCSolutionSequenceBackend : public ISolutionSequenceBackend {
+    using QuadPattern = query::QuadPattern;
+    using Solution = query::Solution;
+    using Snapshot = MVCCDatasetBackend::Snapshot;
+
+    std::shared_ptr<Snapshot const> snapshot_;
+    IndexPermutation permutation_{};
+    MergeCursor range_;
+
+public:
+    MVCCSolutionSequenceBackend() = default;
+    MVCCSolutionSequenceBackend(QuadPattern pattern, std::shared_ptr<Snapshot const> snapshot, size_t index_ix, MergeCursor range);
+    ~MVCCSolutionSequenceBackend() override = default;
+
+    [[nodiscard]] ISolutionSequenceBackend::const_iterator begin() const override;
+    [[nodiscard]] ISolutionSequenceBackend::const_iterator end() const override;
+
+    struct const_iterator {
+        using difference_type = std::ptrdiff_t;
+        using value_type = Solution;
+        MergeCursor cursor_;
+        IndexPermutation permutation_{};
+        /**
+         * Quad positions (0: graph, 1: subject, 2: predicate, 3: object) of the variables in the pattern in solution order
+         */
+        std::array<uint8_t, 4> variable_positions_{};
+        size_t variable_count_ = 0;
+        mutable Solution solution_;
+
+        const_iterator() = default;
+        const_iterator(MergeCursor cursor, IndexPermutation const &permutation, const QuadPattern &pattern);
+
+        [[nodiscard]] bool ended() const;
+        void fill_solution();
+
+        const value_type &operator*() const;
+
+        const_iterator &operator++();
+
+        const_iterator operator++(int) &;
+
+        bool operator==(const const_iterator &r) const;
+
+        bool operator!=(const const_iterator &r) const;
+    };
+};
+
+}  // namespace rdf4cpp::rdf::storage::tuple
+
+#endif  //RDF4CPP_MVCCSOLUTIONSEQUENCEBACKEND_HPP
@@ -0,0 +1,173 @@
+#ifndef RDF4CPP_WYHASH_HPP
+#define RDF4CPP_WYHASH_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+/**
+ * Port of wyhash (final version 4) by Wang Yi, see https://github.com/wangyi-fudan/wyhash.
+ * The original is released into the public domain under The Unlicense.
+ *
+ * Hashes 16 bytes per 64x64->128 bit multiplication and 48 bytes per iteration for long inputs,
+ * with three independent lanes so that the multiplications can be pipelined.
+ */
+namespace rdf4cpp::rdf::storage::util::wyhash {
+
+namespace detail {
+
+inline constexpr std::array<uint64_t, 4> secret{UINT64_C(0x2d358dccaa6c78a5),
+                                                UINT64_C(0x8bb84b93962eacc9),
+                                                UINT64_C(0x4b33a62ed433d4a3),
+                                                UINT64_C(0x4d5a2da51de1aa47)};
+
+/**
+ * Multiplies a and b, afterwards a holds the low and b the high 64 bits of the product.
+ */
+inline void mum(uint64_t &a, uint64_t &b) noexcept {
+#if defined(__SIZEOF_INT128__)
+    __extension__ using uint128_t = unsigned __int128;
+    auto const r = static_cast<uint128_t>(a) * b;
+    a = static_cast<uint64_t>(r);
+    b = static_cast<uint64_t>(r >> 64);
+#else
+    uint64_t const ha = a >> 32;
+    uint64_t const hb = b >> 32;
+    uint64_t const la = static_cast<uint32_t>(a);
+    uint64_t const lb = static_cast<uint32_t>(b);
+
+    uint64_t const rh = ha * hb;
+    uint64_t const rm0 = ha * lb;
+    uint64_t const rm1 = hb * la;
+    uint64_t const rl = la * lb;
+    uint64_t const t = rl + (rm0 << 32);
+    uint64_t lo = t + (rm1 << 32);
+    uint64_t const carry = static_cast<uint64_t>(t < rl) + static_cast<uint64_t>(lo < t);
+    uint64_t const hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+
+    a = lo;
+    b = hi;
+#endif
+}
+
+inline uint64_t mix(uint64_t a, uint64_t b) noexcept {
+    mum(a, b);
+    return a ^ b;
+}
+
+inline uint64_t read8(uint8_t const *p) noexcept {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t read4(uint8_t const *p) noexcept {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/**
+ * Reads 1 to 3 bytes.
+ */
+inline uint64_t read3(uint8_t const *p, size_t const k) noexcept {
+    return (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[k >> 1]) << 8) | p[k - 1];
+}
+
+}  // namespace detail
+
+inline constexpr uint64_t default_seed = 0;
+
+/**
+ * @param ptr start of the data
+ * @param len number of bytes
+ * @param seed inputs hashed with different seeds produce unrelated hashes
+ * @return 64 bit hash of the bytes [ptr, ptr + len)
+ */
+inline size_t hash_bytes(void const *ptr, size_t const len, uint64_t seed = default_seed) noexcept {
+    using namespace detail;
+
+    auto const *p = static_cast<uint8_t const *>(ptr);
+    seed ^= mix(seed ^ secret[0], secret[1]);
+
+    uint64_t a;
+    uint64_t b;
+    if (len <= 16) [[likely]] {
+        if (len >= 4) [[likely]] {
+            // two overlapping 4 byte reads from each end cover all of the 4 to 16 bytes
+            a = (read4(p) << 32) | read4(p + ((len >> 3) << 2));
+            b = (read4(p + len - 4) << 32) | read4(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) [[likely]] {
+            a = read3(p, len);
+            b = 0;
+        } else {
+            a = 0;
+            b = 0;
+        }
+    } else {
+        size_t i = len;
+        if (i >= 48) [[unlikely]] {
+            uint64_t see1 = seed;
+            uint64_t see2 = seed;
+            do {
+                seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                see1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ see1);
+                see2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i >= 48);
+            seed ^= see1 ^ see2;
+        }
+
+        while (i > 16) [[unlikely]] {
+            seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+
+        // the last 16 bytes of the input, may overlap with bytes that were already consumed
+        a = read8(p + i - 16);
+        b = read8(p + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    mum(a, b);
+    return static_cast<size_t>(mix(a ^ secret[0] ^ len, b ^ secret[1]));
+}
+
+/**
+ * @return 64 bit hash of x, seeded with seed
+ */
+inline size_t hash_int(uint64_t x, uint64_t seed = default_seed) noexcept {
+    using namespace detail;
+
+    x ^= secret[0];
+    seed ^= secret[1];
+    mum(x, seed);
+    return static_cast<size_t>(mix(x ^ secret[0], seed ^ secret[1]));
+}
+
+template<typename T>
+struct hash;
+
+template<typename CharT>
+struct hash<std::basic_string<CharT>> {
+    size_t operator()(std::basic_string<CharT> const &str) const noexcept {
+        return hash_bytes(str.data(), sizeof(CharT) * str.size());
+    }
+};
+
+template<typename CharT>
+struct hash<std::basic_string_view<CharT>> {
+    size_t operator()(std::basic_string_view<CharT> const &sv) const noexcept {
+        return hash_bytes(sv.data(), sizeof(CharT) * sv.size());
+    }
+};
+
+}  // namespace rdf4cpp::rdf::storage::util::wyhash
+
+#endif  //RDF4CPP_WYHASH_HPP
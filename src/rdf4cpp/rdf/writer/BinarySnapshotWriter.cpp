@@ -0,0 +1,197 @@
+#include "BinarySnapshotWriter.hpp"
+
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
+#include <rdf4cpp/rdf/util/BinarySnapshot.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rdf4cpp::rdf::writer {
+
+namespace {
+
+using namespace util::binary_snapshot;
+using storage::node::identifier::NodeBackendHandle;
+using storage::node::identifier::RDFNodeType;
+
+/**
+ * Collects the distinct nodes of a dataset and assigns their local ids
+ */
+struct Dictionary {
+    struct Named {
+        uint64_t raw_handle;
+        std::string_view name;
+    };
+
+    struct LiteralEntry {
+        LiteralKind kind;
+        uint64_t datatype_raw_handle;
+        std::string lexical_form;
+        std::string_view language_tag;
+    };
+
+    storage::util::tsl::sparse_map<uint64_t, uint64_t> local_ids;  ///< raw handle -> local id, ids are only valid after finish()
+    std::vector<Named> iris;
+    std::vector<Named> bnodes;
+    std::vector<LiteralEntry> literals;
+    std::vector<uint64_t> literal_handles;
+
+    void add_iri(NodeBackendHandle const &handle) {
+        if (local_ids.emplace(handle.raw(), 0).second) {
+            iris.push_back(Named{.raw_handle = handle.raw(), .name = handle.iri_backend().identifier});
+        }
+    }
+
+    void add(Node const &node) {
+        auto const &handle = node.backend_handle();
+
+        switch (handle.type()) {
+            case RDFNodeType::IRI: {
+                add_iri(handle);
+                break;
+            }
+            case RDFNodeType::BNode: {
+                if (local_ids.emplace(handle.raw(), 0).second) {
+                    bnodes.push_back(Named{.raw_handle = handle.raw(), .name = handle.bnode_backend().identifier});
+                }
+                break;
+            }
+            case RDFNodeType::Literal: {
+                if (local_ids.emplace(handle.raw(), 0).second) {
+                    add_literal(node.as_literal());
+                }
+                break;
+            }
+            default: {
+                throw std::runtime_error{"variables cannot be part of a binary snapshot"};
+            }
+        }
+    }
+
+    void add_literal(Literal const &literal) {
+        auto const &handle = literal.backend_handle();
+        auto const datatype = literal.datatype();
+        add_iri(datatype.backend_handle());
+
+        LiteralEntry entry{.kind = LiteralKind::Typed,
+                           .datatype_raw_handle = datatype.backend_handle().raw(),
+                           .lexical_form = {},
+                           .language_tag = {}};
+
+        if (!handle.is_inlined() && handle.literal_backend().is_lexical()) {
+            handle.literal_backend().visit(
+                    [&](storage::node::view::LexicalFormLiteralBackendView const &lexical) {
+                        entry.kind = LiteralKind::Lexical;
+                        entry.lexical_form = lexical.lexical_form;
+                        entry.language_tag = lexical.language_tag;
+                    },
+                    [](storage::node::view::ValueLiteralBackendView const &) {
+                        assert(false);
+                        __builtin_unreachable();
+                    });
+        } else {
+            entry.lexical_form = literal.lexical_form();
+        }
+
+        literals.push_back(std::move(entry));
+        literal_handles.push_back(handle.raw());
+    }
+
+    /**
+     * Sorts IRIs and blank nodes by name and assigns all local ids
+     */
+    void finish() {
+        auto const by_name = [](Named const &lhs, Named const &rhs) noexcept {
+            return lhs.name < rhs.name;
+        };
+
+        std::sort(iris.begin(), iris.end(), by_name);
+        std::sort(bnodes.begin(), bnodes.end(), by_name);
+
+        uint64_t next_id = 0;
+        for (auto const &iri : iris) {
+            local_ids[iri.raw_handle] = next_id++;
+        }
+        for (auto const &bnode : bnodes) {
+            local_ids[bnode.raw_handle] = next_id++;
+        }
+        for (auto const raw_handle : literal_handles) {
+            local_ids[raw_handle] = next_id++;
+        }
+    }
+
+    [[nodiscard]] uint64_t local_id(Node const &node) const {
+        return local_ids.at(node.backend_handle().raw());
+    }
+
+    [[nodiscard]] uint64_t size() const noexcept {
+        return local_ids.size();
+    }
+};
+
+}  // namespace
+
+BinarySnapshotWriter::BinarySnapshotWriter(Dataset dataset) : dataset_(std::move(dataset)) {}
+
+void BinarySnapshotWriter::write(std::ostream &os) const {
+    Dictionary dict;
+    for (Quad const &quad : dataset_) {
+        for (auto const &node : quad) {
+            dict.add(node);
+        }
+    }
+    dict.finish();
+
+    std::string out;
+    Encoder enc{out};
+
+    Header const header{.magic = magic,
+                        .version = version,
+                        .iri_count = dict.iris.size(),
+                        .bnode_count = dict.bnodes.size(),
+                        .literal_count = dict.literals.size(),
+                        .quad_count = dataset_.size(),
+                        .id_width = id_width_for(dict.size())};
+    enc.write_fixed(header);
+
+    std::string_view prev;
+    for (auto const &iri : dict.iris) {
+        enc.write_front_coded(prev, iri.name);
+        prev = iri.name;
+    }
+
+    prev = {};
+    for (auto const &bnode : dict.bnodes) {
+        enc.write_front_coded(prev, bnode.name);
+        prev = bnode.name;
+    }
+
+    for (auto const &literal : dict.literals) {
+        enc.write_fixed(literal.kind);
+        enc.write_varint(dict.local_ids.at(literal.datatype_raw_handle));
+        enc.write_string(literal.lexical_form);
+        enc.write_string(literal.language_tag);
+    }
+
+    BitPacker packer{.width = header.id_width, .words = {}};
+    packer.words.reserve(word_count_for(4 * header.quad_count * header.id_width));
+    for (Quad const &quad : dataset_) {
+        for (auto const &node : quad) {
+            packer.push(dict.local_id(node));
+        }
+    }
+    packer.words.resize(word_count_for(4 * header.quad_count * header.id_width));
+
+    os.write(out.data(), static_cast<std::streamsize>(out.size()));
+    os.write(reinterpret_cast<char const *>(packer.words.data()), static_cast<std::streamsize>(packer.words.size() * sizeof(uint64_t)));
+}
+
+std::ostream &operator<<(std::ostream &os, const BinarySnapshotWriter &writer) {
+    writer.write(os);
+    return os;
+}
+}  // namespace rdf4cpp::rdf::writer
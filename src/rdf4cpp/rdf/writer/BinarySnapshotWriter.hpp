@@ -0,0 +1,33 @@
+#ifndef RDF4CPP_BINARYSNAPSHOTWRITER_HPP
+#define RDF4CPP_BINARYSNAPSHOTWRITER_HPP
+
+#include <rdf4cpp/rdf/Dataset.hpp>
+
+#include <ostream>
+
+namespace rdf4cpp::rdf::writer {
+
+/**
+ * Writes a Dataset in a compact binary format that can be loaded with parser::read_binary_snapshot.
+ * The snapshot consists of a dictionary of all nodes (IRIs and blank nodes are sorted and front coded)
+ * and the quads as bit-packed tuples of dictionary ids.
+ *
+ * @note Snapshots use the native byte order, they are meant to be exchanged between machines of the same architecture.
+ */
+class BinarySnapshotWriter {
+    Dataset dataset_;
+
+public:
+    explicit BinarySnapshotWriter(Dataset dataset);
+
+    /**
+     * Writes the snapshot to os
+     * @param os stream to write to, should be opened in binary mode
+     */
+    void write(std::ostream &os) const;
+
+    friend std::ostream &operator<<(std::ostream &os, const BinarySnapshotWriter &writer);
+};
+}  // namespace rdf4cpp::rdf::writer
+
+#endif  //RDF4CPP_BINARYSNAPSHOTWRITER_HPP
@@ -0,0 +1,222 @@
+#include "BufferedWriter.hpp"
+
+#include <rdf4cpp/rdf/datatypes/registry/DatatypeRegistry.hpp>
+#include <rdf4cpp/rdf/query/QuadPattern.hpp>
+
+#include <array>
+#include <cassert>
+
+namespace rdf4cpp::rdf::writer {
+
+namespace {
+
+/**
+ * Characters that need to be escaped in quoted lexical forms
+ */
+constexpr std::array<bool, 256> needs_escape = []() {
+    std::array<bool, 256> table{};
+    table[static_cast<unsigned char>('\\')] = true;
+    table[static_cast<unsigned char>('"')] = true;
+    table[static_cast<unsigned char>('\n')] = true;
+    table[static_cast<unsigned char>('\r')] = true;
+    return table;
+}();
+
+}  // namespace
+
+BufferedWriter::BufferedWriter(std::ostream &os, size_t buffer_capacity, size_t cache_capacity)
+    : os_(&os),
+      buffer_capacity_(buffer_capacity),
+      cache_capacity_(cache_capacity) {
+}
+
+BufferedWriter::~BufferedWriter() noexcept {
+    try {
+        flush();
+    } catch (...) {
+        // the stream has exceptions enabled, nothing we can do about it here
+    }
+}
+
+std::string_view BufferedWriter::serialized(storage::node::identifier::NodeBackendHandle const &handle) {
+    if (auto const it = cache_.find(handle.raw()); it != cache_.end()) {
+        return std::string_view{cache_data_}.substr(it->second.offset, it->second.size);
+    }
+
+    scratch_.clear();
+    switch (handle.type()) {
+        case storage::node::identifier::RDFNodeType::IRI: {
+            scratch_.push_back('<');
+            scratch_.append(handle.iri_backend().identifier);
+            scratch_.push_back('>');
+            break;
+        }
+        case storage::node::identifier::RDFNodeType::BNode: {
+            scratch_.append("_:");
+            scratch_.append(handle.bnode_backend().identifier);
+            break;
+        }
+        case storage::node::identifier::RDFNodeType::Variable: {
+            auto const var = handle.variable_backend();
+            scratch_.append(var.is_anonymous ? "_:" : "?");
+            scratch_.append(var.name);
+            break;
+        }
+        default: {
+            assert(false);
+            __builtin_unreachable();
+        }
+    }
+
+    if (cache_data_.size() + scratch_.size() > cache_capacity_) {
+        return scratch_;
+    }
+
+    CacheEntry const entry{.offset = cache_data_.size(), .size = scratch_.size()};
+    cache_data_.append(scratch_);
+    cache_.emplace(handle.raw(), entry);
+    return std::string_view{cache_data_}.substr(entry.offset, entry.size);
+}
+
+bool BufferedWriter::is_default_graph(storage::node::identifier::NodeBackendHandle const &handle) {
+    if (!handle.is_iri()) {
+        return false;
+    }
+
+    if (default_graph_.null() || default_graph_.node_storage_id() != handle.node_storage_id()) {
+        auto node_storage = storage::node::NodeStorage::lookup_instance(handle.node_storage_id());
+        assert(node_storage.has_value());
+        default_graph_ = IRI::default_graph(*node_storage).backend_handle();
+    }
+
+    return handle == default_graph_;
+}
+
+void BufferedWriter::append_quoted(std::string_view const lexical_form) {
+    buffer_.push_back('"');
+
+    // copy runs of characters that do not need escaping in one go
+    auto run_begin = lexical_form.begin();
+    for (auto it = lexical_form.begin(); it != lexical_form.end(); ++it) {
+        if (!needs_escape[static_cast<unsigned char>(*it)]) [[likely]] {
+            continue;
+        }
+
+        buffer_.append(run_begin, it);
+        switch (*it) {
+            case '\\': {
+                buffer_.append(R"(\\)");
+                break;
+            }
+            case '\n': {
+                buffer_.append(R"(\n)");
+                break;
+            }
+            case '\r': {
+                buffer_.append(R"(\r)");
+                break;
+            }
+            case '"': {
+                buffer_.append(R"(\")");
+                break;
+            }
+        }
+        run_begin = it + 1;
+    }
+    buffer_.append(run_begin, lexical_form.end());
+
+    buffer_.push_back('"');
+}
+
+void BufferedWriter::append_literal(Literal const &literal) {
+    using namespace storage::node;
+
+    auto const &handle = literal.backend_handle();
+
+    if (handle.is_inlined()) {
+        // rdf:langString is not inlined, therefore can only have datatype not lang tag
+        append_quoted(literal.lexical_form());
+        buffer_.append("^^");
+        buffer_.append(serialized(identifier::datatype_iri_handle_for_fixed_lit_handle(handle)));
+        return;
+    }
+
+    handle.literal_backend().visit(
+            [&](view::LexicalFormLiteralBackendView const &lexical) {
+                append_quoted(lexical.lexical_form);
+
+                if (lexical.datatype_id == identifier::NodeID::rdf_langstring_iri.first) {
+                    buffer_.push_back('@');
+                    buffer_.append(lexical.language_tag);
+                } else {
+                    buffer_.append("^^");
+                    buffer_.append(serialized(identifier::NodeBackendHandle{lexical.datatype_id, identifier::RDFNodeType::IRI, handle.node_storage_id()}));
+                }
+            },
+            [&](view::ValueLiteralBackendView const &any) {
+                // value literals always have a fixed datatype
+                auto const to_string = datatypes::registry::DatatypeRegistry::get_to_canonical_string(handle.node_id().literal_type());
+                assert(to_string != nullptr);
+
+                append_quoted(to_string(any.value));
+                buffer_.append("^^");
+                buffer_.append(serialized(identifier::datatype_iri_handle_for_fixed_lit_handle(handle)));
+            });
+}
+
+void BufferedWriter::flush_if_full() {
+    if (buffer_.size() >= buffer_capacity_) {
+        os_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+}
+
+void BufferedWriter::write_node(Node const node) {
+    if (node.is_literal()) {
+        append_literal(node.as_literal());
+    } else {
+        buffer_.append(serialized(node.backend_handle()));
+    }
+    flush_if_full();
+}
+
+void BufferedWriter::write_triple(Node const subject, Node const predicate, Node const object) {
+    write_node(subject);
+    buffer_.push_back(' ');
+    write_node(predicate);
+    buffer_.push_back(' ');
+    write_node(object);
+    buffer_.append(" .\n");
+    flush_if_full();
+}
+
+void BufferedWriter::write_quad(Quad const &quad) {
+    if (auto const &graph = quad.graph(); !graph.null() && !is_default_graph(graph.backend_handle())) {
+        buffer_.append(serialized(graph.backend_handle()));
+        buffer_.push_back(' ');
+    }
+
+    write_triple(quad.subject(), quad.predicate(), quad.object());
+}
+
+void BufferedWriter::write_dataset(Dataset const &dataset) {
+    for (Quad const &quad : dataset) {
+        write_quad(quad);
+    }
+}
+
+void BufferedWriter::write_graph(Graph const &graph) {
+    using namespace query;
+    auto solutions = graph.backend().match(QuadPattern(graph.name(), Variable("s"), Variable("p"), Variable("o")));
+    for (auto const &solution : solutions) {
+        write_triple(solution[0], solution[1], solution[2]);
+    }
+}
+
+void BufferedWriter::flush() {
+    os_->write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+    os_->flush();
+}
+
+}  // namespace rdf4cpp::rdf::writer
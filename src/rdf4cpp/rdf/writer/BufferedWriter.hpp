@@ -0,0 +1,113 @@
+#ifndef RDF4CPP_BUFFEREDWRITER_HPP
+#define RDF4CPP_BUFFEREDWRITER_HPP
+
+#include <rdf4cpp/rdf/Dataset.hpp>
+#include <rdf4cpp/rdf/Graph.hpp>
+#include <rdf4cpp/rdf/Literal.hpp>
+#include <rdf4cpp/rdf/Node.hpp>
+#include <rdf4cpp/rdf/Quad.hpp>
+#include <rdf4cpp/rdf/storage/util/tsl/sparse_map.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+namespace rdf4cpp::rdf::writer {
+
+/**
+ * Streaming N-Triples/N-Quads serializer.
+ *
+ * Statements are serialized into a reusable buffer that is handed to the output stream in large blocks,
+ * so writing a statement usually does not allocate or touch the stream.
+ * The buffer grows with the output up to its capacity, so small outputs only allocate what they need.
+ * The serialized forms of IRIs and blank nodes (including datatype IRIs of Literals) are cached by their handle,
+ * which saves the NodeStorage lookup for recurring nodes.
+ *
+ * The output is identical to the one produced by Node::operator std::string().
+ *
+ * @note the buffer is flushed on destruction, call flush() to observe stream errors
+ */
+class BufferedWriter {
+    struct CacheEntry {
+        size_t offset;
+        size_t size;
+    };
+
+    std::ostream *os_;
+    std::string buffer_;
+    size_t buffer_capacity_;
+
+    std::string cache_data_;
+    size_t cache_capacity_;
+    storage::util::tsl::sparse_map<uint64_t, CacheEntry> cache_;
+    std::string scratch_;  ///< serialized form of a node that did not fit into the cache
+    storage::node::identifier::NodeBackendHandle default_graph_{};  ///< default graph IRI of the NodeStorage of the last graph that was checked
+
+    /**
+     * @param handle handle of an IRI, blank node or variable
+     * @return serialized form of the node, valid until the next call
+     */
+    [[nodiscard]] std::string_view serialized(storage::node::identifier::NodeBackendHandle const &handle);
+
+    /**
+     * @param handle handle of a graph
+     * @return whether handle is the default graph IRI of its NodeStorage
+     */
+    [[nodiscard]] bool is_default_graph(storage::node::identifier::NodeBackendHandle const &handle);
+
+    void append_quoted(std::string_view lexical_form);
+    void append_literal(Literal const &literal);
+    void flush_if_full();
+
+public:
+    static constexpr size_t default_buffer_capacity = 1 << 20;
+    static constexpr size_t default_cache_capacity = 16 << 20;
+
+    /**
+     * @param os stream to write to, must outlive this
+     * @param buffer_capacity number of bytes that are collected before they are written to os, the buffer is not allocated upfront
+     * @param cache_capacity maximum number of bytes of serialized IRIs and blank nodes that are cached, 0 disables the cache
+     */
+    explicit BufferedWriter(std::ostream &os, size_t buffer_capacity = default_buffer_capacity, size_t cache_capacity = default_cache_capacity);
+
+    BufferedWriter(BufferedWriter const &) = delete;
+    BufferedWriter &operator=(BufferedWriter const &) = delete;
+
+    ~BufferedWriter() noexcept;
+
+    /**
+     * Writes a single node without any separator.
+     */
+    void write_node(Node node);
+
+    /**
+     * Writes a triple statement, terminated by " .\n".
+     */
+    void write_triple(Node subject, Node predicate, Node object);
+
+    /**
+     * Writes a quad statement, terminated by " .\n". The graph is omitted if it is null or the default graph.
+     */
+    void write_quad(Quad const &quad);
+
+    /**
+     * Writes all quads of dataset in N-Quads format.
+     */
+    void write_dataset(Dataset const &dataset);
+
+    /**
+     * Writes all triples of graph in N-Triples format.
+     */
+    void write_graph(Graph const &graph);
+
+    /**
+     * Hands all buffered output to the stream and flushes it.
+     */
+    void flush();
+};
+
+}  // namespace rdf4cpp::rdf::writer
+
+#endif  //RDF4CPP_BUFFEREDWRITER_HPP
@@ -1,5 +1,7 @@
 #include "NQuadsWriter.hpp"
 
+#include <rdf4cpp/rdf/writer/BufferedWriter.hpp>
+
 #include <sstream>
 
 
@@ -13,15 +15,7 @@ NQuadsWriter::operator std::string() const {
     return stream.str();
 }
 std::ostream &operator<<(std::ostream &os, const NQuadsWriter &writer) {
-    IRI const default_graph = IRI::default_graph(writer.dataset_.backend().node_storage());
-
-    for (const Quad &quad : writer.dataset_) {
-        if (!quad.graph().null() && quad.graph().as_iri() != default_graph)
-            os << NNodeWriter(quad.graph()) << " ";
-        os << NNodeWriter(quad.subject()) << " "
-           << NNodeWriter(quad.predicate()) << " "
-           << NNodeWriter(quad.object()) << " .\n";
-    }
+    BufferedWriter{os}.write_dataset(writer.dataset_);
     return os;
 }
 }  // namespace rdf4cpp::rdf::writer
\ No newline at end of file
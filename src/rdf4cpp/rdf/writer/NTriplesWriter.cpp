@@ -1,7 +1,6 @@
 #include "NTriplesWriter.hpp"
 
-#include <rdf4cpp/rdf/query/QuadPattern.hpp>
-#include <rdf4cpp/rdf/writer/NNodeWriter.hpp>
+#include <rdf4cpp/rdf/writer/BufferedWriter.hpp>
 
 #include <sstream>
 
@@ -13,13 +12,7 @@ NTriplesWriter::operator std::string() const {
     return stream.str();
 }
 std::ostream &operator<<(std::ostream &os, const NTriplesWriter &writer) {
-    using namespace query;
-    auto solutions = writer.graph_.backend().match(QuadPattern(writer.graph_.name(), Variable("s"), Variable("p"), Variable("o")));
-    for (const auto &solution : solutions) {
-        os << NNodeWriter(solution[0]) << " "
-           << NNodeWriter(solution[1]) << " "
-           << NNodeWriter(solution[2]) << " .\n";
-    }
+    BufferedWriter{os}.write_graph(writer.graph_);
     return os;
 }
 }  // namespace rdf4cpp::rdf::writer
\ No newline at end of file
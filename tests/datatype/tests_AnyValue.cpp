@@ -0,0 +1,67 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <array>
+#include <string>
+
+using namespace rdf4cpp::rdf;
+using datatypes::registry::AnyValue;
+
+static_assert(AnyValue::stored_inline<datatypes::xsd::Int::cpp_type>);
+static_assert(AnyValue::stored_inline<datatypes::xsd::Double::cpp_type>);
+static_assert(AnyValue::stored_inline<datatypes::xsd::Integer::cpp_type>);
+static_assert(AnyValue::stored_inline<datatypes::xsd::Decimal::cpp_type>);
+static_assert(AnyValue::stored_inline<datatypes::rdf::LangString::cpp_type>);
+static_assert(!AnyValue::stored_inline<std::array<char, 128>>);
+static_assert(!std::is_copy_constructible_v<AnyValue>);
+
+TEST_SUITE("AnyValue") {
+    TEST_CASE("empty") {
+        AnyValue value;
+        CHECK(!value.has_value());
+        CHECK(!value.clone().has_value());
+        CHECK(!std::move(value).into_any().has_value());
+    }
+
+    TEST_CASE("inline") {
+        AnyValue value{datatypes::xsd::Integer::cpp_type{42}};
+        CHECK(value.has_value());
+        CHECK(value.holds<datatypes::xsd::Integer::cpp_type>());
+        CHECK(!value.holds<int64_t>());
+        CHECK(value.get<datatypes::xsd::Integer::cpp_type>() == 42);
+
+        AnyValue moved{std::move(value)};
+        CHECK(!value.has_value());
+        CHECK(moved.get<datatypes::xsd::Integer::cpp_type>() == 42);
+
+        AnyValue cloned = moved.clone();
+        moved.get<datatypes::xsd::Integer::cpp_type>() = 1;
+        CHECK(cloned.get<datatypes::xsd::Integer::cpp_type>() == 42);
+
+        auto any = std::move(cloned).into_any();
+        CHECK(!cloned.has_value());
+        CHECK(std::any_cast<datatypes::xsd::Integer::cpp_type>(any) == 42);
+    }
+
+    TEST_CASE("heap") {
+        std::array<char, 128> arr{};
+        arr[127] = 'x';
+
+        AnyValue value{arr};
+        CHECK(value.get<std::array<char, 128>>()[127] == 'x');
+
+        AnyValue other{std::string{"hello"}};
+        other = std::move(value);
+        CHECK(!value.has_value());
+        CHECK(other.holds<std::array<char, 128>>());
+        CHECK(other.clone().get<std::array<char, 128>>()[127] == 'x');
+    }
+
+    TEST_CASE("literal values") {
+        auto const lit = Literal::make_typed_from_value<datatypes::xsd::Decimal>(datatypes::xsd::Decimal::cpp_type{"1.5"});
+        CHECK(std::any_cast<datatypes::xsd::Decimal::cpp_type>(lit.value()) == datatypes::xsd::Decimal::cpp_type{"1.5"});
+        CHECK(lit.add(lit) == Literal::make_typed_from_value<datatypes::xsd::Decimal>(datatypes::xsd::Decimal::cpp_type{"3.0"}));
+    }
+}
@@ -126,6 +126,24 @@ TEST_CASE("Datatype Decimal") {
     CHECK_THROWS_WITH_AS(no_discard_dummy = Literal::make_typed("2.225E-307", type_iri), "XSD Parsing Error", std::runtime_error);
 }
 
+TEST_CASE("Datatype Decimal try_from_string") {
+    using datatypes::xsd::Decimal;
+    using datatypes::DynamicError;
+
+    CHECK(Decimal::try_from_string("+1.5").value() == Decimal::cpp_type{"1.5"});
+    CHECK(Decimal::try_from_string("-.5").value() == Decimal::cpp_type{"-0.5"});
+    CHECK(Decimal::try_from_string("5.").value() == 5);
+    CHECK(Decimal::try_from_string("-123").value() == -123);
+
+    CHECK(Decimal::try_from_string("").error() == DynamicError::InvalidValueForCast);
+    CHECK(Decimal::try_from_string(".").error() == DynamicError::InvalidValueForCast);
+    CHECK(Decimal::try_from_string("1.2.3").error() == DynamicError::InvalidValueForCast);
+    CHECK(Decimal::try_from_string("1e5").error() == DynamicError::InvalidValueForCast);
+    CHECK(Decimal::try_from_string("INF").error() == DynamicError::InvalidValueForCast);
+
+    CHECK(Literal::try_make_typed("454sdsd", IRI{Decimal::identifier}).error() == DynamicError::InvalidValueForCast);
+}
+
 TEST_CASE("precision") {
     // xsd:decimal requires totalDigits to be >= 18
     // see: https://www.w3.org/TR/2004/REC-xmlschema-2-20041028/#dt-decimal
@@ -96,6 +96,22 @@ TEST_CASE("round-trip") {
     CHECK(lit.value<datatypes::xsd::Double>() == value);
 }
 
+TEST_CASE("canonical lexical form") {
+    using datatypes::xsd::Double;
+
+    CHECK(Literal::make_typed_from_value<Double>(1.0).lexical_form() == "1.0E0");
+    CHECK(Literal::make_typed_from_value<Double>(-100.0).lexical_form() == "-1.0E2");
+    CHECK(Literal::make_typed_from_value<Double>(0.5).lexical_form() == "5.0E-1");
+    CHECK(Literal::make_typed_from_value<Double>(-1.25e-300).lexical_form() == "-1.25E-300");
+    CHECK(Literal::make_typed_from_value<Double>(0.1).lexical_form() == "1.0E-1"); // shortest round-trip
+    CHECK(Literal::make_typed_from_value<Double>(std::numeric_limits<double>::quiet_NaN()).lexical_form() == "NaN");
+    CHECK(Literal::make_typed_from_value<Double>(-std::numeric_limits<double>::infinity()).lexical_form() == "-INF");
+
+    std::array<char, datatypes::registry::util::to_chars_canonical_max_size<double>> buf;
+    char const *last = datatypes::registry::util::to_chars_canonical(-std::numeric_limits<double>::max(), buf.data());
+    CHECK(std::string_view{buf.data(), static_cast<size_t>(last - buf.data())} == "-1.7976931348623157E308");
+}
+
 TEST_CASE("double inlining") {
     double value = 9999;
     auto lit = Literal::make_typed_from_value<datatypes::xsd::Double>(value);
@@ -0,0 +1,94 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/datatypes/registry/InlinedNumericOps.hpp>
+
+#include <limits>
+
+using namespace rdf4cpp::rdf;
+using namespace datatypes::registry;
+
+TEST_SUITE("inlined numeric ops") {
+    TEST_CASE("common type matches registry") {
+        []<size_t... ixs>(std::index_sequence<ixs...>) {
+            ([]<size_t ix>() {
+                using numeric_types = inlined_numeric_ops::numeric_types;
+                using lhs_t = typename numeric_types::template select<ix / numeric_types::length>;
+                using rhs_t = typename numeric_types::template select<ix % numeric_types::length>;
+
+                auto const *lhs_entry = DatatypeRegistry::get_entry(lhs_t::datatype_id);
+                auto const *rhs_entry = DatatypeRegistry::get_entry(rhs_t::datatype_id);
+                REQUIRE(lhs_entry != nullptr);
+                REQUIRE(rhs_entry != nullptr);
+
+                auto const runtime_conversion = DatatypeRegistry::get_common_numeric_op_type_conversion(*lhs_entry, *rhs_entry);
+                constexpr auto static_conversion = inlined_numeric_ops::detail::CommonNumericConversion<lhs_t, rhs_t>::indices;
+
+                CAPTURE(lhs_t::identifier);
+                CAPTURE(rhs_t::identifier);
+                REQUIRE(runtime_conversion.has_value() == static_conversion.has_value());
+
+                if constexpr (static_conversion.has_value()) {
+                    using common_t = typename inlined_numeric_ops::detail::CommonNumericConversionEntries<lhs_t, rhs_t>::common_type;
+                    CHECK(runtime_conversion->target_type_id == common_t::datatype_id);
+                }
+            }.template operator()<ixs>(), ...);
+        }(std::make_index_sequence<inlined_numeric_ops::numeric_types::length * inlined_numeric_ops::numeric_types::length>{});
+    }
+
+    TEST_CASE("dispatch") {
+        using namespace datatypes::xsd;
+
+        CHECK(inlined_numeric_ops::get_numeric_binops(Int::fixed_id, Short::fixed_id)->add_fptr != nullptr);
+        CHECK(inlined_numeric_ops::get_numeric_binops(Int::fixed_id, Int::fixed_id)->div_fptr == nullptr);  // result is xsd:decimal
+        CHECK(inlined_numeric_ops::get_numeric_binops(Decimal::fixed_id, Int::fixed_id)->add_fptr == nullptr);  // xsd:decimal is never inlined
+        CHECK(inlined_numeric_ops::get_numeric_binops(String::fixed_id, Int::fixed_id) == nullptr);
+    }
+
+    TEST_CASE("results") {
+        using namespace datatypes::xsd;
+
+        SUBCASE("same type") {
+            auto const res = Literal::make_typed_from_value<Int>(40) + Literal::make_typed_from_value<Int>(2);
+            CHECK(res.datatype_eq<Integer>());
+            CHECK(res.value<Integer>() == 42);
+        }
+
+        SUBCASE("promotion") {
+            auto const res = Literal::make_typed_from_value<Float>(1.5f) * Literal::make_typed_from_value<UnsignedByte>(4);
+            CHECK(res.datatype_eq<Float>());
+            CHECK(res.value<Float>() == 6.f);
+
+            auto const res2 = Literal::make_typed_from_value<Short>(3) - Literal::make_typed_from_value<Double>(0.5);
+            CHECK(res2.datatype_eq<Double>());
+            CHECK(res2.value<Double>() == 2.5);
+        }
+
+        SUBCASE("different hierarchies") {
+            auto const res = Literal::make_typed_from_value<NegativeInteger>(-5) + Literal::make_typed_from_value<PositiveInteger>(7);
+            CHECK(res.datatype_eq<Integer>());
+            CHECK(res.value<Integer>() == 2);
+        }
+
+        SUBCASE("result not inlineable") {
+            auto const lhs = Literal::make_typed_from_value<Long>(1l << 40);
+            auto const res = lhs * lhs;
+            CHECK(res.datatype_eq<Integer>());
+            CHECK(res == Literal::make_typed("1208925819614629174706176", IRI{Integer::identifier}));
+
+            auto const res2 = Literal::make_typed_from_value<Int>(1) / Literal::make_typed_from_value<Int>(4);
+            CHECK(res2.datatype_eq<Decimal>());
+            CHECK(res2 == Literal::make_typed("0.25", IRI{Decimal::identifier}));
+        }
+
+        SUBCASE("errors") {
+            auto const res = Literal::make_typed_from_value<Int>(1) / Literal::make_typed_from_value<Byte>(0);
+            CHECK(res.null());
+
+            auto const res2 = Literal::make_typed_from_value<Double>(1.0) / Literal::make_typed_from_value<Int>(0);
+            CHECK(res2.datatype_eq<Double>());
+            CHECK(res2.value<Double>() == std::numeric_limits<double>::infinity());
+        }
+    }
+}
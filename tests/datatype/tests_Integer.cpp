@@ -77,6 +77,40 @@ TEST_CASE("Datatype Integer") {
     CHECK_THROWS(no_discard_dummy = Literal::make_typed("2.2e-308", type_iri));
 }
 
+TEST_CASE("Datatype Integer try_from_string") {
+    using datatypes::xsd::Integer;
+
+    CHECK(Integer::try_from_string("+42").value() == 42);
+    CHECK(Integer::try_from_string("-42").value() == -42);
+    CHECK(Integer::try_from_string("-0").value() == 0);
+    CHECK(Integer::try_from_string("010").value() == 10); // not octal
+    CHECK(Integer::try_from_string("-000000000000000000000000012345678901234567890").value() == Integer::cpp_type{"-12345678901234567890"});
+
+    CHECK(Integer::try_from_string("").error() == DynamicError::InvalidValueForCast);
+    CHECK(Integer::try_from_string("-").error() == DynamicError::InvalidValueForCast);
+    CHECK(Integer::try_from_string("+-1").error() == DynamicError::InvalidValueForCast);
+    CHECK(Integer::try_from_string("0x10").error() == DynamicError::InvalidValueForCast);
+    CHECK(Integer::try_from_string("1.0").error() == DynamicError::InvalidValueForCast);
+    CHECK(Integer::try_from_string(" 1").error() == DynamicError::InvalidValueForCast);
+
+    CHECK(datatypes::xsd::NonNegativeInteger::try_from_string("-1").error() == DynamicError::OverOrUnderFlow);
+    CHECK(datatypes::xsd::Int::try_from_string("2147483648").error() == DynamicError::OverOrUnderFlow);
+    CHECK(datatypes::xsd::Int::try_from_string("-2147483648").value() == std::numeric_limits<int32_t>::min());
+
+    CHECK(Literal::try_make_typed("a23dg", IRI{Integer::identifier}).error() == DynamicError::InvalidValueForCast);
+    CHECK(Literal::try_make_typed("123", IRI{Integer::identifier}).value() == Literal::make_typed_from_value<Integer>(123));
+}
+
+TEST_CASE("Datatype Integer canonical lexical form") {
+    using datatypes::xsd::Integer;
+
+    CHECK(Literal::make_typed("-00123", IRI{Integer::identifier}).lexical_form() == "-123");
+    CHECK(Literal::make_typed("+0", IRI{Integer::identifier}).lexical_form() == "0");
+    CHECK(Literal::make_typed_from_value<Integer>(std::numeric_limits<int64_t>::min()).lexical_form() == std::to_string(std::numeric_limits<int64_t>::min()));
+    CHECK(Literal::make_typed("-123456789012345678901234567890", IRI{Integer::identifier}).lexical_form() == "-123456789012345678901234567890");
+    CHECK(Literal::make_typed("0100", IRI{datatypes::xsd::PositiveInteger::identifier}).lexical_form() == "100");
+}
+
 TEST_CASE("Datatype Integer overread UB") {
     std::string const s = "123456";
     std::string_view const sv{ s.data(), 3 };
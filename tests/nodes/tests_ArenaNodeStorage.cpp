@@ -0,0 +1,93 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+
+TEST_SUITE("ArenaReferenceNodeStorageBackend") {
+    TEST_CASE("StringArena") {
+        reference_node_storage::StringArena arena{16};
+
+        auto const a = arena.copy("hello");
+        auto const b = arena.copy("world!");
+        auto const empty = arena.copy("");
+        auto const large = arena.copy("this string does not fit into a chunk");
+        auto const c = arena.copy("abcde");
+
+        CHECK(a == "hello");
+        CHECK(b == "world!");
+        CHECK(empty.empty());
+        CHECK(large == "this string does not fit into a chunk");
+        CHECK(c == "abcde");
+
+        // strings that fit are stored contiguously
+        CHECK(b.data() == a.data() + a.size());
+        CHECK(c.data() == b.data() + b.size());
+
+        CHECK(arena.size() == a.size() + b.size() + large.size() + c.size());
+        CHECK(arena.capacity() == 16 + large.size());
+    }
+
+    TEST_CASE("basic node handling") {
+        auto node_storage = NodeStorage::new_instance<reference_node_storage::ArenaReferenceNodeStorageBackend>();
+
+        IRI const iri{"http://example.com/a", node_storage};
+        CHECK(iri.identifier() == "http://example.com/a");
+        CHECK(iri == IRI{"http://example.com/a", node_storage});
+        CHECK(iri != IRI{"http://example.com/b", node_storage});
+
+        BlankNode const bnode{"b1", node_storage};
+        CHECK(bnode.identifier() == "b1");
+        CHECK(bnode == BlankNode{"b1", node_storage});
+
+        query::Variable const var{"x", false, node_storage};
+        CHECK(var.name() == "x");
+        CHECK(var == query::Variable{"x", false, node_storage});
+
+        auto const simple = Literal::make_simple("hello", node_storage);
+        CHECK(simple.lexical_form() == "hello");
+        CHECK(simple == Literal::make_simple("hello", node_storage));
+
+        auto const lang = Literal::make_lang_tagged("hello", "en", node_storage);
+        CHECK(lang.lexical_form() == "hello");
+        CHECK(lang.language_tag() == "en");
+        CHECK(lang.backend_handle() != simple.backend_handle());
+
+        // not inlineable, goes to specialized storage
+        datatypes::xsd::Integer::cpp_type const big_value{"123456789012345678901234567890"};
+        auto const big = Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage);
+        CHECK(big.value<datatypes::xsd::Integer>() == big_value);
+
+        CHECK(IRI{datatypes::xsd::String::identifier, node_storage}.backend_handle().node_id().value() == datatypes::xsd::String::fixed_id.to_underlying());
+
+        auto const size = node_storage.size();
+        CHECK(node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(not node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(node_storage.size() == size - 1);
+        CHECK(node_storage.find_id(view::IRIBackendView{.identifier = "http://example.com/a"}).null());
+        CHECK(IRI{"http://example.com/b", node_storage}.identifier() == "http://example.com/b");
+    }
+
+    TEST_CASE("many nodes") {
+        auto node_storage = NodeStorage::new_instance<reference_node_storage::ArenaReferenceNodeStorageBackend>();
+
+        static constexpr size_t count = 100000;
+
+        std::vector<identifier::NodeID> ids;
+        ids.reserve(count);
+        for (size_t ix = 0; ix < count; ++ix) {
+            ids.push_back(IRI{"http://example.com/" + std::to_string(ix), node_storage}.backend_handle().node_id());
+        }
+
+        for (size_t ix = 0; ix < count; ++ix) {
+            auto const iri = "http://example.com/" + std::to_string(ix);
+            CHECK(node_storage.find_iri_backend_view(ids[ix]).identifier == iri);
+            CHECK(node_storage.find_id(view::IRIBackendView{.identifier = iri}) == ids[ix]);
+        }
+    }
+}
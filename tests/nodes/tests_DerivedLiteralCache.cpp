@@ -0,0 +1,137 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <rdf4cpp/rdf.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+
+TEST_SUITE("derived literal cache") {
+    TEST_CASE("cache") {
+        DerivedLiteralCache cache{100};
+        CHECK(cache.capacity() == 128);
+
+        auto const input = Literal::make_simple("abc").backend_handle();
+        auto const result = Literal::make_simple("ABC").backend_handle();
+        DerivedLiteralCache::Key const key{.input = input, .op = DerivedLiteralCache::Operation::UpperCase};
+
+        CHECK(!cache.lookup(key).has_value());
+
+        cache.insert(key, result);
+        CHECK(cache.lookup(key) == result);
+
+        // different operation or argument is a different key
+        CHECK(!cache.lookup(DerivedLiteralCache::Key{.input = input, .op = DerivedLiteralCache::Operation::LowerCase}).has_value());
+        CHECK(!cache.lookup(DerivedLiteralCache::Key{.input = input, .op = DerivedLiteralCache::Operation::UpperCase, .arg = 1}).has_value());
+
+        auto const other_result = Literal::make_simple("xyz").backend_handle();
+        cache.insert(key, other_result);
+        CHECK(cache.lookup(key) == other_result);
+
+        cache.clear();
+        CHECK(!cache.lookup(key).has_value());
+    }
+
+    TEST_CASE("literal derivations") {
+        auto node_storage = NodeStorage::new_instance();
+        CHECK(node_storage.derived_literal_cache() == nullptr);
+
+        node_storage.enable_derived_literal_cache(1024);
+        REQUIRE(node_storage.derived_literal_cache() != nullptr);
+
+        auto const lit = Literal::make_lang_tagged("Hello", "en", node_storage);
+
+        auto const upper = lit.uppercase(node_storage);
+        CHECK(upper == Literal::make_lang_tagged("HELLO", "en", node_storage));
+        CHECK(node_storage.derived_literal_cache()->lookup({.input = lit.backend_handle(), .op = DerivedLiteralCache::Operation::UpperCase}) == upper.backend_handle());
+        CHECK(lit.uppercase(node_storage).backend_handle() == upper.backend_handle());
+
+        CHECK(lit.lowercase(node_storage) == Literal::make_lang_tagged("hello", "en", node_storage));
+        CHECK(lit.lowercase(node_storage) == Literal::make_lang_tagged("hello", "en", node_storage));
+        CHECK(lit.as_lexical_form(node_storage) == Literal::make_simple("Hello", node_storage));
+        CHECK(lit.as_lexical_form(node_storage) == Literal::make_simple("Hello", node_storage));
+        CHECK(lit.as_strlen(node_storage) == Literal::make_typed_from_value<datatypes::xsd::Integer>(5, node_storage));
+        CHECK(lit.as_strlen(node_storage) == Literal::make_typed_from_value<datatypes::xsd::Integer>(5, node_storage));
+
+        auto const simple = Literal::make_simple("abc", node_storage);
+        CHECK(simple.md5(node_storage).lexical_form() == "900150983cd24fb0d6963f7d28e17f72");
+        CHECK(simple.md5(node_storage).lexical_form() == "900150983cd24fb0d6963f7d28e17f72");
+        CHECK(simple.sha1(node_storage).lexical_form() == "a9993e364706816aba3e25717850c26c9cd0d89d");
+        CHECK(simple.sha1(node_storage).lexical_form() == "a9993e364706816aba3e25717850c26c9cd0d89d");
+
+        // null results are cached as well
+        CHECK(lit.md5(node_storage).null());
+        CHECK(lit.md5(node_storage).null());
+
+        auto const num = Literal::make_typed_from_value<datatypes::xsd::Int>(42, node_storage);
+        CHECK(num.cast<datatypes::xsd::Double>(node_storage) == Literal::make_typed_from_value<datatypes::xsd::Double>(42.0, node_storage));
+        CHECK(num.cast<datatypes::xsd::Double>(node_storage) == Literal::make_typed_from_value<datatypes::xsd::Double>(42.0, node_storage));
+        CHECK(num.cast<datatypes::xsd::String>(node_storage) == Literal::make_simple("42", node_storage));
+        CHECK(num.cast<datatypes::xsd::Byte>(node_storage) == Literal::make_typed_from_value<datatypes::xsd::Byte>(42, node_storage));
+
+        node_storage.disable_derived_literal_cache();
+        CHECK(node_storage.derived_literal_cache() == nullptr);
+        CHECK(lit.uppercase(node_storage) == upper);
+    }
+
+    TEST_CASE("cache is bypassed for literals of other node storages") {
+        auto node_storage = NodeStorage::new_instance();
+        node_storage.enable_derived_literal_cache(16);
+
+        auto const lit = Literal::make_simple("abc");
+        auto const upper = lit.uppercase(node_storage);
+        CHECK(upper == Literal::make_simple("ABC", node_storage));
+        CHECK(!node_storage.derived_literal_cache()->lookup({.input = lit.backend_handle(), .op = DerivedLiteralCache::Operation::UpperCase}).has_value());
+    }
+
+    TEST_CASE("erase clears the cache") {
+        auto node_storage = NodeStorage::new_instance();
+        node_storage.enable_derived_literal_cache(16);
+
+        auto const lit = Literal::make_simple("abc", node_storage);
+        auto const upper = lit.uppercase(node_storage);
+        DerivedLiteralCache::Key const key{.input = lit.backend_handle(), .op = DerivedLiteralCache::Operation::UpperCase};
+        CHECK(node_storage.derived_literal_cache()->lookup(key).has_value());
+
+        CHECK(node_storage.erase_literal(upper.backend_handle().node_id()));
+        CHECK(!node_storage.derived_literal_cache()->lookup(key).has_value());
+        CHECK(lit.uppercase(node_storage).lexical_form() == "ABC");
+    }
+
+    TEST_CASE("concurrent use") {
+        auto node_storage = NodeStorage::new_instance();
+        node_storage.enable_derived_literal_cache(64);  // small to provoke collisions
+
+        std::vector<Literal> inputs;
+        std::vector<Literal> expected;
+        for (size_t ix = 0; ix < 500; ++ix) {
+            inputs.push_back(Literal::make_simple("value " + std::to_string(ix) + " abc", node_storage));
+            expected.push_back(Literal::make_simple("VALUE " + std::to_string(ix) + " ABC", node_storage));
+        }
+
+        std::atomic<size_t> mismatches = 0;
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t]() {
+                for (size_t round = 0; round < 20; ++round) {
+                    for (size_t ix = 0; ix < inputs.size(); ++ix) {
+                        auto const jx = (ix * (t + 1)) % inputs.size();
+                        if (inputs[jx].uppercase(node_storage) != expected[jx]) {
+                            mismatches.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+            });
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        CHECK(mismatches == 0);
+    }
+}
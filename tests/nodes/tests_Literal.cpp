@@ -525,6 +525,11 @@ TEST_CASE("Literal - misc functions") {
         CHECK(Literal::make_lang_tagged("hello", "en").as_strlen() == 5_xsd_integer);
 
         CHECK(("z\u00df\u6c34\U0001f34c"_xsd_string).as_strlen() == 4_xsd_integer);  // "zß水🍌"
+
+        // longer than a single vector block, multibyte sequences crossing block boundaries
+        CHECK(Literal::make_simple(std::string(100, 'a')).strlen() == 100);
+        CHECK(Literal::make_simple(std::string(31, 'a') + "\u00df" + std::string(30, 'b') + "\U0001f34c").strlen() == 63);
+        CHECK(!Literal::make_simple(std::string(40, 'a') + "\xc3").strlen().has_value());
     }
 
     SUBCASE("substr") {
@@ -550,6 +555,15 @@ TEST_CASE("Literal - misc functions") {
         CHECK(s.substr(2_xsd_long, -1.3_xsd_double) == ""_xsd_string);
         CHECK(s.substr(2.1_xsd_double, 3.2_xsd_double) == "ell"_xsd_string);
         CHECK(s.substr(100_xsd_integer, 10_xsd_int) == ""_xsd_string);
+
+        // positions are code points, not bytes
+        auto const u = Literal::make_simple("z\u00df\u6c34\U0001f34c!");  // "zß水🍌!"
+        CHECK(u.substr(2_xsd_integer, 2_xsd_integer) == Literal::make_simple("\u00df\u6c34"));
+        CHECK(u.substr(4_xsd_integer) == Literal::make_simple("\U0001f34c!"));
+        CHECK(u.substr(1, 1) == Literal::make_simple("\u00df"));
+
+        auto const l = Literal::make_simple(std::string(40, 'a') + "\u00df\u00df" + std::string(40, 'b'));
+        CHECK(l.substr(39, 4) == Literal::make_simple("a\u00df\u00dfb"));
     }
 
     SUBCASE("langMatches") {
@@ -741,6 +755,10 @@ TEST_CASE("URI encoding") {
     SUBCASE("high UTF-8 mixed") {
         CHECK(Literal::encode_for_uri("www.e\xce\xa4\xf0\x90\x8f\x92\xe2\x88\x80xample.com") == Literal::make_simple("www.e%CE%A4%F0%90%8F%92%E2%88%80xample.com"));
     }
+    SUBCASE("invalid UTF-8") {
+        CHECK(Literal::encode_for_uri("www.e\xce").null());
+        CHECK(Literal::encode_for_uri("\xed\xa0\x80").null());  // surrogate
+    }
     SUBCASE("nonstatic") {
         CHECK(Literal::make_simple(data).encode_for_uri() == Literal::make_simple(data_encoded));
         CHECK(Literal::make_lang_tagged(data, "en").encode_for_uri() == Literal::make_simple(data_encoded));
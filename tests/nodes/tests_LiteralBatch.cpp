@@ -0,0 +1,152 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <rdf4cpp/rdf.hpp>
+
+#include <limits>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace datatypes::xsd;
+
+namespace {
+
+/**
+ * Builds columns that exercise all paths: uniform inlined blocks, mixed blocks and a partial last block
+ */
+std::pair<std::vector<Literal>, std::vector<Literal>> make_columns() {
+    std::vector<Literal> lhs;
+    std::vector<Literal> rhs;
+
+    // block 0: xsd:int only
+    for (int ix = 0; ix < 64; ++ix) {
+        lhs.push_back(Literal::make_typed_from_value<Int>(ix - 32));
+        rhs.push_back(Literal::make_typed_from_value<Int>(ix % 7 - 3));
+    }
+
+    // block 1: xsd:double only, including NaN and infinity
+    for (int ix = 0; ix < 64; ++ix) {
+        lhs.push_back(Literal::make_typed_from_value<Double>(ix % 5 == 0 ? std::numeric_limits<double>::quiet_NaN() : ix * 0.5));
+        rhs.push_back(Literal::make_typed_from_value<Double>(ix % 3 == 0 ? std::numeric_limits<double>::infinity() : ix % 4 * 2.0));
+    }
+    rhs[64 + 5] = lhs[64 + 5];  // identical NaN handles
+
+    // block 2: mixed types and non-numerics
+    for (int ix = 0; ix < 64; ++ix) {
+        switch (ix % 6) {
+            case 0: {
+                lhs.push_back(Literal::make_typed_from_value<Short>(static_cast<int16_t>(ix)));
+                rhs.push_back(Literal::make_typed_from_value<Float>(static_cast<float>(ix % 9)));
+                break;
+            }
+            case 1: {
+                lhs.push_back(Literal::make_typed_from_value<Boolean>(ix % 4 == 1));
+                rhs.push_back(Literal::make_typed_from_value<Boolean>(true));
+                break;
+            }
+            case 2: {
+                lhs.push_back(Literal::make_simple("abc"));
+                rhs.push_back(Literal::make_typed_from_value<Int>(1));
+                break;
+            }
+            case 3: {
+                lhs.push_back(Literal{});
+                rhs.push_back(Literal::make_typed_from_value<Int>(ix));
+                break;
+            }
+            case 4: {
+                lhs.push_back(Literal::make_typed_from_value<Long>(std::numeric_limits<int64_t>::max()));
+                rhs.push_back(Literal::make_typed_from_value<Long>(ix));
+                break;
+            }
+            default: {
+                lhs.push_back(Literal::make_typed("1.25", IRI{Decimal::identifier}));
+                rhs.push_back(Literal::make_typed_from_value<UnsignedByte>(static_cast<uint8_t>(ix)));
+                break;
+            }
+        }
+    }
+
+    // partial block 3: xsd:boolean only
+    for (int ix = 0; ix < 10; ++ix) {
+        lhs.push_back(Literal::make_typed_from_value<Boolean>(ix % 2 == 0));
+        rhs.push_back(Literal::make_typed_from_value<Boolean>(ix % 3 == 0));
+    }
+
+    return {lhs, rhs};
+}
+
+bool bit(std::vector<uint64_t> const &mask, size_t const ix) {
+    return (mask[ix / literal_batch::block_size] >> (ix % literal_batch::block_size)) & 1;
+}
+
+template<typename BatchOp, typename ScalarOp>
+void check_arithmetic(BatchOp batch_op, ScalarOp scalar_op) {
+    auto const [lhs, rhs] = make_columns();
+    std::vector<Literal> out(lhs.size());
+    batch_op(lhs, rhs, out);
+
+    for (size_t ix = 0; ix < lhs.size(); ++ix) {
+        CAPTURE(ix);
+        CHECK(out[ix].backend_handle() == scalar_op(lhs[ix], rhs[ix]).backend_handle());
+    }
+}
+
+template<typename BatchOp, typename ScalarOp>
+void check_comparison(BatchOp batch_op, ScalarOp scalar_op) {
+    auto const [lhs, rhs] = make_columns();
+    std::vector<uint64_t> mask(literal_batch::bitmask_words(lhs.size()), ~uint64_t{0});
+    batch_op(lhs, rhs, mask);
+
+    for (size_t ix = 0; ix < lhs.size(); ++ix) {
+        CAPTURE(ix);
+        CHECK(bit(mask, ix) == (scalar_op(lhs[ix], rhs[ix]) == util::TriBool::True));
+    }
+
+    // unused bits are cleared
+    CHECK(mask.back() >> (lhs.size() % literal_batch::block_size) == 0);
+}
+
+}  // namespace
+
+TEST_SUITE("literal batch") {
+    TEST_CASE("arithmetic matches scalar") {
+        check_arithmetic([](auto const &l, auto const &r, auto &out) { literal_batch::add(l, r, out); }, [](auto const &l, auto const &r) { return l.add(r); });
+        check_arithmetic([](auto const &l, auto const &r, auto &out) { literal_batch::sub(l, r, out); }, [](auto const &l, auto const &r) { return l.sub(r); });
+        check_arithmetic([](auto const &l, auto const &r, auto &out) { literal_batch::mul(l, r, out); }, [](auto const &l, auto const &r) { return l.mul(r); });
+        check_arithmetic([](auto const &l, auto const &r, auto &out) { literal_batch::div(l, r, out); }, [](auto const &l, auto const &r) { return l.div(r); });
+    }
+
+    TEST_CASE("comparisons match scalar") {
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::eq(l, r, mask); }, [](auto const &l, auto const &r) { return l.eq(r); });
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::ne(l, r, mask); }, [](auto const &l, auto const &r) { return l.ne(r); });
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::lt(l, r, mask); }, [](auto const &l, auto const &r) { return l.lt(r); });
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::le(l, r, mask); }, [](auto const &l, auto const &r) { return l.le(r); });
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::gt(l, r, mask); }, [](auto const &l, auto const &r) { return l.gt(r); });
+        check_comparison([](auto const &l, auto const &r, auto &mask) { literal_batch::ge(l, r, mask); }, [](auto const &l, auto const &r) { return l.ge(r); });
+    }
+
+    TEST_CASE("ebv matches scalar") {
+        auto const [lhs, rhs] = make_columns();
+
+        for (auto const *column : {&lhs, &rhs}) {
+            std::vector<uint64_t> mask(literal_batch::bitmask_words(column->size()));
+            literal_batch::ebv(*column, mask);
+
+            for (size_t ix = 0; ix < column->size(); ++ix) {
+                CAPTURE(ix);
+                CHECK(bit(mask, ix) == ((*column)[ix].ebv() == util::TriBool::True));
+            }
+        }
+    }
+
+    TEST_CASE("empty input") {
+        std::vector<Literal> const empty;
+        std::vector<Literal> out;
+        std::vector<uint64_t> mask;
+
+        literal_batch::add(empty, empty, out);
+        literal_batch::lt(empty, empty, mask);
+        literal_batch::ebv(empty, mask);
+    }
+}
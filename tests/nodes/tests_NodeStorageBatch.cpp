@@ -0,0 +1,133 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/node/persistent_node_storage/PersistentNodeStorageBackend.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+
+TEST_CASE_TEMPLATE("find_or_make_ids", Backend,
+                   reference_node_storage::ReferenceNodeStorageBackend,
+                   reference_node_storage::ShardedReferenceNodeStorageBackend,
+                   reference_node_storage::ArenaReferenceNodeStorageBackend,
+                   persistent_node_storage::PersistentNodeStorageBackend) {
+
+    auto node_storage = NodeStorage::new_instance<Backend>();
+
+    SUBCASE("iris") {
+        auto const existing = IRI{"http://example.com/1", node_storage}.backend_handle().node_id();
+
+        std::vector<std::string> strings;
+        for (size_t ix = 0; ix < 1000; ++ix) {
+            strings.push_back("http://example.com/" + std::to_string(ix % 500));
+        }
+
+        std::vector<view::IRIBackendView> views;
+        for (auto const &str : strings) {
+            views.push_back(view::IRIBackendView{.identifier = str});
+        }
+
+        std::vector<identifier::NodeID> ids(views.size());
+        node_storage.find_or_make_ids(views, ids);
+
+        CHECK(ids[1] == existing);
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            CHECK(ids[ix] == node_storage.find_id(views[ix]));
+            CHECK(ids[ix] == ids[ix % 500]);
+            CHECK(node_storage.find_iri_backend_view(ids[ix]).identifier == strings[ix]);
+        }
+
+        // everything already exists now
+        std::vector<identifier::NodeID> ids2(views.size());
+        node_storage.find_or_make_ids(views, ids2);
+        CHECK(ids == ids2);
+    }
+
+    SUBCASE("bnodes and variables") {
+        std::vector<view::BNodeBackendView> const bnodes{{.identifier = "a"}, {.identifier = "b"}, {.identifier = "a"}};
+        std::vector<identifier::NodeID> bnode_ids(bnodes.size());
+        node_storage.find_or_make_ids(bnodes, bnode_ids);
+
+        CHECK(bnode_ids[0] == bnode_ids[2]);
+        CHECK(bnode_ids[0] != bnode_ids[1]);
+        CHECK(BlankNode{"b", node_storage}.backend_handle().node_id() == bnode_ids[1]);
+
+        std::vector<view::VariableBackendView> const vars{{.name = "x", .is_anonymous = false}, {.name = "x", .is_anonymous = true}};
+        std::vector<identifier::NodeID> var_ids(vars.size());
+        node_storage.find_or_make_ids(vars, var_ids);
+
+        CHECK(var_ids[0] != var_ids[1]);
+        CHECK(query::Variable{"x", true, node_storage}.backend_handle().node_id() == var_ids[1]);
+    }
+
+    SUBCASE("literals") {
+        auto const lang = Literal::make_lang_tagged("hello", "en", node_storage);
+
+        std::vector<view::LiteralBackendView> views{
+                view::LexicalFormLiteralBackendView{.datatype_id = identifier::NodeID::xsd_string_iri.first, .lexical_form = "hello", .language_tag = ""},
+                view::LexicalFormLiteralBackendView{.datatype_id = identifier::NodeID::rdf_langstring_iri.first, .lexical_form = "hello", .language_tag = "en"},
+                view::LexicalFormLiteralBackendView{.datatype_id = identifier::NodeID::xsd_string_iri.first, .lexical_form = "hello", .language_tag = ""}};
+
+        if (node_storage.has_specialized_storage_for(datatypes::xsd::Integer::fixed_id)) {
+            views.push_back(view::ValueLiteralBackendView{.datatype = datatypes::xsd::Integer::fixed_id,
+                                                          .value = datatypes::xsd::Integer::cpp_type{"123456789012345678901234567890"}});
+        }
+
+        std::vector<identifier::NodeID> ids(views.size());
+        node_storage.find_or_make_ids(views, ids);
+
+        CHECK(ids[0] == ids[2]);
+        CHECK(ids[0] != ids[1]);
+        CHECK(ids[1] == lang.backend_handle().node_id());
+        CHECK(ids[0].literal_type() == datatypes::xsd::String::fixed_id);
+        for (size_t ix = 0; ix < views.size(); ++ix) {
+            CHECK(ids[ix] == node_storage.find_id(views[ix]));
+        }
+    }
+}
+
+TEST_CASE("find_or_make_ids concurrently") {
+    auto node_storage = NodeStorage::new_instance<reference_node_storage::ShardedReferenceNodeStorageBackend>();
+
+    static constexpr size_t thread_count = 8;
+    static constexpr size_t count = 10000;
+
+    std::vector<std::string> strings;
+    for (size_t ix = 0; ix < count; ++ix) {
+        strings.push_back("http://example.com/" + std::to_string(ix));
+    }
+
+    std::vector<view::IRIBackendView> views;
+    for (auto const &str : strings) {
+        views.push_back(view::IRIBackendView{.identifier = str});
+    }
+
+    std::vector<std::vector<identifier::NodeID>> ids(thread_count, std::vector<identifier::NodeID>(count));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < thread_count; ++t) {
+        threads.emplace_back([&, t]() {
+            // batches of different size, so that the threads interleave
+            size_t const batch_size = 64 + t * 17;
+            for (size_t begin = 0; begin < count; begin += batch_size) {
+                auto const size = std::min(batch_size, count - begin);
+                node_storage.find_or_make_ids(std::span{views}.subspan(begin, size), std::span{ids[t]}.subspan(begin, size));
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t t = 1; t < thread_count; ++t) {
+        CHECK(ids[t] == ids[0]);
+    }
+    for (size_t ix = 0; ix < count; ++ix) {
+        CHECK(node_storage.find_iri_backend_view(ids[0][ix]).identifier == strings[ix]);
+    }
+}
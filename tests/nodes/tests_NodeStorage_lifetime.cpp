@@ -9,6 +9,7 @@
 #include <chrono>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 using namespace rdf4cpp::rdf;
 using namespace rdf4cpp::rdf::storage::node;
@@ -22,6 +23,36 @@ struct SlowDestructingBackend : reference_node_storage::ReferenceNodeStorageBack
     }
 };
 
+/**
+ * Records the refcount of observed while a view is looked up, i.e. while the NodeStorage is resolving a handle.
+ */
+struct RefCountObservingBackend : reference_node_storage::ReferenceNodeStorageBackend {
+    NodeStorage const *observed = nullptr;
+    mutable std::atomic<size_t> max_ref_count{0};
+
+    void observe() const noexcept {
+        auto const count = observed->ref_count();
+        auto prev = max_ref_count.load(std::memory_order_relaxed);
+        while (prev < count && !max_ref_count.compare_exchange_weak(prev, count, std::memory_order_relaxed)) {
+        }
+    }
+
+    [[nodiscard]] view::IRIBackendView find_iri_backend_view(identifier::NodeID id) const override {
+        observe();
+        return reference_node_storage::ReferenceNodeStorageBackend::find_iri_backend_view(id);
+    }
+
+    [[nodiscard]] view::LiteralBackendView find_literal_backend_view(identifier::NodeID id) const override {
+        observe();
+        return reference_node_storage::ReferenceNodeStorageBackend::find_literal_backend_view(id);
+    }
+
+    [[nodiscard]] view::BNodeBackendView find_bnode_backend_view(identifier::NodeID id) const override {
+        observe();
+        return reference_node_storage::ReferenceNodeStorageBackend::find_bnode_backend_view(id);
+    }
+};
+
 TEST_SUITE("NodeStorage lifetime and ref counting") {
     TEST_CASE("default_instance refcount") {
         NodeStorage &dns = NodeStorage::default_instance();
@@ -279,4 +310,33 @@ TEST_SUITE("NodeStorage lifetime and ref counting") {
             run.store(true, std::memory_order_release);
         }
     }
+
+    TEST_CASE("handle lookups do not touch the refcount") {
+        auto *backend = new RefCountObservingBackend{};
+        NodeStorage ns = NodeStorage::register_backend(backend);
+        backend->observed = &ns;
+
+        IRI const iri{"http://example.com/iri", ns};
+        BlankNode const bnode{"b1", ns};
+        Literal const lit = Literal::make_simple("hello", ns);
+
+        REQUIRE(ns.ref_count() == 1);
+
+        std::vector<std::jthread> readers;
+        for (size_t t = 0; t < 8; ++t) {
+            readers.emplace_back([&]() {
+                for (size_t i = 0; i < 1000; ++i) {
+                    REQUIRE(iri.identifier() == "http://example.com/iri");
+                    REQUIRE(bnode.identifier() == "b1");
+                    REQUIRE(lit.lexical_form() == "hello");
+                }
+            });
+        }
+        readers.clear();
+
+        // an increment while resolving a handle would have been seen from inside the backend
+        CHECK(backend->max_ref_count.load() == 1);
+        CHECK(ns.ref_count() == 1);
+        CHECK(NodeStorage::has_specialized_storage_for(ns.id(), identifier::LiteralType::other()) == ns.has_specialized_storage_for(identifier::LiteralType::other()));
+    }
 }
@@ -61,10 +61,10 @@ void check_specialized_storage_usage(std::array<typename T::cpp_type, N> const &
             CHECK(backend2.datatype == backend3.datatype);
             CHECK(backend3.datatype == T::fixed_id);
 
-            CHECK(value == std::any_cast<typename T::cpp_type>(backend1.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend1.value) == std::any_cast<typename T::cpp_type>(backend2.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend2.value) == std::any_cast<typename T::cpp_type>(backend3.value));
-            CHECK(std::any_cast<typename T::cpp_type>(backend3.value) == value);
+            CHECK(value == backend1.value.template get<typename T::cpp_type>());
+            CHECK(backend1.value.template get<typename T::cpp_type>() == backend2.value.template get<typename T::cpp_type>());
+            CHECK(backend2.value.template get<typename T::cpp_type>() == backend3.value.template get<typename T::cpp_type>());
+            CHECK(backend3.value.template get<typename T::cpp_type>() == value);
 
             auto const value1 = std::any_cast<typename T::cpp_type>(lit1.value());
             auto const value2 = std::any_cast<typename T::cpp_type>(lit2.value());
@@ -0,0 +1,229 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/node/persistent_node_storage/PersistentNodeStorageBackend.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+using persistent_node_storage::PersistentNodeStorageBackend;
+
+struct TempFile {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("rdf4cpp_tests_PersistentNodeStorage_" + std::to_string(::getpid()));
+
+    ~TempFile() {
+        std::filesystem::remove(path);
+    }
+};
+
+/**
+ * Registers backend, which stays valid as long as the returned NodeStorage is alive.
+ */
+NodeStorage register_backend(PersistentNodeStorageBackend *backend) {
+    return NodeStorage::register_backend(static_cast<INodeStorageBackend *>(backend));
+}
+
+TEST_SUITE("PersistentNodeStorageBackend") {
+    TEST_CASE("basic node handling") {
+        auto node_storage = NodeStorage::new_instance<PersistentNodeStorageBackend>();
+
+        IRI const iri{"http://example.com/a", node_storage};
+        CHECK(iri.identifier() == "http://example.com/a");
+        CHECK(iri == IRI{"http://example.com/a", node_storage});
+        CHECK(iri != IRI{"http://example.com/b", node_storage});
+
+        auto const lang = Literal::make_lang_tagged("hello", "en", node_storage);
+        CHECK(lang.lexical_form() == "hello");
+        CHECK(lang.language_tag() == "en");
+
+        // not inlineable, stored by lexical form
+        datatypes::xsd::Integer::cpp_type const big_value{"123456789012345678901234567890"};
+        auto const big = Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage);
+        CHECK(big.value<datatypes::xsd::Integer>() == big_value);
+
+        CHECK(IRI{datatypes::xsd::String::identifier, node_storage}.backend_handle().node_id().value() == datatypes::xsd::String::fixed_id.to_underlying());
+
+        auto const size = node_storage.size();
+        CHECK(node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(not node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(node_storage.size() == size - 1);
+    }
+
+    TEST_CASE("save and map") {
+        TempFile file;
+
+        static constexpr size_t count = 1000;
+
+        std::vector<identifier::NodeID> iri_ids;
+        identifier::NodeID bnode_id;
+        identifier::NodeID var_id;
+        identifier::NodeID simple_id;
+        identifier::NodeID lang_id;
+        identifier::NodeID big_id;
+        size_t size;
+
+        datatypes::xsd::Integer::cpp_type const big_value{"123456789012345678901234567890"};
+
+        {
+            auto *backend = new PersistentNodeStorageBackend{};
+            auto node_storage = register_backend(backend);
+
+            for (size_t ix = 0; ix < count; ++ix) {
+                iri_ids.push_back(IRI{"http://example.com/" + std::to_string(ix), node_storage}.backend_handle().node_id());
+            }
+            bnode_id = BlankNode{"b1", node_storage}.backend_handle().node_id();
+            var_id = query::Variable{"x", true, node_storage}.backend_handle().node_id();
+            simple_id = Literal::make_simple("hello", node_storage).backend_handle().node_id();
+            lang_id = Literal::make_lang_tagged("hello", "en", node_storage).backend_handle().node_id();
+            big_id = Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage).backend_handle().node_id();
+            size = node_storage.size();
+
+            backend->save(file.path);
+        }
+
+        auto *backend = new PersistentNodeStorageBackend{file.path};
+        auto node_storage = register_backend(backend);
+
+        CHECK(node_storage.size() == size);
+        CHECK(backend->mapped_size() == size);
+
+        for (size_t ix = 0; ix < count; ++ix) {
+            auto const iri = "http://example.com/" + std::to_string(ix);
+            CHECK(node_storage.find_iri_backend_view(iri_ids[ix]).identifier == iri);
+            CHECK(IRI{iri, node_storage}.backend_handle().node_id() == iri_ids[ix]);
+        }
+
+        CHECK(BlankNode{"b1", node_storage}.backend_handle().node_id() == bnode_id);
+        CHECK(query::Variable{"x", true, node_storage}.backend_handle().node_id() == var_id);
+        CHECK(node_storage.find_id(view::VariableBackendView{.name = "x", .is_anonymous = false}).null());
+        CHECK(Literal::make_simple("hello", node_storage).backend_handle().node_id() == simple_id);
+        CHECK(Literal::make_lang_tagged("hello", "en", node_storage).backend_handle().node_id() == lang_id);
+
+        auto const big = Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage);
+        CHECK(big.backend_handle().node_id() == big_id);
+        CHECK(big.value<datatypes::xsd::Integer>() == big_value);
+
+        CHECK(IRI{datatypes::xsd::String::identifier, node_storage}.backend_handle().node_id().value() == datatypes::xsd::String::fixed_id.to_underlying());
+
+        // mapped nodes cannot be erased
+        CHECK(not node_storage.erase_iri(iri_ids[0]));
+        CHECK(node_storage.find_iri_backend_view(iri_ids[0]).identifier == "http://example.com/0");
+
+        // new nodes get fresh ids
+        auto const new_id = IRI{"http://example.com/new", node_storage}.backend_handle().node_id();
+        for (auto const id : iri_ids) {
+            CHECK(id != new_id);
+        }
+        CHECK(node_storage.size() == size + 1);
+
+        // save over the mapped file
+        backend->save(file.path);
+
+        auto reopened = NodeStorage::new_instance<PersistentNodeStorageBackend>(file.path);
+        CHECK(reopened.size() == size + 1);
+        CHECK(IRI{"http://example.com/new", reopened}.backend_handle().node_id() == new_id);
+        CHECK(reopened.find_iri_backend_view(iri_ids[count - 1]).identifier == "http://example.com/" + std::to_string(count - 1));
+    }
+
+    TEST_CASE("invalid file") {
+        TempFile file;
+
+        {
+            std::ofstream out{file.path};
+            // long enough to contain a header
+            out << std::string(1024, 'x');
+        }
+
+        CHECK_THROWS_AS(PersistentNodeStorageBackend{file.path}, std::runtime_error);
+        CHECK_THROWS_AS(PersistentNodeStorageBackend{file.path.string() + ".does_not_exist"}, std::system_error);
+    }
+
+    TEST_CASE("corrupt file") {
+        namespace format = persistent_node_storage::format;
+
+        TempFile file;
+
+        {
+            auto *backend = new PersistentNodeStorageBackend{};
+            auto node_storage = register_backend(backend);
+            IRI{"http://example.com/a", node_storage};
+            IRI{"http://example.com/b", node_storage};
+            backend->save(file.path);
+        }
+
+        std::string contents;
+        {
+            std::ifstream in{file.path, std::ios::binary};
+            contents.assign(std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{});
+        }
+
+        format::FileHeader header;
+        std::memcpy(&header, contents.data(), sizeof(header));
+        auto const &iris = header.sections[static_cast<size_t>(format::SectionKind::IRI)];
+        REQUIRE(iris.entry_count > 0);
+
+        auto const set = [&](size_t const offset, uint64_t const value) {
+            std::memcpy(contents.data() + offset, &value, sizeof(value));
+        };
+
+        auto const write = [&]() {
+            std::ofstream out{file.path, std::ios::binary | std::ios::trunc};
+            out.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+        };
+
+        // opening only validates the header, the lookups must not read outside the mapping or loop forever
+        auto const check_not_found = [](PersistentNodeStorageBackend const &backend) {
+            for (size_t ix = 0; ix < 64; ++ix) {
+                auto const iri = "http://example.com/not_found" + std::to_string(ix);
+                CHECK(backend.find_id(view::IRIBackendView{.identifier = iri}).null());
+            }
+        };
+
+        SUBCASE("hash table entry out of bounds") {
+            for (size_t slot = 0; slot < iris.table_size; ++slot) {
+                set(iris.table_offset + slot * sizeof(uint64_t), iris.entry_count + 1);
+            }
+            write();
+
+            PersistentNodeStorageBackend backend{file.path};
+            check_not_found(backend);
+            CHECK(backend.find_id(view::IRIBackendView{.identifier = "http://example.com/a"}).null());
+        }
+
+        SUBCASE("hash table without empty slot") {
+            for (size_t slot = 0; slot < iris.table_size; ++slot) {
+                set(iris.table_offset + slot * sizeof(uint64_t), 1);
+            }
+            write();
+
+            PersistentNodeStorageBackend backend{file.path};
+            check_not_found(backend);
+        }
+
+        SUBCASE("strings of entry out of bounds") {
+            format::Entry entry;
+            std::memcpy(&entry, contents.data() + iris.entries_offset, sizeof(entry));
+            set(iris.entries_offset + offsetof(format::Entry, offset), iris.strings_size);
+            write();
+
+            PersistentNodeStorageBackend backend{file.path};
+            check_not_found(backend);
+            CHECK_THROWS_AS(std::ignore = backend.find_iri_backend_view(identifier::NodeID{entry.id}), std::runtime_error);
+
+            TempFile copy;
+            copy.path += "_copy";
+            CHECK_THROWS_AS(backend.save(copy.path), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+
+TEST_SUITE("ShardedReferenceNodeStorageBackend") {
+    TEST_CASE("basic node handling") {
+        auto node_storage = NodeStorage::new_instance<reference_node_storage::ShardedReferenceNodeStorageBackend>();
+
+        IRI const iri{"http://example.com/a", node_storage};
+        CHECK(iri.identifier() == "http://example.com/a");
+        CHECK(iri == IRI{"http://example.com/a", node_storage});
+        CHECK(iri != IRI{"http://example.com/b", node_storage});
+
+        BlankNode const bnode{"b1", node_storage};
+        CHECK(bnode.identifier() == "b1");
+
+        auto const simple = Literal::make_simple("hello", node_storage);
+        CHECK(simple.lexical_form() == "hello");
+
+        // not inlineable, goes to specialized storage
+        datatypes::xsd::Integer::cpp_type const big_value{"123456789012345678901234567890"};
+        auto const big = Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage);
+        CHECK(big.value<datatypes::xsd::Integer>() == big_value);
+        CHECK(big == Literal::make_typed_from_value<datatypes::xsd::Integer>(big_value, node_storage));
+
+        // reserved datatype IRIs are present from the start
+        CHECK(IRI{datatypes::xsd::String::identifier, node_storage}.backend_handle().node_id().value() == datatypes::xsd::String::fixed_id.to_underlying());
+
+        auto const size = node_storage.size();
+        CHECK(node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(not node_storage.erase_iri(iri.backend_handle().node_id()));
+        CHECK(node_storage.size() == size - 1);
+        CHECK(node_storage.find_id(storage::node::view::IRIBackendView{.identifier = "http://example.com/a"}).null());
+    }
+
+    TEST_CASE("concurrent interning hands out consistent, dense ids") {
+        auto node_storage = NodeStorage::new_instance<reference_node_storage::ShardedReferenceNodeStorageBackend>();
+
+        static constexpr size_t iri_count = 10000;
+        static constexpr size_t thread_count = 8;
+
+        std::vector<std::string> iris;
+        iris.reserve(iri_count);
+        for (size_t ix = 0; ix < iri_count; ++ix) {
+            iris.push_back("http://example.com/" + std::to_string(ix));
+        }
+
+        std::vector<std::vector<uint64_t>> ids(thread_count, std::vector<uint64_t>(iri_count));
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back([&, t]() {
+                std::vector<size_t> order(iri_count);
+                std::iota(order.begin(), order.end(), 0);
+                std::shuffle(order.begin(), order.end(), std::mt19937{static_cast<unsigned>(t)});
+
+                for (auto const ix : order) {
+                    ids[t][ix] = IRI{iris[ix], node_storage}.backend_handle().node_id().value();
+                }
+            });
+        }
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        for (size_t t = 1; t < thread_count; ++t) {
+            CHECK(ids[t] == ids[0]);
+        }
+
+        std::vector<uint64_t> sorted_ids = ids[0];
+        std::sort(sorted_ids.begin(), sorted_ids.end());
+        CHECK(std::adjacent_find(sorted_ids.begin(), sorted_ids.end()) == sorted_ids.end());
+        CHECK(sorted_ids.back() - sorted_ids.front() + 1 == iri_count);
+        CHECK(sorted_ids.front() == identifier::NodeID::min_iri_id.value());
+
+        for (size_t ix = 0; ix < iri_count; ++ix) {
+            CHECK(node_storage.find_iri_backend_view(identifier::NodeID{ids[0][ix]}).identifier == iris[ix]);
+        }
+    }
+}
@@ -197,6 +197,31 @@ TEST_SUITE("IStreamQuadIterator") {
         CHECK(qit != IStreamQuadIterator{});
         CHECK(!qit->has_value());
         std::cerr << qit->error() << std::endl;
+        CHECK(qit->error().error_type == ParsingError::Type::BadLiteral);
+
+        ++qit;
+        CHECK(qit == IStreamQuadIterator{});
+    }
+
+    TEST_CASE("invalid literals are skipped") {
+        constexpr char const *triples = "<http://ex.com/s> <http://ex.com/p> \"1.5\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n"
+                                        "<http://ex.com/s> <http://ex.com/p> \"abc\"^^<http://www.w3.org/1999/02/22-rdf-syntax-ns#langString> .\n"
+                                        "<http://ex.com/s> <http://ex.com/p> \"1e5\"^^<http://www.w3.org/2001/XMLSchema#decimal> .\n"
+                                        "<http://ex.com/s> <http://ex.com/p> \"010\"^^<http://www.w3.org/2001/XMLSchema#integer> .\n";
+
+        std::istringstream iss{triples};
+        IStreamQuadIterator qit{iss};
+
+        for (size_t ix = 0; ix < 3; ++ix) {
+            CHECK(qit != IStreamQuadIterator{});
+            CHECK(!qit->has_value());
+            CHECK(qit->error().error_type == ParsingError::Type::BadLiteral);
+            ++qit;
+        }
+
+        CHECK(qit != IStreamQuadIterator{});
+        CHECK(qit->has_value());
+        CHECK(qit->value().object() == Literal::make_typed_from_value<datatypes::xsd::Integer>(10));
 
         ++qit;
         CHECK(qit == IStreamQuadIterator{});
@@ -280,4 +305,48 @@ TEST_SUITE("IStreamQuadIterator") {
         ++qit;
         CHECK(qit == IStreamQuadIterator{});
     }
+
+    TEST_CASE("next_batch") {
+        std::string triples;
+        for (size_t ix = 0; ix < 10; ++ix) {
+            if (ix == 4) {
+                triples += "<http://example.org/s> http://example.org/p> \"broken\" .\n";
+            } else {
+                triples += "<http://example.org/s> <http://example.org/p> \"" + std::to_string(ix) + "\" .\n";
+            }
+        }
+
+        std::vector<Quad> expected;
+        {
+            std::istringstream iss{triples};
+            for (IStreamQuadIterator qit{iss}; qit != IStreamQuadIterator{}; ++qit) {
+                if (qit->has_value()) {
+                    expected.push_back(qit->value());
+                }
+            }
+        }
+        REQUIRE(expected.size() == 9);
+
+        std::istringstream iss{triples};
+        IStreamQuadIterator qit{iss};
+        std::vector<Quad> batch;
+
+        CHECK(qit.next_batch(batch, 0) == 0);
+        CHECK(qit.next_batch(batch, 3) == 3);
+        CHECK(qit->value() == expected[3]);
+
+        // stops in front of the error
+        CHECK(qit.next_batch(batch, 3) == 1);
+        CHECK(qit != IStreamQuadIterator{});
+        CHECK(!qit->has_value());
+        CHECK(qit->error().line == 5);
+        CHECK(qit.next_batch(batch, 3) == 0);
+
+        ++qit;
+        CHECK(qit.next_batch(batch, 100) == 5);
+        CHECK(qit == IStreamQuadIterator{});
+        CHECK(qit.next_batch(batch, 100) == 0);
+
+        CHECK(batch == expected);
+    }
 }
@@ -4,6 +4,11 @@
 #include <rdf4cpp/rdf.hpp>
 #include <rdf4cpp/rdf/parser/RDFFileParser.hpp>
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
 TEST_SUITE("RDFFileParser") {
     TEST_CASE("not existing file") {
         rdf4cpp::rdf::parser::RDFFileParser parse{"shouldnotexist.ttl"};
@@ -46,5 +51,209 @@ TEST_SUITE("RDFFileParser") {
         ++it;
         CHECK(it != pars.end());
     }
+    TEST_CASE("memory mapped") {
+        using namespace rdf4cpp::rdf;
+
+        SUBCASE("not existing file") {
+            parser::RDFFileParser parse{"shouldnotexist.ttl", parser::ParsingFlag::MemoryMapped};
+            CHECK((parse.begin() == parse.end()));
+        }
+
+        SUBCASE("same as stream") {
+            std::vector<Quad> streamed;
+            for (auto const &v : parser::RDFFileParser{"./tests_RDFFileParser_simple.ttl"}) {
+                REQUIRE(v.has_value());
+                streamed.push_back(v.value());
+            }
+
+            std::vector<Quad> mapped;
+            for (auto const &v : parser::RDFFileParser{"./tests_RDFFileParser_simple.ttl", parser::ParsingFlag::MemoryMapped}) {
+                REQUIRE(v.has_value());
+                mapped.push_back(v.value());
+            }
+
+            CHECK(mapped.size() == 3);
+            CHECK(mapped == streamed);
+        }
+
+        SUBCASE("empty file") {
+            auto const path = std::filesystem::temp_directory_path() / "rdf4cpp_tests_RDFFileParser_empty.nt";
+            std::ofstream{path};
+
+            parser::RDFFileParser parse{path.string(), parser::ParsingFlag::MemoryMapped};
+            CHECK((parse.begin() == parse.end()));
+
+            std::filesystem::remove(path);
+        }
+    }
+    TEST_CASE("parallel") {
+        using namespace rdf4cpp::rdf;
+
+        auto const path = std::filesystem::temp_directory_path() / "rdf4cpp_tests_RDFFileParser_parallel.nt";
+        static constexpr size_t line_count = 20000;
+        static constexpr size_t bad_line = 12345;
+
+        {
+            std::ofstream out{path};
+            for (size_t ix = 0; ix < line_count; ++ix) {
+                if (ix == bad_line) {
+                    out << "this is not a triple\n";
+                } else {
+                    out << "<http://example.com/s" << ix % 100 << "> <http://example.com/p> \"" << ix << "\" .\n";
+                }
+            }
+        }
+
+        std::vector<Quad> sequential;
+        for (auto const &v : parser::RDFFileParser{path.string()}) {
+            if (v.has_value()) {
+                sequential.push_back(v.value());
+            }
+        }
+        REQUIRE(sequential.size() == line_count - 1);
+
+        SUBCASE("ordered") {
+            std::vector<Quad> parallel;
+            size_t errors = 0;
+            for (auto const &v : parser::RDFFileParser{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 4096, .ordered = true}}) {
+                if (v.has_value()) {
+                    parallel.push_back(v.value());
+                } else {
+                    ++errors;
+                    CHECK(v.error().line == bad_line + 1);
+                }
+            }
+
+            CHECK(errors == 1);
+            CHECK(parallel == sequential);
+        }
+
+        SUBCASE("unordered") {
+            std::vector<Quad> parallel;
+            size_t errors = 0;
+            for (auto const &v : parser::RDFFileParser{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 4096, .ordered = false}}) {
+                if (v.has_value()) {
+                    parallel.push_back(v.value());
+                } else {
+                    ++errors;
+                    CHECK(v.error().line == bad_line + 1);
+                }
+            }
+
+            CHECK(errors == 1);
+            std::sort(parallel.begin(), parallel.end());
+            std::sort(sequential.begin(), sequential.end());
+            CHECK(parallel == sequential);
+        }
+
+        SUBCASE("memory mapped") {
+            std::vector<Quad> parallel;
+            size_t errors = 0;
+            for (auto const &v : parser::RDFFileParser{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 4096, .ordered = true}, parser::ParsingFlag::MemoryMapped}) {
+                if (v.has_value()) {
+                    parallel.push_back(v.value());
+                } else {
+                    ++errors;
+                    CHECK(v.error().line == bad_line + 1);
+                }
+            }
+
+            CHECK(errors == 1);
+            CHECK(parallel == sequential);
+
+            std::vector<Quad> mapped;
+            for (auto const &v : parser::RDFFileParser{path.string(), parser::ParsingFlag::MemoryMapped}) {
+                if (v.has_value()) {
+                    mapped.push_back(v.value());
+                } else {
+                    CHECK(v.error().line == bad_line + 1);
+                }
+            }
+            CHECK(mapped == sequential);
+        }
+
+        SUBCASE("stop early") {
+            parser::RDFFileParser parse{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 128}};
+            auto it = parse.begin();
+            CHECK(it != parse.end());
+            ++it;
+            CHECK(it->value() == sequential[1]);
+            // destroying the iterator stops the workers
+        }
+
+        SUBCASE("move assign over running iterator") {
+            parser::RDFFileParser mapped{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 128}, parser::ParsingFlag::MemoryMapped};
+            parser::RDFFileParser streamed{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 128}};
+
+            auto it = mapped.begin();
+            ++it;
+            CHECK(it->value() == sequential[1]);
+
+            // the workers of the replaced iterator still read from its mapping
+            it = streamed.begin();
+            std::vector<Quad> parallel;
+            for (; it != streamed.end(); ++it) {
+                if (it->has_value()) {
+                    parallel.push_back(it->value());
+                }
+            }
+            CHECK(parallel == sequential);
+
+            it = mapped.begin();
+            ++it;
+            it = mapped.begin();
+            CHECK(it->value() == sequential[0]);
+        }
+
+        std::filesystem::remove(path);
+    }
+    TEST_CASE("parallel N-Quads") {
+        using namespace rdf4cpp::rdf;
+
+        auto const path = std::filesystem::temp_directory_path() / "rdf4cpp_tests_RDFFileParser_parallel.nq";
+        static constexpr size_t line_count = 20000;
+
+        {
+            std::ofstream out{path};
+            for (size_t ix = 0; ix < line_count; ++ix) {
+                out << "<http://example.com/s" << ix % 100 << "> <http://example.com/p> \"" << ix << "\"";
+                switch (ix % 3) {
+                    case 0:
+                        break;  // default graph
+                    case 1:
+                        out << " <http://example.com/g" << ix % 7 << ">";
+                        break;
+                    default:
+                        out << " _:g" << ix % 5;
+                        break;
+                }
+                out << " .\n";
+            }
+        }
+
+        std::vector<Quad> sequential;
+        {
+            std::ifstream in{path};
+            for (parser::IStreamQuadIterator qit{in, parser::ParsingFlags::none(), {}, storage::node::NodeStorage::default_instance(), parser::ParsingSyntax::NQuads}; qit != parser::IStreamQuadIterator{}; ++qit) {
+                REQUIRE(qit->has_value());
+                sequential.push_back(qit->value());
+            }
+        }
+        REQUIRE(sequential.size() == line_count);
+        CHECK(sequential[0].graph() == IRI::default_graph());
+        CHECK(sequential[1].graph() == IRI{"http://example.com/g1"});
+        CHECK(sequential[2].graph().is_blank_node());
+
+        for (auto const flags : {parser::ParsingFlags::none(), parser::ParsingFlags{parser::ParsingFlag::MemoryMapped}}) {
+            std::vector<Quad> parallel;
+            for (auto const &v : parser::RDFFileParser{path.string(), parser::ParallelParsingOptions{.num_threads = 4, .chunk_size = 4096, .ordered = true}, flags}) {
+                REQUIRE(v.has_value());
+                parallel.push_back(v.value());
+            }
+            CHECK(parallel == sequential);
+        }
+
+        std::filesystem::remove(path);
+    }
     // only testing basic iterator functionality here, see tests for IStreamQuadIterator for more parsing tests
 }
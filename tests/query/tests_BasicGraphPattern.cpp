@@ -0,0 +1,100 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+static std::set<std::vector<Node>> collect(std::vector<query::Solution> const &solutions) {
+    std::set<std::vector<Node>> ret;
+    for (auto const &solution : solutions) {
+        std::vector<Node> row;
+        for (size_t ix = 0; ix < solution.variable_count(); ++ix) {
+            row.push_back(solution[ix]);
+        }
+        ret.insert(std::move(row));
+    }
+    return ret;
+}
+
+TEST_CASE_TEMPLATE("BasicGraphPattern", Backend, DefaultDatasetBackend, IndexedDatasetBackend, MVCCDatasetBackend) {
+    auto dataset = Dataset::new_instance<Backend>();
+
+    IRI const g1{"http://example.com/g1"};
+    IRI const knows{"http://example.com/knows"};
+    IRI const name{"http://example.com/name"};
+    IRI const alice{"http://example.com/alice"};
+    IRI const bob{"http://example.com/bob"};
+    IRI const carol{"http://example.com/carol"};
+    auto const alice_name = Literal::make_simple("Alice");
+    auto const bob_name = Literal::make_simple("Bob");
+
+    dataset.add(Quad{alice, knows, bob});
+    dataset.add(Quad{bob, knows, carol});
+    dataset.add(Quad{carol, knows, carol});
+    dataset.add(Quad{alice, name, alice_name});
+    dataset.add(Quad{bob, name, bob_name});
+    dataset.add(Quad{g1, carol, name, Literal::make_simple("Carol")});
+
+    query::Variable const g{"g"};
+    query::Variable const x{"x"};
+    query::Variable const y{"y"};
+    query::Variable const n{"n"};
+
+    SUBCASE("join on a shared variable") {
+        query::BasicGraphPattern const bgp{std::vector<query::TriplePattern>{{x, knows, y}, {y, name, n}}};
+        REQUIRE(bgp.variables() == std::vector<query::Variable>{x, y, n});
+
+        auto const solutions = bgp.evaluate(dataset);
+        CHECK(collect(solutions) == std::set<std::vector<Node>>{{alice, bob, bob_name}});
+        CHECK(solutions.front()[n] == bob_name);
+    }
+
+    SUBCASE("graph variable") {
+        query::BasicGraphPattern bgp;
+        bgp.add(query::TriplePattern{x, knows, y});
+        bgp.add(query::TriplePattern{y, name, n}, g);
+
+        REQUIRE(bgp.variables() == std::vector<query::Variable>{x, y, g, n});
+        CHECK(collect(bgp.evaluate(dataset)) == std::set<std::vector<Node>>{{alice, bob, IRI::default_graph(), bob_name},
+                                                                            {bob, carol, g1, Literal::make_simple("Carol")},
+                                                                            {carol, carol, g1, Literal::make_simple("Carol")}});
+    }
+
+    SUBCASE("path") {
+        query::BasicGraphPattern const bgp{std::vector<query::TriplePattern>{{alice, knows, x}, {x, knows, y}, {y, knows, y}}};
+        CHECK(collect(bgp.evaluate(dataset)) == std::set<std::vector<Node>>{{bob, carol}});
+    }
+
+    SUBCASE("repeated variable") {
+        query::BasicGraphPattern const bgp{std::vector<query::TriplePattern>{{x, knows, x}}};
+        CHECK(collect(bgp.evaluate(dataset)) == std::set<std::vector<Node>>{{carol}});
+    }
+
+    SUBCASE("cross product") {
+        query::BasicGraphPattern const bgp{std::vector<query::TriplePattern>{{alice, knows, x}, {y, name, bob_name}}};
+        CHECK(collect(bgp.evaluate(dataset)) == std::set<std::vector<Node>>{{bob, bob}});
+    }
+
+    SUBCASE("no solutions") {
+        query::BasicGraphPattern const unknown_predicate{std::vector<query::TriplePattern>{{x, knows, y}, {y, IRI{"http://example.com/unknown"}, n}}};
+        CHECK(unknown_predicate.evaluate(dataset).empty());
+
+        query::BasicGraphPattern const no_join_partner{std::vector<query::TriplePattern>{{x, name, alice_name}, {y, knows, x}}};
+        CHECK(no_join_partner.evaluate(dataset).empty());
+    }
+
+    SUBCASE("empty") {
+        query::BasicGraphPattern const bgp;
+        auto const solutions = bgp.evaluate(dataset);
+        REQUIRE(solutions.size() == 1);
+        CHECK(solutions.front().variable_count() == 0);
+    }
+}
@@ -0,0 +1,130 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/DatasetStatistics.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+#include <rdf4cpp/rdf/storage/util/robin-hood-hashing/robin_hood_hash.hpp>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+static size_t count(query::SolutionSequence const &solutions) {
+    size_t ret = 0;
+    for (auto it = solutions.begin(); it != solutions.end(); ++it) {
+        ++ret;
+    }
+    return ret;
+}
+
+TEST_CASE("HyperLogLog") {
+    HyperLogLog sketch;
+    CHECK(sketch.estimate() == 0.0);
+
+    for (size_t const distinct : {size_t{10}, size_t{1000}, size_t{100000}}) {
+        CAPTURE(distinct);
+        HyperLogLog hll;
+        for (size_t round = 0; round < 3; ++round) {
+            // duplicates do not change the estimate
+            for (uint64_t ix = 0; ix < distinct; ++ix) {
+                hll.add(storage::util::robin_hood::hash_int(ix));
+            }
+        }
+        CHECK(std::abs(hll.estimate() - static_cast<double>(distinct)) <= 0.1 * static_cast<double>(distinct));
+    }
+}
+
+TEST_CASE("DatasetStatistics") {
+    IRI const g1{"http://example.com/g1"};
+    IRI const g2{"http://example.com/g2"};
+    IRI const type{"http://example.com/type"};
+    IRI const name{"http://example.com/name"};
+    IRI const cls{"http://example.com/Class"};
+
+    // 1000 subjects with a type (one of 2 classes) and a name, half of them in g1
+    std::vector<Quad> quads;
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        IRI const subject{"http://example.com/s" + std::to_string(ix)};
+        auto const &graph = ix % 2 == 0 ? g1 : g2;
+        quads.emplace_back(graph, subject, type, IRI{"http://example.com/Class" + std::to_string(ix % 2)});
+        quads.emplace_back(graph, subject, name, Literal::make_simple("name " + std::to_string(ix)));
+    }
+
+    DatasetStatistics statistics;
+    for (auto const &quad : quads) {
+        statistics.add(HandleQuad::from_quad(quad));
+    }
+
+    query::Variable const g{"g"};
+    query::Variable const s{"s"};
+    query::Variable const p{"p"};
+    query::Variable const o{"o"};
+
+    CHECK(statistics.size() == 2000);
+    CHECK(statistics.graph_size(g1.backend_handle()) == 1000);
+    CHECK(statistics.graph_size(cls.backend_handle()) == 0);
+    CHECK(statistics.predicate_size(type.backend_handle()) == 1000);
+    CHECK(statistics.predicate_size(cls.backend_handle()) == 0);
+
+    CHECK(statistics.distinct_subjects(type.backend_handle()) == doctest::Approx(1000).epsilon(0.1));
+    CHECK(statistics.distinct_objects(type.backend_handle()) == 2);
+    CHECK(statistics.distinct_objects(name.backend_handle()) == doctest::Approx(1000).epsilon(0.1));
+    CHECK(statistics.distinct_subjects() == doctest::Approx(1000).epsilon(0.1));
+
+    // exact
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, s, p, o}) == 2000);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g1, s, p, o}) == 1000);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, s, type, o}) == 1000);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, s, cls, o}) == 0);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{cls, s, p, o}) == 0);
+
+    // estimated
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g1, s, type, o}) == 500);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, s, type, IRI{"http://example.com/Class0"}}) == 500);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, IRI{"http://example.com/s1"}, name, o}) == 1);
+    CHECK(statistics.estimate_cardinality(query::QuadPattern{g, IRI{"http://example.com/s1"}, p, o}) == 2);
+}
+
+TEST_CASE_TEMPLATE("estimate_cardinality of backends", Backend, DefaultDatasetBackend, IndexedDatasetBackend, MVCCDatasetBackend) {
+    auto dataset = Dataset::new_instance<Backend>();
+
+    IRI const g1{"http://example.com/g1"};
+    IRI const p1{"http://example.com/p1"};
+    IRI const p2{"http://example.com/p2"};
+
+    for (size_t ix = 0; ix < 600; ++ix) {
+        IRI const subject{"http://example.com/s" + std::to_string(ix % 200)};
+        auto const object = Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix));
+        if (ix % 3 == 0) {
+            dataset.add(Quad{g1, subject, p1, object});
+        } else {
+            dataset.add(Quad{subject, p2, object});
+        }
+    }
+    dataset.add(Quad{g1, IRI{"http://example.com/s0"}, p1, Literal::make_typed_from_value<datatypes::xsd::Int>(0)});  // duplicate
+
+    query::Variable const g{"g"};
+    query::Variable const s{"s"};
+    query::Variable const p{"p"};
+    query::Variable const o{"o"};
+
+    CHECK(dataset.size(g1) == 200);
+    CHECK(dataset.size(IRI::default_graph()) == 400);
+
+    CHECK(dataset.estimate_cardinality(query::QuadPattern{g, s, p, o}) == 600);
+    CHECK(dataset.estimate_cardinality(query::QuadPattern{g1, s, p, o}) == 200);
+    CHECK(dataset.estimate_cardinality(query::QuadPattern{g, s, p2, o}) == 400);
+    CHECK(dataset.estimate_cardinality(query::QuadPattern{g, s, g1, o}) == 0);
+    CHECK(dataset.estimate_cardinality(query::QuadPattern{g1, IRI{"http://example.com/s0"}, p1, Literal::make_typed_from_value<datatypes::xsd::Int>(0)}) == 1);
+
+    query::QuadPattern const subject_pattern{g, IRI{"http://example.com/s7"}, p2, o};
+    auto const actual = count(dataset.match(subject_pattern));
+    auto const estimate = dataset.estimate_cardinality(subject_pattern);
+    CHECK(estimate >= 1);
+    CHECK(estimate <= 2 * actual);
+}
@@ -0,0 +1,52 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/HandleQuad.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+TEST_CASE("HandleQuad") {
+    IRI const g{"http://example.com/g"};
+    IRI const s{"http://example.com/s"};
+    IRI const p{"http://example.com/p"};
+    auto const o = Literal::make_typed_from_value<datatypes::xsd::Int>(42);
+
+    SUBCASE("round trip") {
+        Quad const quad{g, s, p, o};
+        auto const handles = HandleQuad::from_quad(quad);
+
+        CHECK(handles.graph() == g.backend_handle());
+        CHECK(handles.subject() == s.backend_handle());
+        CHECK(handles.predicate() == p.backend_handle());
+        CHECK(handles.object() == o.backend_handle());
+        CHECK(handles.to_quad() == quad);
+
+        Quad const default_graph_quad{s, p, o};
+        CHECK(HandleQuad::from_quad(default_graph_quad).to_quad() == default_graph_quad);
+    }
+
+    SUBCASE("ordered by raw handles") {
+        auto const o2 = Literal::make_typed_from_value<datatypes::xsd::Double>(42.0);
+
+        std::vector<HandleQuad> quads{HandleQuad::from_quad(Quad{g, s, p, o2}),
+                                      HandleQuad::from_quad(Quad{g, s, p, o}),
+                                      HandleQuad::from_quad(Quad{g, p, s, o}),
+                                      HandleQuad::from_quad(Quad{g, s, p, o})};
+        std::sort(quads.begin(), quads.end());
+        quads.erase(std::unique(quads.begin(), quads.end()), quads.end());
+        CHECK(quads.size() == 3);
+
+        CHECK(std::is_sorted(quads.begin(), quads.end(), [](auto const &lhs, auto const &rhs) {
+            return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](auto const &l, auto const &r) {
+                return l.raw() < r.raw();
+            });
+        }));
+
+        CHECK(std::hash<HandleQuad>{}(quads[0]) == std::hash<HandleQuad>{}(HandleQuad{quads[0]}));
+    }
+}
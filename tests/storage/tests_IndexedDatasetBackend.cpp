@@ -0,0 +1,207 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/IndexedDatasetBackend.hpp>
+
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+static std::set<std::vector<Node>> collect(query::SolutionSequence const &solutions) {
+    std::set<std::vector<Node>> ret;
+    for (auto const &solution : solutions) {
+        std::vector<Node> row;
+        for (size_t ix = 0; ix < solution.variable_count(); ++ix) {
+            row.push_back(solution[ix]);
+        }
+        ret.insert(std::move(row));
+    }
+    return ret;
+}
+
+TEST_CASE("IndexedDatasetBackend") {
+    IndexedDatasetBackend indexed;
+    DefaultDatasetBackend reference;
+
+    IRI const g1{"http://example.com/g1"};
+    IRI const g2{"http://example.com/g2"};
+    IRI const p1{"http://example.com/p1"};
+    IRI const p2{"http://example.com/p2"};
+    IRI const s1{"http://example.com/s1"};
+    BlankNode const s2{"b0"};
+
+    std::vector<Quad> const quads{
+            Quad{g1, s1, p1, Literal::make_simple("a")},
+            Quad{g1, s1, p2, Literal::make_typed_from_value<datatypes::xsd::Int>(42)},
+            Quad{g1, s2, p1, s1},
+            Quad{g2, s1, p1, Literal::make_simple("a")},
+            Quad{g2, s2, p2, Literal::make_lang_tagged("b", "en")},
+            Quad{s1, p1, Literal::make_simple("c")},
+    };
+
+    for (auto const &quad : quads) {
+        indexed.add(quad);
+        reference.add(quad);
+    }
+    indexed.add(quads.front());  // duplicates are ignored
+
+    SUBCASE("size and contains") {
+        CHECK(indexed.size() == quads.size());
+        CHECK(indexed.size(g1) == 3);
+        CHECK(indexed.size(g2) == 2);
+        CHECK(indexed.size(IRI::default_graph()) == 1);
+
+        for (auto const &quad : quads) {
+            CHECK(indexed.contains(quad));
+        }
+        CHECK(not indexed.contains(Quad{g2, s2, p1, s1}));
+    }
+
+    SUBCASE("iteration") {
+        std::set<Quad> iterated;
+        for (auto it = indexed.begin(); it != indexed.end(); ++it) {
+            iterated.insert(*it);
+        }
+        CHECK(iterated == std::set<Quad>(quads.begin(), quads.end()));
+    }
+
+    SUBCASE("match agrees with DefaultDatasetBackend for every combination of bound positions") {
+        query::Variable const vg{"g"};
+        query::Variable const vs{"s"};
+        query::Variable const vp{"p"};
+        query::Variable const vo{"o"};
+
+        for (auto const &quad : quads) {
+            for (uint8_t mask = 0; mask < 16; ++mask) {
+                query::QuadPattern const pattern{(mask & 1) ? quad.graph() : vg,
+                                                 (mask & 2) ? quad.subject() : vs,
+                                                 (mask & 4) ? quad.predicate() : vp,
+                                                 (mask & 8) ? quad.object() : vo};
+
+                auto const expected = collect(reference.match(pattern));
+                auto const actual = collect(indexed.match(pattern));
+                CHECK(not actual.empty());
+                CHECK(actual == expected);
+            }
+        }
+    }
+
+    SUBCASE("no match") {
+        query::QuadPattern const pattern{g2, s1, p2, query::Variable{"o"}};
+        auto const solutions = indexed.match(pattern);
+        CHECK(solutions.begin() == solutions.end());
+    }
+}
+
+TEST_CASE("IndexedDatasetBackend as Dataset backend") {
+    auto dataset = Dataset::new_instance<IndexedDatasetBackend>();
+
+    IRI const s{"http://example.com/s"};
+    IRI const p{"http://example.com/p"};
+    dataset.add(Quad{s, p, Literal::make_simple("x")});
+    dataset.add(Quad{s, p, Literal::make_simple("y")});
+
+    CHECK(dataset.size() == 2);
+
+    size_t count = 0;
+    for (auto const &solution : dataset.match(query::QuadPattern{IRI::default_graph(), s, p, query::Variable{"o"}})) {
+        CHECK(solution.variable_count() == 1);
+        CHECK(solution[0].is_literal());
+        ++count;
+    }
+    CHECK(count == 2);
+}
+
+TEST_CASE("IndexedDatasetBackend add_bulk") {
+    IRI const g{"http://example.com/g"};
+    IRI const p{"http://example.com/p"};
+
+    std::vector<Quad> quads;
+    for (size_t ix = 0; ix < 40000; ++ix) {
+        quads.emplace_back(g, IRI{"http://example.com/s" + std::to_string(ix % 1000)}, p, Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix % 30000)));
+    }
+
+    SUBCASE("agrees with add") {
+        for (size_t const count : {size_t{0}, size_t{100}, quads.size()}) {
+            CAPTURE(count);
+            std::span<Quad const> const input{quads.data(), count};
+
+            IndexedDatasetBackend bulk;
+            bulk.add(quads.back());
+            bulk.add_bulk(input);
+
+            IndexedDatasetBackend single;
+            single.add(quads.back());
+            for (auto const &quad : input) {
+                single.add(quad);
+            }
+
+            REQUIRE(bulk.size() == single.size());
+
+            std::vector<Quad> bulk_quads;
+            for (auto it = bulk.begin(); it != bulk.end(); ++it) {
+                bulk_quads.push_back(*it);
+            }
+            std::vector<Quad> single_quads;
+            for (auto it = single.begin(); it != single.end(); ++it) {
+                single_quads.push_back(*it);
+            }
+            CHECK(bulk_quads == single_quads);
+
+            query::QuadPattern const pattern{g, query::Variable{"s"}, p, Literal::make_typed_from_value<datatypes::xsd::Int>(7)};
+            CHECK(collect(bulk.match(pattern)) == collect(single.match(pattern)));
+        }
+    }
+
+    SUBCASE("invalid quad") {
+        IndexedDatasetBackend bulk;
+        std::vector<Quad> const invalid{quads[0], Quad{g, Literal::make_simple("not a subject"), p, p}};
+        CHECK_THROWS_AS(bulk.add_bulk(invalid), std::logic_error);
+        CHECK(bulk.size() == 0);
+    }
+
+    SUBCASE("quad of another NodeStorage") {
+        auto other_storage = storage::node::NodeStorage::new_instance();
+        Quad const other{IRI{"http://example.com/g", other_storage}, IRI{"http://example.com/s", other_storage}, IRI{"http://example.com/p", other_storage}, IRI{"http://example.com/o", other_storage}};
+
+        IndexedDatasetBackend bulk;
+        CHECK_THROWS_AS(bulk.add(other), std::logic_error);
+        std::vector<Quad> const mixed{quads[0], other};
+        CHECK_THROWS_AS(bulk.add_bulk(mixed), std::logic_error);
+        CHECK(bulk.size() == 0);
+    }
+
+    SUBCASE("Dataset") {
+        auto dataset = Dataset::new_instance<IndexedDatasetBackend>();
+        dataset.add_bulk(quads);
+        CHECK(dataset.size() == 30000);
+        CHECK(dataset.contains(quads[12345]));
+    }
+}
+
+TEST_CASE("IndexedDatasetBackend load_from") {
+    std::istringstream iss{"<http://example.com/s> <http://example.com/p> \"1\"^^<http://www.w3.org/2001/XMLSchema#int> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"abc\"^^<http://www.w3.org/2001/XMLSchema#int> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"2\"^^<http://www.w3.org/2001/XMLSchema#int> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"1\"^^<http://www.w3.org/2001/XMLSchema#int> .\n"};
+
+    auto node_storage = storage::node::NodeStorage::new_instance();
+    auto dataset = Dataset::new_instance<IndexedDatasetBackend>(node_storage);
+
+    parser::IStreamQuadIterator qit{iss};
+    CHECK(dataset.load_from(qit) == 1);
+    CHECK(qit == parser::IStreamQuadIterator{});
+
+    CHECK(dataset.size() == 2);
+    CHECK(dataset.contains(Quad{IRI{"http://example.com/s"}, IRI{"http://example.com/p"}, Literal::make_typed_from_value<datatypes::xsd::Int>(2)}));
+    for (auto const &quad : dataset) {
+        for (auto const &node : quad) {
+            CHECK(node.backend_handle().node_storage_id() == node_storage.id());
+        }
+    }
+}
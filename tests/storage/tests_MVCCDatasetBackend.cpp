@@ -0,0 +1,241 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/tuple/MVCCDatasetBackend.hpp>
+
+#include <atomic>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::tuple;
+
+static std::set<std::vector<Node>> collect(query::SolutionSequence const &solutions) {
+    std::set<std::vector<Node>> ret;
+    for (auto const &solution : solutions) {
+        std::vector<Node> row;
+        for (size_t ix = 0; ix < solution.variable_count(); ++ix) {
+            row.push_back(solution[ix]);
+        }
+        ret.insert(std::move(row));
+    }
+    return ret;
+}
+
+static std::vector<Quad> collect(IDatasetBackend const &backend) {
+    std::vector<Quad> ret;
+    for (auto it = backend.begin(); it != backend.end(); ++it) {
+        ret.push_back(*it);
+    }
+    return ret;
+}
+
+TEST_CASE("MVCCDatasetBackend") {
+    MVCCDatasetBackend mvcc;
+    DefaultDatasetBackend reference;
+
+    IRI const g1{"http://example.com/g1"};
+    IRI const g2{"http://example.com/g2"};
+    IRI const p1{"http://example.com/p1"};
+    IRI const p2{"http://example.com/p2"};
+
+    // enough quads to merge the delta into the base a few times
+    std::vector<Quad> quads;
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        quads.emplace_back(ix % 3 == 0 ? g1 : g2,
+                           IRI{"http://example.com/s" + std::to_string(ix % 50)},
+                           ix % 2 == 0 ? p1 : p2,
+                           Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix % 200)));
+    }
+
+    for (auto const &quad : quads) {
+        mvcc.add(quad);
+        reference.add(quad);
+    }
+    mvcc.add(quads.front());  // duplicates are ignored
+
+    SUBCASE("size and contains") {
+        CHECK(mvcc.size() == reference.size());
+        CHECK(mvcc.size(g1) == reference.size(g1));
+        CHECK(mvcc.size(g2) == reference.size(g2));
+        CHECK(mvcc.size(IRI::default_graph()) == 0);
+
+        for (auto const &quad : quads) {
+            CHECK(mvcc.contains(quad));
+        }
+        CHECK(not mvcc.contains(Quad{g1, p1, p1, p1}));
+    }
+
+    SUBCASE("iteration") {
+        auto const iterated = collect(mvcc);
+        CHECK(iterated.size() == mvcc.size());
+        CHECK(std::set<Quad>(iterated.begin(), iterated.end()) == std::set<Quad>(quads.begin(), quads.end()));
+    }
+
+    SUBCASE("match agrees with DefaultDatasetBackend for every combination of bound positions") {
+        query::Variable const vg{"g"};
+        query::Variable const vs{"s"};
+        query::Variable const vp{"p"};
+        query::Variable const vo{"o"};
+
+        for (size_t ix = 0; ix < quads.size(); ix += 97) {
+            auto const &quad = quads[ix];
+            for (uint8_t mask = 0; mask < 16; ++mask) {
+                query::QuadPattern const pattern{(mask & 1) ? quad.graph() : vg,
+                                                 (mask & 2) ? quad.subject() : vs,
+                                                 (mask & 4) ? quad.predicate() : vp,
+                                                 (mask & 8) ? quad.object() : vo};
+
+                auto const expected = collect(reference.match(pattern));
+                auto const actual = collect(mvcc.match(pattern));
+                CHECK(not actual.empty());
+                CHECK(actual == expected);
+            }
+        }
+    }
+
+    SUBCASE("no match") {
+        query::QuadPattern const pattern{g1, p1, p1, query::Variable{"o"}};
+        auto const solutions = mvcc.match(pattern);
+        CHECK(solutions.begin() == solutions.end());
+    }
+}
+
+TEST_CASE("MVCCDatasetBackend snapshots") {
+    MVCCDatasetBackend mvcc;
+
+    IRI const s{"http://example.com/s"};
+    IRI const p{"http://example.com/p"};
+    query::QuadPattern const pattern{IRI::default_graph(), s, p, query::Variable{"o"}};
+
+    mvcc.add(Quad{s, p, Literal::make_simple("x")});
+
+    auto const snapshot = mvcc.snapshot();
+    auto const solutions = mvcc.match(pattern);
+    auto const it = mvcc.begin();
+
+    mvcc.add(Quad{s, p, Literal::make_simple("y")});
+    mvcc.add_bulk(std::vector<Quad>{Quad{s, p, Literal::make_simple("z")}});
+
+    // views created before the writes still see the old version
+    CHECK(snapshot->size() == 1);
+    CHECK(collect(solutions).size() == 1);
+    auto copy = it;
+    CHECK(*copy == Quad{s, p, Literal::make_simple("x")});
+    ++copy;
+    CHECK(copy == mvcc.end());
+
+    CHECK(mvcc.size() == 3);
+    CHECK(collect(mvcc.match(pattern)).size() == 3);
+    CHECK(collect(mvcc).size() == 3);
+}
+
+TEST_CASE("MVCCDatasetBackend add_bulk") {
+    IRI const g{"http://example.com/g"};
+    IRI const p{"http://example.com/p"};
+
+    std::vector<Quad> quads;
+    for (size_t ix = 0; ix < 5000; ++ix) {
+        quads.emplace_back(g, IRI{"http://example.com/s" + std::to_string(ix % 100)}, p, Literal::make_typed_from_value<datatypes::xsd::Int>(static_cast<int32_t>(ix % 3000)));
+    }
+
+    SUBCASE("agrees with add") {
+        MVCCDatasetBackend bulk;
+        MVCCDatasetBackend single;
+        for (size_t ix = 0; ix < 300; ++ix) {
+            // leaves quads in the delta of both
+            bulk.add(quads[ix]);
+            single.add(quads[ix]);
+        }
+
+        bulk.add_bulk(quads);
+        for (auto const &quad : quads) {
+            single.add(quad);
+        }
+
+        CHECK(bulk.size() == 3000);
+        CHECK(bulk.snapshot()->delta->size() == 0);
+        CHECK(collect(bulk) == collect(single));
+
+        query::QuadPattern const pattern{g, query::Variable{"s"}, p, Literal::make_typed_from_value<datatypes::xsd::Int>(7)};
+        CHECK(collect(bulk.match(pattern)) == collect(single.match(pattern)));
+    }
+
+    SUBCASE("invalid quad") {
+        MVCCDatasetBackend bulk;
+        std::vector<Quad> const invalid{quads[0], Quad{g, Literal::make_simple("not a subject"), p, p}};
+        CHECK_THROWS_AS(bulk.add_bulk(invalid), std::logic_error);
+        CHECK(bulk.size() == 0);
+    }
+
+    SUBCASE("quad of another NodeStorage") {
+        auto other_storage = storage::node::NodeStorage::new_instance();
+        Quad const other{IRI{"http://example.com/g", other_storage}, IRI{"http://example.com/s", other_storage}, IRI{"http://example.com/p", other_storage}, IRI{"http://example.com/o", other_storage}};
+
+        MVCCDatasetBackend bulk;
+        CHECK_THROWS_AS(bulk.add(other), std::logic_error);
+        std::vector<Quad> const mixed{quads[0], other};
+        CHECK_THROWS_AS(bulk.add_bulk(mixed), std::logic_error);
+        CHECK(bulk.size() == 0);
+    }
+
+    SUBCASE("Dataset") {
+        auto dataset = Dataset::new_instance<MVCCDatasetBackend>();
+        dataset.add_bulk(quads);
+        CHECK(dataset.size() == 3000);
+        CHECK(dataset.contains(quads[1234]));
+    }
+}
+
+TEST_CASE("MVCCDatasetBackend concurrent readers") {
+    MVCCDatasetBackend mvcc;
+
+    IRI const s{"http://example.com/s"};
+    IRI const p{"http://example.com/p"};
+    query::QuadPattern const pattern{IRI::default_graph(), s, p, query::Variable{"o"}};
+
+    static constexpr int32_t quad_count = 3000;
+    std::vector<Quad> quads;
+    for (int32_t ix = 0; ix < quad_count; ++ix) {
+        quads.emplace_back(s, p, Literal::make_typed_from_value<datatypes::xsd::Int>(ix));
+    }
+
+    std::atomic<bool> done = false;
+    std::atomic<size_t> inconsistencies = 0;
+
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < 3; ++t) {
+        readers.emplace_back([&]() {
+            size_t last_count = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                // quads are added in order, so every version must contain exactly the first count of them
+                std::set<int32_t> values;
+                for (auto const &solution : mvcc.match(pattern)) {
+                    values.insert(solution[0].as_literal().value<datatypes::xsd::Int>());
+                }
+
+                auto const count = values.size();
+                if (count < last_count || (count > 0 && (*values.begin() != 0 || *values.rbegin() != static_cast<int32_t>(count) - 1))) {
+                    inconsistencies.fetch_add(1, std::memory_order_relaxed);
+                }
+                last_count = count;
+            }
+        });
+    }
+
+    for (auto const &quad : quads) {
+        mvcc.add(quad);
+    }
+    done.store(true, std::memory_order_release);
+
+    for (auto &reader : readers) {
+        reader.join();
+    }
+
+    CHECK(inconsistencies == 0);
+    CHECK(mvcc.size() == quad_count);
+    CHECK(collect(mvcc.match(pattern)).size() == quad_count);
+}
@@ -0,0 +1,58 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+#include <rdf4cpp/rdf/storage/node/reference_node_storage/HashPolicy.hpp>
+#include <rdf4cpp/rdf/storage/util/wyhash/wyhash.hpp>
+
+#include <set>
+#include <string>
+#include <string_view>
+
+using namespace rdf4cpp::rdf::storage;
+
+TEST_SUITE("wyhash") {
+
+    TEST_CASE("test vectors") {
+        // from the reference implementation, the seed of every message is its index
+        auto const hash = [](std::string_view const msg, uint64_t const seed) {
+            return static_cast<uint64_t>(util::wyhash::hash_bytes(msg.data(), msg.size(), seed));
+        };
+
+        CHECK(hash("", 0) == UINT64_C(0x93228a4de0eec5a2));
+        CHECK(hash("a", 1) == UINT64_C(0xc5bac3db178713c4));
+        CHECK(hash("abc", 2) == UINT64_C(0xa97f2f7b1d9b3314));
+        CHECK(hash("message digest", 3) == UINT64_C(0x786d1f1df3801df4));
+        CHECK(hash("abcdefghijklmnopqrstuvwxyz", 4) == UINT64_C(0xdca5a8138ad37c87));
+        CHECK(hash("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 5) == UINT64_C(0xb9e734f117cfaf70));
+        CHECK(hash("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6) == UINT64_C(0x6cc5eab49a92d617));
+    }
+
+    TEST_CASE("all lengths") {
+        // covers every branch of hash_bytes, the IRIs share long prefixes like in real data
+        std::string const text = "http://www.wikidata.org/entity/Q1234567890123456789012345678901234567890123456789012345678901234567890";
+
+        std::set<size_t> hashes;
+        for (size_t len = 0; len <= text.size(); ++len) {
+            auto const h = util::wyhash::hash_bytes(text.data(), len);
+            CHECK(h == util::wyhash::hash<std::string_view>{}(std::string_view{text}.substr(0, len)));
+            CHECK(h == util::wyhash::hash<std::string>{}(text.substr(0, len)));
+            CHECK(h != util::wyhash::hash_bytes(text.data(), len, 1));
+            hashes.insert(h);
+        }
+        CHECK(hashes.size() == text.size() + 1);
+    }
+
+    TEST_CASE("seeded hash policy") {
+        using node::reference_node_storage::SeededHashPolicy;
+        using node::reference_node_storage::UnseededHashPolicy;
+
+        SeededHashPolicy const a;
+        SeededHashPolicy const b;
+        CHECK(a.seed != b.seed);
+        CHECK(a(42) == a(42));
+        CHECK(a(42) != b(42));
+
+        CHECK(UnseededHashPolicy{}(42) == 42);
+    }
+}
@@ -0,0 +1,119 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace rdf4cpp::rdf;
+using namespace rdf4cpp::rdf::storage::node;
+
+static std::multiset<std::string> to_strings(Dataset const &dataset) {
+    std::multiset<std::string> ret;
+    for (Quad const &quad : dataset) {
+        ret.insert(static_cast<std::string>(quad.graph()) + " " + static_cast<std::string>(quad.subject()) + " "
+                   + static_cast<std::string>(quad.predicate()) + " " + static_cast<std::string>(quad.object()));
+    }
+    return ret;
+}
+
+static Dataset make_dataset(NodeStorage &node_storage) {
+    Dataset dataset{node_storage};
+
+    IRI const g{"http://example.com/graph", node_storage};
+    IRI const p{"http://example.com/p", node_storage};
+    std::vector<Node> const objects{
+            IRI{"http://example.com/o", node_storage},
+            BlankNode{"b1", node_storage},
+            Literal::make_simple("simple", node_storage),
+            Literal::make_simple("with \"quotes\"\n", node_storage),
+            Literal::make_lang_tagged("hallo", "de", node_storage),
+            Literal::make_typed_from_value<datatypes::xsd::Int>(42, node_storage),
+            Literal::make_typed_from_value<datatypes::xsd::Integer>(datatypes::xsd::Integer::cpp_type{"123456789012345678901234567890"}, node_storage),
+            Literal::make_typed("1.50", IRI{"http://www.w3.org/2001/XMLSchema#decimal", node_storage}, node_storage),
+            Literal::make_typed("abc", IRI{"http://example.com/custom-datatype", node_storage}, node_storage)};
+
+    for (size_t ix = 0; ix < 1000; ++ix) {
+        Node const subject = ix % 7 == 0 ? Node{BlankNode{"s" + std::to_string(ix % 50), node_storage}}
+                                         : Node{IRI{"http://example.com/subjects/" + std::to_string(ix % 100), node_storage}};
+        if (ix % 2 == 0) {
+            dataset.add(Quad{g, subject, p, objects[ix % objects.size()]});
+        } else {
+            dataset.add(Quad{subject, p, objects[ix % objects.size()]});
+        }
+    }
+
+    return dataset;
+}
+
+TEST_CASE("binary snapshot round trip") {
+    auto &node_storage = NodeStorage::default_instance();
+    auto const dataset = make_dataset(node_storage);
+
+    std::stringstream snapshot;
+    snapshot << writer::BinarySnapshotWriter{dataset};
+
+    SUBCASE("same NodeStorage") {
+        Dataset loaded{node_storage};
+        parser::read_binary_snapshot(snapshot, loaded);
+
+        CHECK(loaded.size() == dataset.size());
+        for (Quad const &quad : dataset) {
+            CHECK(loaded.contains(quad));
+        }
+    }
+
+    SUBCASE("other NodeStorage") {
+        auto other_storage = NodeStorage::new_instance<reference_node_storage::ReferenceNodeStorageBackend>();
+        Dataset loaded{other_storage};
+        parser::read_binary_snapshot(snapshot, loaded);
+
+        CHECK(loaded.size() == dataset.size());
+        CHECK(to_strings(loaded) == to_strings(dataset));
+        for (Quad const &quad : loaded) {
+            for (auto const &node : quad) {
+                CHECK(node.backend_handle().node_storage_id() == other_storage.id());
+            }
+        }
+    }
+
+    SUBCASE("smaller than N-Quads") {
+        CHECK(snapshot.str().size() < static_cast<std::string>(writer::NQuadsWriter{dataset}).size() / 4);
+    }
+}
+
+TEST_CASE("binary snapshot empty dataset") {
+    Dataset const dataset;
+
+    std::stringstream snapshot;
+    snapshot << writer::BinarySnapshotWriter{dataset};
+
+    Dataset loaded;
+    parser::read_binary_snapshot(snapshot, loaded);
+    CHECK(loaded.size() == 0);
+}
+
+TEST_CASE("binary snapshot invalid input") {
+    auto const dataset = make_dataset(NodeStorage::default_instance());
+
+    std::stringstream snapshot;
+    snapshot << writer::BinarySnapshotWriter{dataset};
+    auto const data = snapshot.str();
+
+    SUBCASE("no snapshot") {
+        std::istringstream in{"<http://example.com/s> <http://example.com/p> <http://example.com/o> ."};
+        Dataset loaded;
+        CHECK_THROWS_AS(parser::read_binary_snapshot(in, loaded), std::runtime_error);
+    }
+
+    SUBCASE("truncated") {
+        for (size_t const size : {size_t{0}, size_t{10}, data.size() / 2, data.size() - 1}) {
+            std::istringstream in{data.substr(0, size)};
+            Dataset loaded;
+            CHECK_THROWS_AS(parser::read_binary_snapshot(in, loaded), std::runtime_error);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include <doctest/doctest.h>
+#include <rdf4cpp/rdf.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace rdf4cpp::rdf;
+
+TEST_CASE("BufferedWriter") {
+    std::vector<Node> const nodes{
+            IRI{"http://example.com/s"},
+            IRI{"http://example.com/p"},
+            BlankNode{"b0"},
+            query::Variable{"x"},
+            query::Variable{"y", true},
+            Literal::make_simple("simple"),
+            Literal::make_simple("needs \"escaping\" \\ \n\r and more"),
+            Literal::make_lang_tagged("hallo", "de"),
+            Literal::make_typed_from_value<datatypes::xsd::Int>(42),
+            Literal::make_typed_from_value<datatypes::xsd::Boolean>(true),
+            Literal::make_typed_from_value<datatypes::xsd::Integer>(datatypes::xsd::Integer::cpp_type{"123456789012345678901234567890"}),
+            Literal::make_typed("1.5", IRI{"http://www.w3.org/2001/XMLSchema#decimal"}),
+            Literal::make_typed("abc", IRI{"http://example.com/custom-datatype"})};
+
+    SUBCASE("nodes") {
+        // tiny buffer and cache, so that flushing and the cache limit are exercised
+        for (auto const [buffer_capacity, cache_capacity] : {std::pair<size_t, size_t>{1, 0}, {16, 64}, {1 << 20, 1 << 20}}) {
+            std::ostringstream oss;
+            std::string expected;
+
+            {
+                writer::BufferedWriter w{oss, buffer_capacity, cache_capacity};
+                for (size_t round = 0; round < 3; ++round) {
+                    for (auto const &node : nodes) {
+                        w.write_node(node);
+                        expected += static_cast<std::string>(node);
+                    }
+                }
+            }
+
+            CHECK(oss.str() == expected);
+        }
+    }
+
+    SUBCASE("statements") {
+        IRI const s{"http://example.com/s"};
+        IRI const p{"http://example.com/p"};
+        IRI const g{"http://example.com/g"};
+        auto const o = Literal::make_simple("o");
+
+        std::ostringstream oss;
+        writer::BufferedWriter w{oss};
+        w.write_triple(s, p, o);
+        w.write_quad(Quad{g, s, p, o});
+        w.write_quad(Quad{s, p, o});
+        w.write_quad(Quad{IRI::default_graph(), s, p, o});
+
+        // the default graph of a different NodeStorage
+        auto node_storage = storage::node::NodeStorage::new_instance();
+        w.write_quad(Quad{IRI::default_graph(node_storage), IRI{"http://example.com/s", node_storage}, IRI{"http://example.com/p", node_storage}, Literal::make_simple("o", node_storage)});
+        w.write_quad(Quad{IRI{"http://example.com/g", node_storage}, IRI{"http://example.com/s", node_storage}, IRI{"http://example.com/p", node_storage}, Literal::make_simple("o", node_storage)});
+        w.flush();
+
+        CHECK(oss.str() == "<http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n"
+                           "<http://example.com/g> <http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n"
+                           "<http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n"
+                           "<http://example.com/g> <http://example.com/s> <http://example.com/p> \"o\"^^<http://www.w3.org/2001/XMLSchema#string> .\n");
+    }
+
+    SUBCASE("dataset") {
+        Dataset dataset;
+        IRI const g{"http://example.com/g"};
+        for (size_t ix = 0; ix < 100; ++ix) {
+            if (auto const &object = nodes[ix % nodes.size()]; !object.is_variable()) {
+                dataset.add(Quad{g, IRI{"http://example.com/s" + std::to_string(ix % 10)}, IRI{"http://example.com/p"}, object});
+            }
+        }
+
+        std::string expected;
+        for (Quad const &quad : dataset) {
+            expected += static_cast<std::string>(quad.graph()) + " " + static_cast<std::string>(quad.subject()) + " "
+                        + static_cast<std::string>(quad.predicate()) + " " + static_cast<std::string>(quad.object()) + " .\n";
+        }
+
+        CHECK(static_cast<std::string>(writer::NQuadsWriter{dataset}) == expected);
+    }
+}